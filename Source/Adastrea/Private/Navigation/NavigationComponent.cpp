@@ -1,7 +1,9 @@
 // Copyright (c) 2025 Mittenzx. Licensed under MIT.
 
 #include "Navigation/NavigationComponent.h"
+#include "Navigation/SpaceNavigationSubsystem.h"
 #include "AdastreaLog.h"
+#include "Async/Async.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
@@ -85,6 +87,11 @@ bool UNavigationComponent::ActivateAutopilot(FVector TargetLocation)
     CurrentMode = ENavigationMode::Autopilot;
     bAutopilotActive = true;
 
+    // Fly toward the destination directly until the routed path arrives
+    PendingAutopilotRequestId = bAvoidObstacles
+        ? RequestPath3DAsync(GetOwner()->GetActorLocation(), TargetLocation)
+        : INDEX_NONE;
+
     OnAutopilotActivated();
 
     UE_LOG(LogAdastreaNavigation, Log, TEXT("NavigationComponent: Autopilot activated to %s"), *TargetLocation.ToString());
@@ -101,6 +108,7 @@ bool UNavigationComponent::ActivateAutopilotPath(const TArray<FNavigationWaypoin
 
     WaypointPath = Waypoints;
     CurrentWaypointIndex = 0;
+    PendingAutopilotRequestId = INDEX_NONE;
     CurrentMode = ENavigationMode::Autopilot;
     bAutopilotActive = true;
 
@@ -116,6 +124,7 @@ void UNavigationComponent::DeactivateAutopilot()
     {
         bAutopilotActive = false;
         CurrentMode = ENavigationMode::Manual;
+        PendingAutopilotRequestId = INDEX_NONE;
         CurrentVelocity = FVector::ZeroVector;
         
         OnAutopilotDeactivated();
@@ -187,6 +196,19 @@ bool UNavigationComponent::FindPath3D(FVector Start, FVector End, TArray<FNaviga
 {
     OutPath.Empty();
 
+    // Route through the navigation octree when the world has one
+    if (USpaceNavigationSubsystem* SpaceNavigation = GetWorld() ? GetWorld()->GetSubsystem<USpaceNavigationSubsystem>() : nullptr)
+    {
+        TArray<FVector> Points;
+        if (!SpaceNavigation->FindPath(Start, End, Points))
+        {
+            return false;
+        }
+
+        BuildWaypointsFromPath(Points, OutPath);
+        return OutPath.Num() > 0;
+    }
+
     // Simple direct path if no obstacles
     if (IsPathClear(Start, End))
     {
@@ -225,6 +247,47 @@ bool UNavigationComponent::FindPath3D(FVector Start, FVector End, TArray<FNaviga
     return OutPath.Num() > 0;
 }
 
+int32 UNavigationComponent::RequestPath3DAsync(FVector Start, FVector End)
+{
+    const int32 RequestId = ++LastPathRequestId;
+    TWeakObjectPtr<UNavigationComponent> WeakThis(this);
+
+    USpaceNavigationSubsystem* SpaceNavigation = GetWorld() ? GetWorld()->GetSubsystem<USpaceNavigationSubsystem>() : nullptr;
+    if (!SpaceNavigation)
+    {
+        // No octree: fall back to the trace-based path, still reported asynchronously
+        TArray<FNavigationWaypoint> Path;
+        const bool bPathFound = FindPath3D(Start, End, Path);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, RequestId, bPathFound, Path = MoveTemp(Path)]()
+        {
+            if (UNavigationComponent* StrongThis = WeakThis.Get())
+            {
+                StrongThis->HandlePathFound3D(RequestId, bPathFound, Path);
+            }
+        });
+        return RequestId;
+    }
+
+    SpaceNavigation->RequestPathAsync(Start, End, [WeakThis, RequestId](bool bPathFound, TArray<FVector>&& Points)
+    {
+        UNavigationComponent* StrongThis = WeakThis.Get();
+        if (!StrongThis)
+        {
+            return;
+        }
+
+        TArray<FNavigationWaypoint> Path;
+        if (bPathFound)
+        {
+            StrongThis->BuildWaypointsFromPath(Points, Path);
+        }
+        StrongThis->HandlePathFound3D(RequestId, bPathFound, Path);
+    });
+
+    return RequestId;
+}
+
 bool UNavigationComponent::IsPathClear(FVector Start, FVector End) const
 {
     if (!GetWorld())
@@ -373,10 +436,53 @@ void UNavigationComponent::OnObstacleDetected_Implementation(FVector ObstacleLoc
     UE_LOG(LogAdastreaNavigation, Warning, TEXT("NavigationComponent: Obstacle detected at %s"), *ObstacleLocation.ToString());
 }
 
+void UNavigationComponent::OnPathFound3D_Implementation(int32 RequestId, bool bPathFound, const TArray<FNavigationWaypoint>& Path)
+{
+    // Default implementation - can be overridden in Blueprint
+    UE_LOG(LogAdastreaNavigation, Verbose, TEXT("NavigationComponent: Path request %d %s (%d waypoints)"),
+        RequestId, bPathFound ? TEXT("succeeded") : TEXT("failed"), Path.Num());
+}
+
 // ====================
 // PRIVATE HELPERS
 // ====================
 
+void UNavigationComponent::BuildWaypointsFromPath(const TArray<FVector>& Points, TArray<FNavigationWaypoint>& OutPath) const
+{
+    OutPath.Reset(Points.Num());
+
+    // Points[0] is the start location, which the ship is already at
+    for (int32 i = 1; i < Points.Num(); ++i)
+    {
+        FNavigationWaypoint Waypoint;
+        Waypoint.Location = Points[i];
+        Waypoint.DesiredSpeed = MaxNavigationSpeed;
+        OutPath.Add(Waypoint);
+    }
+}
+
+void UNavigationComponent::HandlePathFound3D(int32 RequestId, bool bPathFound, const TArray<FNavigationWaypoint>& Path)
+{
+    // A newer ActivateAutopilot / ActivateAutopilotPath / DeactivateAutopilot supersedes this request
+    if (RequestId == PendingAutopilotRequestId)
+    {
+        PendingAutopilotRequestId = INDEX_NONE;
+
+        if (bPathFound && Path.Num() > 0 && bAutopilotActive && CurrentMode == ENavigationMode::Autopilot)
+        {
+            WaypointPath = Path;
+            FNavigationWaypoint& Destination = WaypointPath.Last();
+            Destination.WaypointName = FText::FromString(TEXT("Destination"));
+            Destination.bStopAtWaypoint = true;
+            CurrentWaypointIndex = 0;
+
+            UE_LOG(LogAdastreaNavigation, Log, TEXT("NavigationComponent: Autopilot routed around obstacles with %d waypoints"), WaypointPath.Num());
+        }
+    }
+
+    OnPathFound3D(RequestId, bPathFound, Path);
+}
+
 void UNavigationComponent::UpdateAutopilot(float DeltaTime)
 {
     if (!GetOwner() || WaypointPath.Num() == 0 || CurrentWaypointIndex >= WaypointPath.Num())
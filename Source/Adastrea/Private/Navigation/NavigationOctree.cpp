@@ -0,0 +1,495 @@
+#include "Navigation/NavigationOctree.h"
+#include "Algo/Reverse.h"
+#include "AdastreaLog.h"
+
+namespace NavigationOctreeHelpers
+{
+    /** Overlap with positive volume; boxes that only touch don't block each other */
+    bool Overlaps(const FBox& A, const FBox& B)
+    {
+        return A.Min.X < B.Max.X && B.Min.X < A.Max.X
+            && A.Min.Y < B.Max.Y && B.Min.Y < A.Max.Y
+            && A.Min.Z < B.Max.Z && B.Min.Z < A.Max.Z;
+    }
+
+    struct FOpenEntry
+    {
+        float Cost = 0.0f;
+        int32 Leaf = INDEX_NONE;
+    };
+
+    struct FSearchNode
+    {
+        FVector Position = FVector::ZeroVector;
+        float Cost = 0.0f;
+        int32 Parent = INDEX_NONE;
+        bool bClosed = false;
+    };
+}
+
+void FNavigationOctree::Reset()
+{
+    Nodes.Reset();
+    NumTruncatedNodes = 0;
+}
+
+void FNavigationOctree::Build(TConstArrayView<FBox> Obstacles, float InMinLeafSize)
+{
+    Reset();
+    MinLeafSize = FMath::Max(InMinLeafSize, 1.0f);
+
+    FBox ObstacleBounds(ForceInit);
+    TArray<int32> Candidates;
+    Candidates.Reserve(Obstacles.Num());
+    for (int32 Index = 0; Index < Obstacles.Num(); ++Index)
+    {
+        if (Obstacles[Index].IsValid)
+        {
+            ObstacleBounds += Obstacles[Index];
+            Candidates.Add(Index);
+        }
+    }
+
+    if (Candidates.Num() == 0)
+    {
+        return;
+    }
+
+    // Pad so paths can route around obstacles on the tree's edge, then grow to a
+    // power-of-two multiple of the leaf size so the finest leaves are exactly MinLeafSize
+    ObstacleBounds = ObstacleBounds.ExpandBy(MinLeafSize * 2.0f);
+    const double Extent = ObstacleBounds.GetSize().GetMax();
+    double RootSize = MinLeafSize;
+    while (RootSize < Extent)
+    {
+        RootSize *= 2.0;
+    }
+
+    const FVector Center = ObstacleBounds.GetCenter();
+    Nodes.AddDefaulted_GetRef().Bounds = FBox(Center - FVector(RootSize * 0.5), Center + FVector(RootSize * 0.5));
+
+    BuildNode(0, Obstacles, Candidates);
+
+    if (NumTruncatedNodes > 0)
+    {
+        UE_LOG(LogAdastreaNavigation, Warning, TEXT("NavigationOctree: Node limit (%d) reached, %d nodes near obstacles were left free; consider a larger MinLeafSize than %.0f"),
+            MaxNodes, NumTruncatedNodes, MinLeafSize);
+    }
+}
+
+void FNavigationOctree::BuildNode(int32 NodeIndex, TConstArrayView<FBox> Obstacles, const TArray<int32>& Candidates)
+{
+    const FBox Bounds = Nodes[NodeIndex].Bounds;
+
+    TArray<int32> Overlapping;
+    for (const int32 ObstacleIndex : Candidates)
+    {
+        const FBox& Obstacle = Obstacles[ObstacleIndex];
+        if (NavigationOctreeHelpers::Overlaps(Obstacle, Bounds))
+        {
+            if (Obstacle.IsInsideOrOn(Bounds.Min) && Obstacle.IsInsideOrOn(Bounds.Max))
+            {
+                Nodes[NodeIndex].State = ENodeState::Blocked;
+                return;
+            }
+            Overlapping.Add(ObstacleIndex);
+        }
+    }
+
+    if (Overlapping.Num() == 0)
+    {
+        Nodes[NodeIndex].State = ENodeState::Free;
+        return;
+    }
+
+    if (Bounds.GetSize().X <= MinLeafSize * 1.001)
+    {
+        Nodes[NodeIndex].State = ENodeState::Blocked;
+        return;
+    }
+
+    // Out of nodes: blocking a coarse node here could wall off large free regions, so leave it free
+    if (Nodes.Num() + 8 > MaxNodes)
+    {
+        Nodes[NodeIndex].State = ENodeState::Free;
+        ++NumTruncatedNodes;
+        return;
+    }
+
+    const int32 FirstChild = Nodes.Num();
+    Nodes[NodeIndex].FirstChild = FirstChild;
+    Nodes[NodeIndex].State = ENodeState::Mixed;
+    Nodes.AddDefaulted(8);
+
+    // Child bit 0 = upper X half, bit 1 = upper Y half, bit 2 = upper Z half (see FindLeaf)
+    const FVector Mid = Bounds.GetCenter();
+    for (int32 Child = 0; Child < 8; ++Child)
+    {
+        const FVector ChildMin((Child & 1) ? Mid.X : Bounds.Min.X, (Child & 2) ? Mid.Y : Bounds.Min.Y, (Child & 4) ? Mid.Z : Bounds.Min.Z);
+        const FVector ChildMax((Child & 1) ? Bounds.Max.X : Mid.X, (Child & 2) ? Bounds.Max.Y : Mid.Y, (Child & 4) ? Bounds.Max.Z : Mid.Z);
+        Nodes[FirstChild + Child].Bounds = FBox(ChildMin, ChildMax);
+    }
+
+    bool bAllBlocked = true;
+    for (int32 Child = 0; Child < 8; ++Child)
+    {
+        BuildNode(FirstChild + Child, Obstacles, Overlapping);
+
+        const FNode& ChildNode = Nodes[FirstChild + Child];
+        bAllBlocked &= ChildNode.FirstChild == INDEX_NONE && ChildNode.State == ENodeState::Blocked;
+    }
+
+    // Eight blocked leaves are the last nodes added, so they can be folded back into this one
+    if (bAllBlocked)
+    {
+        Nodes.SetNum(FirstChild, EAllowShrinking::No);
+        Nodes[NodeIndex].FirstChild = INDEX_NONE;
+        Nodes[NodeIndex].State = ENodeState::Blocked;
+    }
+}
+
+int32 FNavigationOctree::FindLeaf(const FVector& Point) const
+{
+    if (IsEmpty() || !Nodes[0].Bounds.IsInsideOrOn(Point))
+    {
+        return INDEX_NONE;
+    }
+
+    int32 NodeIndex = 0;
+    while (Nodes[NodeIndex].FirstChild != INDEX_NONE)
+    {
+        const FVector Mid = Nodes[NodeIndex].Bounds.GetCenter();
+        const int32 Child = (Point.X >= Mid.X ? 1 : 0) | (Point.Y >= Mid.Y ? 2 : 0) | (Point.Z >= Mid.Z ? 4 : 0);
+        NodeIndex = Nodes[NodeIndex].FirstChild + Child;
+    }
+    return NodeIndex;
+}
+
+void FNavigationOctree::GatherFreeLeaves(const FBox& Box, TArray<int32>& OutLeaves) const
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    TArray<int32, TInlineAllocator<64>> Stack;
+    Stack.Add(0);
+    while (Stack.Num() > 0)
+    {
+        const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+        const FNode& Node = Nodes[NodeIndex];
+
+        // Touching counts here: leaves sharing a face, edge or corner are neighbors
+        if (Node.State == ENodeState::Blocked || !Node.Bounds.Intersect(Box))
+        {
+            continue;
+        }
+
+        if (Node.FirstChild == INDEX_NONE)
+        {
+            OutLeaves.Add(NodeIndex);
+        }
+        else
+        {
+            for (int32 Child = 0; Child < 8; ++Child)
+            {
+                Stack.Add(Node.FirstChild + Child);
+            }
+        }
+    }
+}
+
+int32 FNavigationOctree::FindNearestFreeLeaf(const FVector& Point) const
+{
+    const double RootSize = GetBounds().GetSize().X;
+
+    TArray<int32> Candidates;
+    for (double HalfSize = MinLeafSize; HalfSize <= RootSize * 2.0; HalfSize *= 2.0)
+    {
+        Candidates.Reset();
+        GatherFreeLeaves(FBox(Point - FVector(HalfSize), Point + FVector(HalfSize)), Candidates);
+
+        int32 Nearest = INDEX_NONE;
+        double NearestDistanceSquared = TNumericLimits<double>::Max();
+        for (const int32 Leaf : Candidates)
+        {
+            const double DistanceSquared = FVector::DistSquared(Point, Nodes[Leaf].Bounds.GetCenter());
+            if (DistanceSquared < NearestDistanceSquared)
+            {
+                NearestDistanceSquared = DistanceSquared;
+                Nearest = Leaf;
+            }
+        }
+
+        if (Nearest != INDEX_NONE)
+        {
+            return Nearest;
+        }
+    }
+    return INDEX_NONE;
+}
+
+bool FNavigationOctree::IsSegmentClear(const FVector& Start, const FVector& End) const
+{
+    if (IsEmpty())
+    {
+        return true;
+    }
+
+    if (Start.Equals(End))
+    {
+        const int32 Leaf = FindLeaf(Start);
+        return Leaf == INDEX_NONE || Nodes[Leaf].State != ENodeState::Blocked;
+    }
+
+    return !SegmentHitsBlocked(0, Start, End);
+}
+
+bool FNavigationOctree::SegmentHitsBlocked(int32 NodeIndex, const FVector& Start, const FVector& End) const
+{
+    const FNode& Node = Nodes[NodeIndex];
+    if (Node.State == ENodeState::Free || !FMath::LineBoxIntersection(Node.Bounds, Start, End, End - Start))
+    {
+        return false;
+    }
+
+    if (Node.State == ENodeState::Blocked)
+    {
+        return true;
+    }
+
+    for (int32 Child = 0; Child < 8; ++Child)
+    {
+        if (SegmentHitsBlocked(Node.FirstChild + Child, Start, End))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FNavigationOctree::FindPath(const FVector& Start, const FVector& End, TArray<FVector>& OutPath, int32 MaxExpansions) const
+{
+    OutPath.Reset();
+
+    if (IsSegmentClear(Start, End))
+    {
+        OutPath.Add(Start);
+        OutPath.Add(End);
+        return true;
+    }
+
+    // Points outside the tree enter it at the closest boundary point; the segment
+    // to that point stays outside the tree, so it can't hit anything
+    const FBox Bounds = GetBounds();
+    const FVector StartEntry = Bounds.GetClosestPointTo(Start);
+    const FVector GoalExit = Bounds.GetClosestPointTo(End);
+
+    // Ships often start or end inside an obstacle's clearance (e.g. docked), so snap
+    // blocked endpoints to the nearest free leaf
+    int32 StartLeaf = FindLeaf(StartEntry);
+    FVector StartPoint = StartEntry;
+    if (StartLeaf == INDEX_NONE || Nodes[StartLeaf].State == ENodeState::Blocked)
+    {
+        StartLeaf = FindNearestFreeLeaf(StartEntry);
+        StartPoint = StartLeaf != INDEX_NONE ? Nodes[StartLeaf].Bounds.GetCenter() : StartEntry;
+    }
+
+    int32 GoalLeaf = FindLeaf(GoalExit);
+    FVector GoalPoint = GoalExit;
+    if (GoalLeaf == INDEX_NONE || Nodes[GoalLeaf].State == ENodeState::Blocked)
+    {
+        GoalLeaf = FindNearestFreeLeaf(GoalExit);
+        GoalPoint = GoalLeaf != INDEX_NONE ? Nodes[GoalLeaf].Bounds.GetCenter() : GoalExit;
+    }
+
+    TArray<FVector> LeafPath;
+    if (StartLeaf == INDEX_NONE || GoalLeaf == INDEX_NONE
+        || !SearchLeaves(StartLeaf, StartPoint, GoalLeaf, GoalPoint, LeafPath, MaxExpansions))
+    {
+        return false;
+    }
+
+    auto AddPoint = [&OutPath](const FVector& Point)
+    {
+        if (OutPath.Num() == 0 || !OutPath.Last().Equals(Point, 1.0))
+        {
+            OutPath.Add(Point);
+        }
+    };
+
+    AddPoint(Start);
+    AddPoint(StartEntry);
+    for (const FVector& Point : LeafPath)
+    {
+        AddPoint(Point);
+    }
+    AddPoint(GoalExit);
+    AddPoint(End);
+
+    SmoothPath(OutPath);
+    return true;
+}
+
+bool FNavigationOctree::SearchLeaves(int32 StartLeaf, const FVector& StartPoint, int32 GoalLeaf, const FVector& GoalPoint, TArray<FVector>& OutPath, int32 MaxExpansions) const
+{
+    using namespace NavigationOctreeHelpers;
+
+    OutPath.Reset();
+    if (StartLeaf == GoalLeaf)
+    {
+        // Leaves are convex and free, so the straight line stays inside
+        OutPath.Add(StartPoint);
+        OutPath.Add(GoalPoint);
+        return true;
+    }
+
+    auto GetPosition = [this, StartLeaf, &StartPoint, GoalLeaf, &GoalPoint](int32 Leaf)
+    {
+        return Leaf == StartLeaf ? StartPoint : (Leaf == GoalLeaf ? GoalPoint : Nodes[Leaf].Bounds.GetCenter());
+    };
+    auto CheapestFirst = [](const FOpenEntry& A, const FOpenEntry& B)
+    {
+        return A.Cost < B.Cost;
+    };
+
+    TMap<int32, FSearchNode> Visited;
+    TArray<FOpenEntry> Open;
+    TArray<int32> Neighbors;
+
+    FSearchNode& StartNode = Visited.Add(StartLeaf);
+    StartNode.Position = StartPoint;
+    Open.HeapPush(FOpenEntry{ static_cast<float>(FVector::Dist(StartPoint, GoalPoint)), StartLeaf }, CheapestFirst);
+
+    const double NeighborSlack = MinLeafSize * 0.01;
+    int32 Expansions = 0;
+    bool bFound = false;
+
+    while (Open.Num() > 0)
+    {
+        FOpenEntry Entry;
+        Open.HeapPop(Entry, CheapestFirst, EAllowShrinking::No);
+
+        FSearchNode& Current = Visited.FindChecked(Entry.Leaf);
+        if (Current.bClosed)
+        {
+            continue;
+        }
+        Current.bClosed = true;
+
+        if (Entry.Leaf == GoalLeaf)
+        {
+            bFound = true;
+            break;
+        }
+        if (++Expansions > MaxExpansions)
+        {
+            break;
+        }
+
+        // Copy out: adding neighbors below may reallocate the map
+        const FVector CurrentPosition = Current.Position;
+        const float CurrentCost = Current.Cost;
+        const int32 ParentLeaf = Current.Parent;
+        FVector ParentPosition = FVector::ZeroVector;
+        float ParentCost = 0.0f;
+        if (ParentLeaf != INDEX_NONE)
+        {
+            const FSearchNode& Parent = Visited.FindChecked(ParentLeaf);
+            ParentPosition = Parent.Position;
+            ParentCost = Parent.Cost;
+        }
+
+        Neighbors.Reset();
+        GatherFreeLeaves(Nodes[Entry.Leaf].Bounds.ExpandBy(NeighborSlack), Neighbors);
+
+        for (const int32 Neighbor : Neighbors)
+        {
+            if (Neighbor == Entry.Leaf)
+            {
+                continue;
+            }
+
+            const FSearchNode* Existing = Visited.Find(Neighbor);
+            if (Existing && Existing->bClosed)
+            {
+                continue;
+            }
+
+            const FVector NeighborPosition = GetPosition(Neighbor);
+
+            // Theta*: link straight from the parent when it can see the neighbor
+            int32 Via = Entry.Leaf;
+            FVector ViaPosition = CurrentPosition;
+            float ViaCost = CurrentCost;
+            if (ParentLeaf != INDEX_NONE && IsSegmentClear(ParentPosition, NeighborPosition))
+            {
+                Via = ParentLeaf;
+                ViaPosition = ParentPosition;
+                ViaCost = ParentCost;
+            }
+            else if (!IsSegmentClear(CurrentPosition, NeighborPosition))
+            {
+                // Edge/corner neighbors can be separated by a blocked leaf
+                continue;
+            }
+
+            const float NewCost = ViaCost + static_cast<float>(FVector::Dist(ViaPosition, NeighborPosition));
+            if (Existing && NewCost >= Existing->Cost)
+            {
+                continue;
+            }
+
+            FSearchNode& NeighborNode = Visited.FindOrAdd(Neighbor);
+            NeighborNode.Position = NeighborPosition;
+            NeighborNode.Cost = NewCost;
+            NeighborNode.Parent = Via;
+
+            const float Heuristic = static_cast<float>(FVector::Dist(NeighborPosition, GoalPoint));
+            Open.HeapPush(FOpenEntry{ NewCost + Heuristic, Neighbor }, CheapestFirst);
+        }
+    }
+
+    if (!bFound)
+    {
+        return false;
+    }
+
+    for (int32 Leaf = GoalLeaf; Leaf != INDEX_NONE; Leaf = Visited.FindChecked(Leaf).Parent)
+    {
+        OutPath.Add(Visited.FindChecked(Leaf).Position);
+    }
+    Algo::Reverse(OutPath);
+    return true;
+}
+
+void FNavigationOctree::SmoothPath(TArray<FVector>& Path) const
+{
+    if (Path.Num() <= 2)
+    {
+        return;
+    }
+
+    TArray<FVector> Smoothed;
+    Smoothed.Add(Path[0]);
+
+    // From each kept point, jump to the farthest later point it can see
+    int32 Anchor = 0;
+    while (Anchor < Path.Num() - 1)
+    {
+        int32 Next = Anchor + 1;
+        for (int32 Candidate = Path.Num() - 1; Candidate > Anchor + 1; --Candidate)
+        {
+            if (IsSegmentClear(Path[Anchor], Path[Candidate]))
+            {
+                Next = Candidate;
+                break;
+            }
+        }
+
+        Smoothed.Add(Path[Next]);
+        Anchor = Next;
+    }
+
+    Path = MoveTemp(Smoothed);
+}
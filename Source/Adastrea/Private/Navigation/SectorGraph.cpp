@@ -0,0 +1,398 @@
+#include "Navigation/SectorGraph.h"
+#include "Algo/Reverse.h"
+
+namespace SectorGraphHelpers
+{
+    const FIntVector NeighborOffsets[] =
+    {
+        FIntVector(1, 0, 0), FIntVector(-1, 0, 0),
+        FIntVector(0, 1, 0), FIntVector(0, -1, 0),
+        FIntVector(0, 0, 1), FIntVector(0, 0, -1)
+    };
+
+    constexpr float Unreachable = TNumericLimits<float>::Max();
+}
+
+int32 FSectorGraph::AddSector(ASpaceSectorMap* Sector, const FIntVector& GridCoordinates, const FVector& Center)
+{
+    if (!Sector)
+    {
+        return INDEX_NONE;
+    }
+
+    int32 NodeIndex = FindNode(Sector);
+    if (NodeIndex != INDEX_NONE)
+    {
+        FNode& Node = Nodes[NodeIndex];
+        if (Node.Coordinates == GridCoordinates && Node.Center == Center)
+        {
+            return NodeIndex;
+        }
+
+        if (Node.Coordinates != GridCoordinates)
+        {
+            ReleaseCoordinates(Node.Coordinates, NodeIndex);
+            ClaimCoordinates(GridCoordinates, NodeIndex);
+            Node.Coordinates = GridCoordinates;
+        }
+        Node.Center = Center;
+    }
+    else
+    {
+        NodeIndex = Nodes.Num();
+        FNode& Node = Nodes.AddDefaulted_GetRef();
+        Node.Sector = Sector;
+        Node.Coordinates = GridCoordinates;
+        Node.Center = Center;
+        NodeBySector.Add(Sector, NodeIndex);
+        ClaimCoordinates(GridCoordinates, NodeIndex);
+    }
+
+    bEdgesDirty = true;
+    bNextHopsDirty = true;
+    return NodeIndex;
+}
+
+bool FSectorGraph::RemoveSector(const ASpaceSectorMap* Sector)
+{
+    int32 NodeIndex = INDEX_NONE;
+    if (!NodeBySector.RemoveAndCopyValue(Sector, NodeIndex))
+    {
+        return false;
+    }
+
+    ReleaseCoordinates(Nodes[NodeIndex].Coordinates, NodeIndex);
+
+    // Swap the last node into the gap so IDs stay dense
+    const int32 LastIndex = Nodes.Num() - 1;
+    Nodes.RemoveAtSwap(NodeIndex, 1, EAllowShrinking::No);
+    if (NodeIndex != LastIndex)
+    {
+        const FNode& Moved = Nodes[NodeIndex];
+        NodeBySector.Add(Moved.Sector, NodeIndex);
+
+        int32* MovedCoordinateNode = NodeByCoordinates.Find(Moved.Coordinates);
+        if (MovedCoordinateNode && *MovedCoordinateNode == LastIndex)
+        {
+            *MovedCoordinateNode = NodeIndex;
+        }
+    }
+
+    bEdgesDirty = true;
+    bNextHopsDirty = true;
+    return true;
+}
+
+void FSectorGraph::Reset()
+{
+    Nodes.Reset();
+    NodeBySector.Reset();
+    NodeByCoordinates.Reset();
+    CoordinateCounts.Reset();
+    EdgeOffsets.Reset();
+    EdgeTargets.Reset();
+    EdgeCosts.Reset();
+    NextHops.Reset();
+    bEdgesDirty = false;
+    bNextHopsDirty = false;
+}
+
+int32 FSectorGraph::FindNode(const ASpaceSectorMap* Sector) const
+{
+    const int32* NodeIndex = NodeBySector.Find(Sector);
+    return NodeIndex ? *NodeIndex : INDEX_NONE;
+}
+
+int32 FSectorGraph::FindNodeAt(const FIntVector& GridCoordinates) const
+{
+    const int32* NodeIndex = NodeByCoordinates.Find(GridCoordinates);
+    return NodeIndex ? *NodeIndex : INDEX_NONE;
+}
+
+void FSectorGraph::ClaimCoordinates(const FIntVector& Coordinates, int32 NodeIndex)
+{
+    ++CoordinateCounts.FindOrAdd(Coordinates, 0);
+    NodeByCoordinates.FindOrAdd(Coordinates, NodeIndex);
+}
+
+void FSectorGraph::ReleaseCoordinates(const FIntVector& Coordinates, int32 NodeIndex)
+{
+    int32* Count = CoordinateCounts.Find(Coordinates);
+    if (!Count)
+    {
+        return;
+    }
+
+    if (--(*Count) == 0)
+    {
+        CoordinateCounts.Remove(Coordinates);
+        NodeByCoordinates.Remove(Coordinates);
+        return;
+    }
+
+    // Another sector shares the coordinate; hand it over only if this node owned it
+    int32* CoordinateNode = NodeByCoordinates.Find(Coordinates);
+    if (!CoordinateNode || *CoordinateNode != NodeIndex)
+    {
+        return;
+    }
+
+    for (int32 OtherIndex = 0; OtherIndex < Nodes.Num(); ++OtherIndex)
+    {
+        if (OtherIndex != NodeIndex && Nodes[OtherIndex].Coordinates == Coordinates)
+        {
+            *CoordinateNode = OtherIndex;
+            return;
+        }
+    }
+}
+
+TConstArrayView<int32> FSectorGraph::GetNeighbors(int32 Node) const
+{
+    UpdateIfDirty();
+
+    const int32 First = EdgeOffsets[Node];
+    return MakeArrayView(EdgeTargets.GetData() + First, EdgeOffsets[Node + 1] - First);
+}
+
+void FSectorGraph::SetNextHopTableEnabled(bool bEnabled)
+{
+    bNextHopTableEnabled = bEnabled;
+    bNextHopsDirty = true;
+    if (!bEnabled)
+    {
+        NextHops.Empty();
+    }
+}
+
+void FSectorGraph::UpdateIfDirty() const
+{
+    if (bEdgesDirty)
+    {
+        RebuildEdges();
+        bEdgesDirty = false;
+    }
+}
+
+void FSectorGraph::UpdateNextHopsIfDirty() const
+{
+    UpdateIfDirty();
+
+    if (bNextHopsDirty && UsesNextHopTable())
+    {
+        RebuildNextHops();
+        bNextHopsDirty = false;
+    }
+}
+
+void FSectorGraph::RebuildEdges() const
+{
+    const int32 NumNodes = Nodes.Num();
+    EdgeOffsets.SetNumUninitialized(NumNodes + 1);
+    EdgeTargets.Reset(NumNodes * 6);
+    EdgeCosts.Reset(NumNodes * 6);
+
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        EdgeOffsets[NodeIndex] = EdgeTargets.Num();
+
+        const FNode& Node = Nodes[NodeIndex];
+        for (const FIntVector& Offset : SectorGraphHelpers::NeighborOffsets)
+        {
+            const int32* Neighbor = NodeByCoordinates.Find(Node.Coordinates + Offset);
+            if (Neighbor && *Neighbor != NodeIndex)
+            {
+                EdgeTargets.Add(*Neighbor);
+                EdgeCosts.Add(static_cast<float>(FVector::Dist(Node.Center, Nodes[*Neighbor].Center)));
+            }
+        }
+    }
+
+    EdgeOffsets[NumNodes] = EdgeTargets.Num();
+}
+
+bool FSectorGraph::FindPath(int32 Start, int32 Goal, TArray<int32>& OutPath) const
+{
+    OutPath.Reset();
+    if (!Nodes.IsValidIndex(Start) || !Nodes.IsValidIndex(Goal))
+    {
+        return false;
+    }
+    if (Start == Goal)
+    {
+        OutPath.Add(Start);
+        return true;
+    }
+
+    UpdateIfDirty();
+
+    const FVector GoalCenter = Nodes[Goal].Center;
+    auto Heuristic = [this, &GoalCenter](int32 Node)
+    {
+        return static_cast<float>(FVector::Dist(Nodes[Node].Center, GoalCenter));
+    };
+    auto CheapestFirst = [](const FOpenEntry& A, const FOpenEntry& B)
+    {
+        return A.Cost < B.Cost;
+    };
+
+    ScratchCosts.Init(SectorGraphHelpers::Unreachable, Nodes.Num());
+    ScratchParents.Init(INDEX_NONE, Nodes.Num());
+    ScratchOpen.Reset();
+
+    ScratchCosts[Start] = 0.0f;
+    ScratchOpen.HeapPush(FOpenEntry{ Heuristic(Start), Start }, CheapestFirst);
+
+    bool bFound = false;
+    while (ScratchOpen.Num() > 0)
+    {
+        FOpenEntry Entry;
+        ScratchOpen.HeapPop(Entry, CheapestFirst, EAllowShrinking::No);
+
+        const int32 Current = Entry.Node;
+        if (Current == Goal)
+        {
+            bFound = true;
+            break;
+        }
+
+        // Skip entries superseded by a cheaper push (the heap keeps stale copies)
+        const float CurrentCost = ScratchCosts[Current];
+        if (Entry.Cost > CurrentCost + Heuristic(Current))
+        {
+            continue;
+        }
+
+        for (int32 Edge = EdgeOffsets[Current]; Edge < EdgeOffsets[Current + 1]; ++Edge)
+        {
+            const int32 Neighbor = EdgeTargets[Edge];
+            const float NewCost = CurrentCost + EdgeCosts[Edge];
+            if (NewCost < ScratchCosts[Neighbor])
+            {
+                ScratchCosts[Neighbor] = NewCost;
+                ScratchParents[Neighbor] = Current;
+                ScratchOpen.HeapPush(FOpenEntry{ NewCost + Heuristic(Neighbor), Neighbor }, CheapestFirst);
+            }
+        }
+    }
+
+    if (!bFound)
+    {
+        return false;
+    }
+
+    for (int32 Node = Goal; Node != INDEX_NONE; Node = ScratchParents[Node])
+    {
+        OutPath.Add(Node);
+    }
+    Algo::Reverse(OutPath);
+    return true;
+}
+
+void FSectorGraph::ComputeDistancesFrom(int32 Source, TArray<float>& OutDistances) const
+{
+    if (!Nodes.IsValidIndex(Source))
+    {
+        OutDistances.Init(SectorGraphHelpers::Unreachable, Nodes.Num());
+        return;
+    }
+
+    UpdateIfDirty();
+    RunDijkstra(Source, OutDistances, ScratchParents);
+}
+
+void FSectorGraph::RunDijkstra(int32 Source, TArray<float>& OutDistances, TArray<int32>& OutParents) const
+{
+    auto CheapestFirst = [](const FOpenEntry& A, const FOpenEntry& B)
+    {
+        return A.Cost < B.Cost;
+    };
+
+    OutDistances.Init(SectorGraphHelpers::Unreachable, Nodes.Num());
+    OutParents.Init(INDEX_NONE, Nodes.Num());
+    ScratchOpen.Reset();
+
+    OutDistances[Source] = 0.0f;
+    ScratchOpen.HeapPush(FOpenEntry{ 0.0f, Source }, CheapestFirst);
+
+    while (ScratchOpen.Num() > 0)
+    {
+        FOpenEntry Entry;
+        ScratchOpen.HeapPop(Entry, CheapestFirst, EAllowShrinking::No);
+
+        const int32 Current = Entry.Node;
+        if (Entry.Cost > OutDistances[Current])
+        {
+            continue;
+        }
+
+        for (int32 Edge = EdgeOffsets[Current]; Edge < EdgeOffsets[Current + 1]; ++Edge)
+        {
+            const int32 Neighbor = EdgeTargets[Edge];
+            const float NewCost = Entry.Cost + EdgeCosts[Edge];
+            if (NewCost < OutDistances[Neighbor])
+            {
+                OutDistances[Neighbor] = NewCost;
+                OutParents[Neighbor] = Current;
+                ScratchOpen.HeapPush(FOpenEntry{ NewCost, Neighbor }, CheapestFirst);
+            }
+        }
+    }
+}
+
+void FSectorGraph::RebuildNextHops() const
+{
+    const int32 NumNodes = Nodes.Num();
+    NextHops.Init(INDEX_NONE, NumNodes * NumNodes);
+
+    // Sector edges are symmetric, so a shortest-path tree rooted at the
+    // destination gives every source's first step toward it as its parent
+    TArray<float> Distances;
+    TArray<int32> Parents;
+    for (int32 Destination = 0; Destination < NumNodes; ++Destination)
+    {
+        RunDijkstra(Destination, Distances, Parents);
+
+        for (int32 Source = 0; Source < NumNodes; ++Source)
+        {
+            NextHops[Source * NumNodes + Destination] = Source == Destination ? Destination : Parents[Source];
+        }
+    }
+}
+
+int32 FSectorGraph::GetNextHop(int32 From, int32 To) const
+{
+    if (!Nodes.IsValidIndex(From) || !Nodes.IsValidIndex(To))
+    {
+        return INDEX_NONE;
+    }
+    if (From == To)
+    {
+        return To;
+    }
+
+    // Only hop lookups pay for the all-pairs table; neighbor and distance queries just need edges
+    UpdateNextHopsIfDirty();
+
+    if (UsesNextHopTable())
+    {
+        return NextHops[From * Nodes.Num() + To];
+    }
+
+    TArray<int32> Path;
+    return FindPath(From, To, Path) ? Path[1] : INDEX_NONE;
+}
+
+SIZE_T FSectorGraph::GetAllocatedSize() const
+{
+    return Nodes.GetAllocatedSize()
+        + NodeBySector.GetAllocatedSize()
+        + NodeByCoordinates.GetAllocatedSize()
+        + EdgeOffsets.GetAllocatedSize()
+        + EdgeTargets.GetAllocatedSize()
+        + EdgeCosts.GetAllocatedSize()
+        + NextHops.GetAllocatedSize()
+        + ScratchCosts.GetAllocatedSize()
+        + ScratchParents.GetAllocatedSize()
+        + ScratchOpen.GetAllocatedSize();
+}
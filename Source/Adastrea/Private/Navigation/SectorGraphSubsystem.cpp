@@ -0,0 +1,214 @@
+#include "Navigation/SectorGraphSubsystem.h"
+#include "SpaceSectorMap.h"
+#include "EngineUtils.h"
+
+bool USectorGraphSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    // Editor worlds too: sector validation and map widgets use the registry while placing sectors
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE || WorldType == EWorldType::Editor;
+}
+
+void USectorGraphSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Before any sector's BeginPlay, so the first ValidateSectorConfiguration sees every sector
+    SeedIfNeeded();
+}
+
+void USectorGraphSubsystem::Deinitialize()
+{
+    Graph.Reset();
+    Sectors.Empty();
+    SectorRecords.Empty();
+    SectorsByCell.Empty();
+
+    Super::Deinitialize();
+}
+
+void USectorGraphSubsystem::SeedIfNeeded() const
+{
+    if (bSeeded)
+    {
+        return;
+    }
+
+    // Cast away const to fill the registry on first use, like ASpaceSectorMap's neighbor cache
+    USectorGraphSubsystem* MutableThis = const_cast<USectorGraphSubsystem*>(this);
+    MutableThis->bSeeded = true;
+
+    if (UWorld* World = GetWorld())
+    {
+        for (TActorIterator<ASpaceSectorMap> It(World); It; ++It)
+        {
+            MutableThis->RegisterSector(*It);
+        }
+    }
+}
+
+void USectorGraphSubsystem::RegisterSector(ASpaceSectorMap* Sector)
+{
+    if (!IsValid(Sector))
+    {
+        return;
+    }
+
+    const FIntVector Coordinates = Sector->GetGridCoordinates();
+
+    const FVector Center = Sector->GetSectorCenter();
+
+    if (FSectorRecord* Record = SectorRecords.Find(Sector))
+    {
+        // Re-registration after a move: only the cell and graph node change
+        if (Record->Coordinates == Coordinates && Record->Center == Center)
+        {
+            return;
+        }
+
+        RemoveFromCell(Sector, Record->Coordinates);
+        AddToCell(Sector, Coordinates);
+        Record->Coordinates = Coordinates;
+        Record->Center = Center;
+    }
+    else
+    {
+        FSectorRecord& NewRecord = SectorRecords.Add(Sector);
+        NewRecord.Coordinates = Coordinates;
+        NewRecord.Center = Center;
+        NewRecord.Index = Sectors.Add(Sector);
+        AddToCell(Sector, Coordinates);
+    }
+
+    Graph.AddSector(Sector, Coordinates, Center);
+    ++RegistryVersion;
+}
+
+void USectorGraphSubsystem::UnregisterSector(ASpaceSectorMap* Sector)
+{
+    FSectorRecord Record;
+    if (!SectorRecords.RemoveAndCopyValue(Sector, Record))
+    {
+        return;
+    }
+
+    RemoveFromCell(Sector, Record.Coordinates);
+
+    Sectors.RemoveAtSwap(Record.Index, 1, EAllowShrinking::No);
+    if (Sectors.IsValidIndex(Record.Index))
+    {
+        SectorRecords.FindChecked(Sectors[Record.Index]).Index = Record.Index;
+    }
+
+    Graph.RemoveSector(Sector);
+    ++RegistryVersion;
+}
+
+void USectorGraphSubsystem::AddToCell(ASpaceSectorMap* Sector, const FIntVector& Coordinates)
+{
+    SectorsByCell.FindOrAdd(Coordinates).Add(Sector);
+}
+
+void USectorGraphSubsystem::RemoveFromCell(ASpaceSectorMap* Sector, const FIntVector& Coordinates)
+{
+    if (TArray<ASpaceSectorMap*, TInlineAllocator<1>>* CellSectors = SectorsByCell.Find(Coordinates))
+    {
+        CellSectors->Remove(Sector);
+        if (CellSectors->Num() == 0)
+        {
+            SectorsByCell.Remove(Coordinates);
+        }
+    }
+}
+
+int32 USectorGraphSubsystem::GetSectorCount() const
+{
+    SeedIfNeeded();
+    return Sectors.Num();
+}
+
+TArray<ASpaceSectorMap*> USectorGraphSubsystem::GetAllSectors() const
+{
+    SeedIfNeeded();
+    return TArray<ASpaceSectorMap*>(Sectors);
+}
+
+ASpaceSectorMap* USectorGraphSubsystem::FindSectorAt(const FIntVector& GridCoordinates) const
+{
+    SeedIfNeeded();
+
+    const TArray<ASpaceSectorMap*, TInlineAllocator<1>>* CellSectors = SectorsByCell.Find(GridCoordinates);
+    return CellSectors ? (*CellSectors)[0] : nullptr;
+}
+
+TArray<ASpaceSectorMap*> USectorGraphSubsystem::GetAdjacentSectors(const ASpaceSectorMap* Sector) const
+{
+    TArray<ASpaceSectorMap*> Adjacent;
+    if (!Sector)
+    {
+        return Adjacent;
+    }
+
+    SeedIfNeeded();
+
+    static const FIntVector Offsets[] =
+    {
+        FIntVector(1, 0, 0), FIntVector(-1, 0, 0),
+        FIntVector(0, 1, 0), FIntVector(0, -1, 0),
+        FIntVector(0, 0, 1), FIntVector(0, 0, -1)
+    };
+
+    const FIntVector Coordinates = Sector->GetGridCoordinates();
+    for (const FIntVector& Offset : Offsets)
+    {
+        if (const TArray<ASpaceSectorMap*, TInlineAllocator<1>>* CellSectors = SectorsByCell.Find(Coordinates + Offset))
+        {
+            Adjacent.Append(*CellSectors);
+        }
+    }
+    return Adjacent;
+}
+
+void USectorGraphSubsystem::GetSectorsNear(const FIntVector& GridCoordinates, int32 CellRange, TArray<ASpaceSectorMap*>& OutSectors) const
+{
+    SeedIfNeeded();
+
+    for (int32 X = -CellRange; X <= CellRange; ++X)
+    {
+        for (int32 Y = -CellRange; Y <= CellRange; ++Y)
+        {
+            for (int32 Z = -CellRange; Z <= CellRange; ++Z)
+            {
+                if (const TArray<ASpaceSectorMap*, TInlineAllocator<1>>* CellSectors = SectorsByCell.Find(GridCoordinates + FIntVector(X, Y, Z)))
+                {
+                    OutSectors.Append(*CellSectors);
+                }
+            }
+        }
+    }
+}
+
+TArray<ASpaceSectorMap*> USectorGraphSubsystem::FindSectorPath(ASpaceSectorMap* StartSector, ASpaceSectorMap* EndSector) const
+{
+    TArray<ASpaceSectorMap*> Path;
+
+    SeedIfNeeded();
+
+    TArray<int32> Nodes;
+    if (Graph.FindPath(Graph.FindNode(StartSector), Graph.FindNode(EndSector), Nodes))
+    {
+        Path.Reserve(Nodes.Num());
+        for (const int32 Node : Nodes)
+        {
+            Path.Add(Graph.GetSector(Node));
+        }
+    }
+    return Path;
+}
+
+ASpaceSectorMap* USectorGraphSubsystem::GetNextSector(ASpaceSectorMap* FromSector, ASpaceSectorMap* Destination) const
+{
+    SeedIfNeeded();
+
+    const int32 NextNode = Graph.GetNextHop(Graph.FindNode(FromSector), Graph.FindNode(Destination));
+    return NextNode != INDEX_NONE ? Graph.GetSector(NextNode) : nullptr;
+}
@@ -0,0 +1,150 @@
+#include "Navigation/SpaceNavigationSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Async/Async.h"
+#include "Tasks/Task.h"
+#include "AdastreaLog.h"
+
+bool USpaceNavigationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USpaceNavigationSubsystem::Deinitialize()
+{
+    Obstacles.Empty();
+    Octree.Reset();
+
+    // A running build owns its tree and boxes, so it can finish on its own
+    PendingOctree.Reset();
+    PendingBuild = UE::Tasks::FTask();
+
+    Super::Deinitialize();
+}
+
+void USpaceNavigationSubsystem::RegisterObstacle(AActor* Obstacle)
+{
+    if (IsValid(Obstacle) && !Obstacles.Contains(Obstacle))
+    {
+        Obstacles.Add(Obstacle);
+        bOctreeDirty = true;
+    }
+}
+
+void USpaceNavigationSubsystem::UnregisterObstacle(AActor* Obstacle)
+{
+    if (Obstacles.RemoveSwap(Obstacle, EAllowShrinking::No) > 0)
+    {
+        bOctreeDirty = true;
+    }
+}
+
+void USpaceNavigationSubsystem::SetBuildSettings(float InMinLeafSize, float InObstacleClearance)
+{
+    MinLeafSize = FMath::Max(InMinLeafSize, 100.0f);
+    ObstacleClearance = FMath::Max(InObstacleClearance, 0.0f);
+    bOctreeDirty = true;
+}
+
+TSharedRef<const FNavigationOctree, ESPMode::ThreadSafe> USpaceNavigationSubsystem::GetOctree()
+{
+    UpdateOctree();
+
+    if (!Octree.IsValid())
+    {
+        // No older tree to answer with, so the first build has to finish here
+        PendingBuild.Wait();
+        UpdateOctree();
+    }
+    return Octree.ToSharedRef();
+}
+
+void USpaceNavigationSubsystem::UpdateOctree()
+{
+    if (PendingBuild.IsValid() && PendingBuild.IsCompleted())
+    {
+        Octree = MoveTemp(PendingOctree);
+        PendingBuild = UE::Tasks::FTask();
+    }
+
+    if ((bOctreeDirty || !Octree.IsValid()) && !PendingBuild.IsValid())
+    {
+        StartOctreeBuild();
+    }
+}
+
+void USpaceNavigationSubsystem::StartOctreeBuild()
+{
+    bOctreeDirty = false;
+
+    // Actor bounds can only be read here; the worker gets plain boxes
+    TArray<FBox> Boxes;
+    TArray<AActor*> AttachedActors;
+    for (const AActor* Obstacle : Obstacles)
+    {
+        if (!IsValid(Obstacle))
+        {
+            continue;
+        }
+
+        // One box per actor (station core, each module) keeps gaps between modules navigable
+        AttachedActors.Reset();
+        Obstacle->GetAttachedActors(AttachedActors, true, true);
+        AttachedActors.Add(const_cast<AActor*>(Obstacle));
+
+        for (const AActor* Part : AttachedActors)
+        {
+            const FBox Bounds = Part->GetComponentsBoundingBox(false, true);
+            if (Bounds.IsValid)
+            {
+                Boxes.Add(Bounds.ExpandBy(ObstacleClearance));
+            }
+        }
+    }
+
+    PendingOctree = MakeShared<FNavigationOctree, ESPMode::ThreadSafe>();
+    PendingBuild = UE::Tasks::Launch(UE_SOURCE_LOCATION, [NewOctree = PendingOctree.ToSharedRef(), Boxes = MoveTemp(Boxes), LeafSize = MinLeafSize]()
+    {
+        NewOctree->Build(Boxes, LeafSize);
+
+        UE_LOG(LogAdastreaNavigation, Log, TEXT("SpaceNavigationSubsystem: Built navigation octree from %d boxes (%d nodes, %.1f KB)"),
+            Boxes.Num(), NewOctree->GetNodeCount(), static_cast<float>(NewOctree->GetAllocatedSize()) / 1024.0f);
+    });
+}
+
+bool USpaceNavigationSubsystem::IsSegmentClear(const FVector& Start, const FVector& End)
+{
+    return GetOctree()->IsSegmentClear(Start, End);
+}
+
+bool USpaceNavigationSubsystem::FindPath(const FVector& Start, const FVector& End, TArray<FVector>& OutPath)
+{
+    return GetOctree()->FindPath(Start, End, OutPath);
+}
+
+void USpaceNavigationSubsystem::RequestPathAsync(const FVector& Start, const FVector& End, FPathQueryCallback&& OnComplete)
+{
+    // Query the newest built tree; before the first build finishes, queue behind it instead of waiting
+    UpdateOctree();
+    const bool bWaitForBuild = !Octree.IsValid();
+    TSharedRef<const FNavigationOctree, ESPMode::ThreadSafe> QueryOctree = bWaitForBuild ? PendingOctree.ToSharedRef() : Octree.ToSharedRef();
+
+    auto Query = [QueryOctree, Start, End, OnComplete = MoveTemp(OnComplete)]() mutable
+    {
+        TArray<FVector> Path;
+        const bool bPathFound = QueryOctree->FindPath(Start, End, Path);
+
+        AsyncTask(ENamedThreads::GameThread, [bPathFound, Path = MoveTemp(Path), OnComplete = MoveTemp(OnComplete)]() mutable
+        {
+            OnComplete(bPathFound, MoveTemp(Path));
+        });
+    };
+
+    if (bWaitForBuild)
+    {
+        UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Query), UE::Tasks::Prerequisites(PendingBuild));
+    }
+    else
+    {
+        UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Query));
+    }
+}
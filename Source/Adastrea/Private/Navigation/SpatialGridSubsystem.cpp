@@ -0,0 +1,132 @@
+#include "Navigation/SpatialGridSubsystem.h"
+#include "Ships/Spaceship.h"
+#include "Stations/SpaceStation.h"
+#include "Stations/SpaceStationModule.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+bool USpatialGridSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USpatialGridSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // These register on BeginPlay and unregister on EndPlay
+    AddTrackedClass(ASpaceship::StaticClass());
+    AddTrackedClass(ASpaceStation::StaticClass());
+    AddTrackedClass(ASpaceStationModule::StaticClass());
+}
+
+void USpatialGridSubsystem::Deinitialize()
+{
+    for (const auto& Handle : TransformHandles)
+    {
+        if (USceneComponent* Root = Handle.Value.Key.Get())
+        {
+            Root->TransformUpdated.Remove(Handle.Value.Value);
+        }
+    }
+    TransformHandles.Empty();
+    TrackedClasses.Empty();
+    Grid.Reset();
+
+    Super::Deinitialize();
+}
+
+void USpatialGridSubsystem::RegisterActor(AActor* Actor)
+{
+    if (!IsValid(Actor) || Grid.Contains(Actor))
+    {
+        return;
+    }
+
+    Grid.Update(Actor, Actor->GetActorLocation());
+
+    if (USceneComponent* Root = Actor->GetRootComponent())
+    {
+        const FDelegateHandle Handle = Root->TransformUpdated.AddUObject(this, &USpatialGridSubsystem::HandleTransformUpdated);
+        TransformHandles.Add(Actor, TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>(Root, Handle));
+    }
+}
+
+void USpatialGridSubsystem::AddTrackedClass(TSubclassOf<AActor> ActorClass)
+{
+    if (ActorClass)
+    {
+        TrackedClasses.AddUnique(ActorClass);
+    }
+}
+
+bool USpatialGridSubsystem::IsTrackedClass(TSubclassOf<AActor> ActorClass) const
+{
+    if (!ActorClass)
+    {
+        return false;
+    }
+
+    for (const TSubclassOf<AActor>& TrackedClass : TrackedClasses)
+    {
+        if (ActorClass->IsChildOf(TrackedClass))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void USpatialGridSubsystem::UnregisterActor(AActor* Actor)
+{
+    if (!Actor)
+    {
+        return;
+    }
+
+    Grid.Remove(Actor);
+
+    TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle> Subscription;
+    if (TransformHandles.RemoveAndCopyValue(Actor, Subscription))
+    {
+        if (USceneComponent* Root = Subscription.Key.Get())
+        {
+            Root->TransformUpdated.Remove(Subscription.Value);
+        }
+    }
+}
+
+TArray<AActor*> USpatialGridSubsystem::GetActorsInBox(const FBox& Box, TSubclassOf<AActor> ActorClass) const
+{
+    TArray<AActor*> Actors;
+    Grid.QueryBox(Box, ActorClass, Actors);
+    return Actors;
+}
+
+int32 USpatialGridSubsystem::CountActorsInBox(const FBox& Box, TSubclassOf<AActor> ActorClass) const
+{
+    return Grid.CountInBox(Box, ActorClass);
+}
+
+TArray<AActor*> USpatialGridSubsystem::GetActorsInRadius(const FVector& Center, float Radius, TSubclassOf<AActor> ActorClass) const
+{
+    TArray<AActor*> Actors;
+    Grid.QueryRadius(Center, Radius, ActorClass, Actors);
+    return Actors;
+}
+
+TArray<AActor*> USpatialGridSubsystem::GetNearestActors(const FVector& Location, int32 Count, TSubclassOf<AActor> ActorClass, float MaxDistance) const
+{
+    TArray<AActor*> Actors;
+    Grid.QueryNearest(Location, Count, ActorClass, Actors, MaxDistance);
+    return Actors;
+}
+
+void USpatialGridSubsystem::HandleTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateFlags, ETeleportType Teleport)
+{
+    AActor* Owner = Component ? Component->GetOwner() : nullptr;
+    if (Owner && Component == Owner->GetRootComponent())
+    {
+        Grid.Update(Owner, Component->GetComponentLocation());
+    }
+}
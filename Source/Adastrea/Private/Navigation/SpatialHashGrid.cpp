@@ -0,0 +1,368 @@
+#include "Navigation/SpatialHashGrid.h"
+#include "GameFramework/Actor.h"
+
+FSpatialHashGrid::FSpatialHashGrid(float InCellSize)
+    : CellSize(FMath::Max(InCellSize, 1.0f))
+    , InvCellSize(1.0f / FMath::Max(InCellSize, 1.0f))
+{
+}
+
+void FSpatialHashGrid::SetCellSize(float InCellSize)
+{
+    CellSize = FMath::Max(InCellSize, 1.0f);
+    InvCellSize = 1.0f / CellSize;
+
+    Cells.Reset();
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        Entries[Index].Cell = GetCell(Entries[Index].Location);
+        AddToCell(Index);
+    }
+}
+
+void FSpatialHashGrid::Update(AActor* Actor, const FVector& Location)
+{
+    if (!Actor)
+    {
+        return;
+    }
+
+    const FIntVector Cell = GetCell(Location);
+    if (const int32* Existing = EntryByActor.Find(Actor))
+    {
+        FEntry& Entry = Entries[*Existing];
+        Entry.Location = Location;
+        if (Entry.Cell != Cell)
+        {
+            RemoveFromCell(*Existing);
+            Entry.Cell = Cell;
+            AddToCell(*Existing);
+        }
+        return;
+    }
+
+    const int32 Index = Entries.AddDefaulted();
+    Entries[Index].Actor = Actor;
+    Entries[Index].Location = Location;
+    Entries[Index].Cell = Cell;
+    EntryByActor.Add(Actor, Index);
+    AddToCell(Index);
+}
+
+bool FSpatialHashGrid::Remove(const AActor* Actor)
+{
+    int32 Index = INDEX_NONE;
+    if (!EntryByActor.RemoveAndCopyValue(Actor, Index))
+    {
+        return false;
+    }
+
+    RemoveFromCell(Index);
+
+    // Move the last entry into the gap and repoint its cell slot and map entry
+    const int32 LastIndex = Entries.Num() - 1;
+    if (Index != LastIndex)
+    {
+        Entries[Index] = Entries[LastIndex];
+        const FEntry& Moved = Entries[Index];
+        Cells.FindChecked(Moved.Cell)[Moved.IndexInCell] = Index;
+        EntryByActor[Moved.Actor] = Index;
+    }
+    Entries.RemoveAt(LastIndex, 1, EAllowShrinking::No);
+    return true;
+}
+
+void FSpatialHashGrid::Reset()
+{
+    Entries.Reset();
+    EntryByActor.Reset();
+    Cells.Reset();
+}
+
+FIntVector FSpatialHashGrid::GetCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt32(Location.X * InvCellSize),
+        FMath::FloorToInt32(Location.Y * InvCellSize),
+        FMath::FloorToInt32(Location.Z * InvCellSize));
+}
+
+void FSpatialHashGrid::QueryBox(const FBox& Box, UClass* Class, TArray<AActor*>& OutActors) const
+{
+    OutActors.Reset();
+    ForEachCellInBox(Box, [this, &Box, Class, &OutActors](const TArray<int32>& CellEntries, bool bFullyInside)
+    {
+        for (const int32 Index : CellEntries)
+        {
+            const FEntry& Entry = Entries[Index];
+            if ((bFullyInside || Box.IsInside(Entry.Location)) && PassesFilter(Entry.Actor, Class))
+            {
+                OutActors.Add(Entry.Actor);
+            }
+        }
+    });
+}
+
+int32 FSpatialHashGrid::CountInBox(const FBox& Box, UClass* Class) const
+{
+    int32 Count = 0;
+    ForEachCellInBox(Box, [this, &Box, Class, &Count](const TArray<int32>& CellEntries, bool bFullyInside)
+    {
+        if (bFullyInside && !Class)
+        {
+            Count += CellEntries.Num();
+            return;
+        }
+
+        for (const int32 Index : CellEntries)
+        {
+            const FEntry& Entry = Entries[Index];
+            if ((bFullyInside || Box.IsInside(Entry.Location)) && PassesFilter(Entry.Actor, Class))
+            {
+                ++Count;
+            }
+        }
+    });
+    return Count;
+}
+
+void FSpatialHashGrid::QueryRadius(const FVector& Center, float Radius, UClass* Class, TArray<AActor*>& OutActors) const
+{
+    OutActors.Reset();
+    if (Radius < 0.0f)
+    {
+        return;
+    }
+
+    const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+    const FBox Bounds(Center - FVector(Radius), Center + FVector(Radius));
+    ForEachCellInBox(Bounds, [this, &Center, RadiusSquared, Class, &OutActors](const TArray<int32>& CellEntries, bool)
+    {
+        for (const int32 Index : CellEntries)
+        {
+            const FEntry& Entry = Entries[Index];
+            if (FVector::DistSquared(Entry.Location, Center) <= RadiusSquared && PassesFilter(Entry.Actor, Class))
+            {
+                OutActors.Add(Entry.Actor);
+            }
+        }
+    });
+}
+
+void FSpatialHashGrid::QueryNearest(const FVector& Location, int32 Count, UClass* Class, TArray<AActor*>& OutActors, float MaxDistance) const
+{
+    OutActors.Reset();
+    if (Count <= 0 || Entries.Num() == 0)
+    {
+        return;
+    }
+
+    // Max-heap on distance holding the best Count candidates so far
+    using FCandidate = TPair<double, int32>;
+    auto FurthestFirst = [](const FCandidate& A, const FCandidate& B) { return A.Key > B.Key; };
+    TArray<FCandidate> Best;
+    Best.Reserve(Count);
+
+    const double MaxDistanceSquared = MaxDistance > 0.0f ? FMath::Square(static_cast<double>(MaxDistance)) : TNumericLimits<double>::Max();
+    auto Consider = [this, &Location, Class, Count, MaxDistanceSquared, &Best, &FurthestFirst](const TArray<int32>& CellEntries)
+    {
+        for (const int32 Index : CellEntries)
+        {
+            const FEntry& Entry = Entries[Index];
+            const double DistanceSquared = FVector::DistSquared(Entry.Location, Location);
+            if (DistanceSquared > MaxDistanceSquared || !PassesFilter(Entry.Actor, Class))
+            {
+                continue;
+            }
+
+            if (Best.Num() < Count)
+            {
+                Best.HeapPush(FCandidate(DistanceSquared, Index), FurthestFirst);
+            }
+            else if (DistanceSquared < Best.HeapTop().Key)
+            {
+                Best.HeapPopDiscard(FurthestFirst, EAllowShrinking::No);
+                Best.HeapPush(FCandidate(DistanceSquared, Index), FurthestFirst);
+            }
+        }
+    };
+
+    auto CanStop = [&Best, Count, MaxDistanceSquared](double LowerBoundSquared)
+    {
+        return LowerBoundSquared > MaxDistanceSquared || (Best.Num() == Count && LowerBoundSquared > Best.HeapTop().Key);
+    };
+
+    // Walk shells of cells around the query cell; every cell in shell R is at least (R - 1) cells away
+    const FIntVector Center = GetCell(Location);
+    int64 ShellCellsVisited = 0;
+    bool bDone = false;
+    int32 Ring = 0;
+    for (; !bDone; ++Ring)
+    {
+        const double LowerBound = FMath::Max(0, Ring - 1) * static_cast<double>(CellSize);
+        if (CanStop(LowerBound * LowerBound))
+        {
+            bDone = true;
+            break;
+        }
+
+        // Once shells would cost more than the occupied cells, finish from a sorted cell list instead
+        const int64 Side = 2 * static_cast<int64>(Ring) + 1;
+        const int64 ShellCells = Ring == 0 ? 1 : Side * Side * Side - (Side - 2) * (Side - 2) * (Side - 2);
+        if (ShellCellsVisited + ShellCells > Cells.Num())
+        {
+            break;
+        }
+        ShellCellsVisited += ShellCells;
+
+        for (int32 X = -Ring; X <= Ring; ++X)
+        {
+            for (int32 Y = -Ring; Y <= Ring; ++Y)
+            {
+                const bool bOnShellXY = FMath::Abs(X) == Ring || FMath::Abs(Y) == Ring;
+                const int32 ZStep = bOnShellXY ? 1 : FMath::Max(1, 2 * Ring);
+                for (int32 Z = -Ring; Z <= Ring; Z += ZStep)
+                {
+                    if (const TArray<int32>* CellEntries = Cells.Find(Center + FIntVector(X, Y, Z)))
+                    {
+                        Consider(*CellEntries);
+                    }
+                }
+            }
+        }
+    }
+
+    if (!bDone)
+    {
+        // Remaining cells outside the visited shells, nearest first
+        TArray<TPair<double, const TArray<int32>*>> Remaining;
+        Remaining.Reserve(Cells.Num());
+        for (const TPair<FIntVector, TArray<int32>>& Cell : Cells)
+        {
+            const FIntVector Offset = Cell.Key - Center;
+            if (FMath::Max3(FMath::Abs(Offset.X), FMath::Abs(Offset.Y), FMath::Abs(Offset.Z)) >= Ring)
+            {
+                Remaining.Emplace(GetCellBounds(Cell.Key).ComputeSquaredDistanceToPoint(Location), &Cell.Value);
+            }
+        }
+        Remaining.Sort([](const TPair<double, const TArray<int32>*>& A, const TPair<double, const TArray<int32>*>& B) { return A.Key < B.Key; });
+
+        for (const TPair<double, const TArray<int32>*>& Cell : Remaining)
+        {
+            if (CanStop(Cell.Key))
+            {
+                break;
+            }
+            Consider(*Cell.Value);
+        }
+    }
+
+    Best.Sort([](const FCandidate& A, const FCandidate& B) { return A.Key < B.Key; });
+    OutActors.Reserve(Best.Num());
+    for (const FCandidate& Candidate : Best)
+    {
+        OutActors.Add(Entries[Candidate.Value].Actor);
+    }
+}
+
+SIZE_T FSpatialHashGrid::GetAllocatedSize() const
+{
+    SIZE_T Size = Entries.GetAllocatedSize() + EntryByActor.GetAllocatedSize() + Cells.GetAllocatedSize();
+    for (const TPair<FIntVector, TArray<int32>>& Cell : Cells)
+    {
+        Size += Cell.Value.GetAllocatedSize();
+    }
+    return Size;
+}
+
+void FSpatialHashGrid::AddToCell(int32 EntryIndex)
+{
+    FEntry& Entry = Entries[EntryIndex];
+    TArray<int32>& CellEntries = Cells.FindOrAdd(Entry.Cell);
+    Entry.IndexInCell = CellEntries.Add(EntryIndex);
+}
+
+void FSpatialHashGrid::RemoveFromCell(int32 EntryIndex)
+{
+    const FEntry& Entry = Entries[EntryIndex];
+    TArray<int32>& CellEntries = Cells.FindChecked(Entry.Cell);
+
+    const int32 LastSlot = CellEntries.Num() - 1;
+    if (Entry.IndexInCell != LastSlot)
+    {
+        const int32 MovedIndex = CellEntries[LastSlot];
+        CellEntries[Entry.IndexInCell] = MovedIndex;
+        Entries[MovedIndex].IndexInCell = Entry.IndexInCell;
+    }
+    CellEntries.RemoveAt(LastSlot, 1, EAllowShrinking::No);
+
+    if (CellEntries.Num() == 0)
+    {
+        Cells.Remove(Entry.Cell);
+    }
+}
+
+FBox FSpatialHashGrid::GetCellBounds(const FIntVector& Cell) const
+{
+    const FVector Min = FVector(Cell) * CellSize;
+    return FBox(Min, Min + FVector(CellSize));
+}
+
+bool FSpatialHashGrid::PassesFilter(const AActor* Actor, UClass* Class)
+{
+    return IsValid(Actor) && (!Class || Actor->IsA(Class));
+}
+
+template<typename VisitorType>
+void FSpatialHashGrid::ForEachCellInBox(const FBox& Box, VisitorType&& Visit) const
+{
+    if (!Box.IsValid || Cells.Num() == 0)
+    {
+        return;
+    }
+
+    const FIntVector MinCell = GetCell(Box.Min);
+    const FIntVector MaxCell = GetCell(Box.Max);
+
+    // Box.IsInside is strict, so a cell [Min, Max) is covered only if it sits strictly past Box.Min
+    auto IsCellInside = [this, &Box](const FIntVector& Cell)
+    {
+        const FBox CellBounds = GetCellBounds(Cell);
+        return CellBounds.Min.X > Box.Min.X && CellBounds.Min.Y > Box.Min.Y && CellBounds.Min.Z > Box.Min.Z
+            && CellBounds.Max.X <= Box.Max.X && CellBounds.Max.Y <= Box.Max.Y && CellBounds.Max.Z <= Box.Max.Z;
+    };
+
+    const int64 SpannedCells = static_cast<int64>(MaxCell.X - MinCell.X + 1)
+        * static_cast<int64>(MaxCell.Y - MinCell.Y + 1)
+        * static_cast<int64>(MaxCell.Z - MinCell.Z + 1);
+
+    if (SpannedCells > Cells.Num())
+    {
+        for (const TPair<FIntVector, TArray<int32>>& Cell : Cells)
+        {
+            const FIntVector& Coords = Cell.Key;
+            if (Coords.X >= MinCell.X && Coords.X <= MaxCell.X
+                && Coords.Y >= MinCell.Y && Coords.Y <= MaxCell.Y
+                && Coords.Z >= MinCell.Z && Coords.Z <= MaxCell.Z)
+            {
+                Visit(Cell.Value, IsCellInside(Coords));
+            }
+        }
+        return;
+    }
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+            {
+                const FIntVector Coords(X, Y, Z);
+                if (const TArray<int32>* CellEntries = Cells.Find(Coords))
+                {
+                    Visit(*CellEntries, IsCellInside(Coords));
+                }
+            }
+        }
+    }
+}
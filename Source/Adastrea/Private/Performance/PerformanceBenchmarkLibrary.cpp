@@ -13,6 +13,129 @@
 #include "Ships/SpaceshipDataAsset.h"
 #include "Stations/SpaceStation.h"
 #include "AI/NPCLogicBase.h"
+#include "Trading/ContractRoutePlanner.h"
+#include "Trading/EconomySimulationBatch.h"
+#include "Trading/MarketDataAsset.h"
+#include "Trading/MarketStateTable.h"
+#include "Trading/TradeArbitrageIndex.h"
+#include "Trading/TradeContractDataAsset.h"
+#include "Trading/TradeItemDataAsset.h"
+#include "UObject/Package.h"
+
+namespace TradingBenchmarkHelpers
+{
+    /** Create rooted transient trade items with varied pricing and replenishment */
+    static TArray<UTradeItemDataAsset*> CreateItems(int32 NumItems)
+    {
+        TArray<UTradeItemDataAsset*> Items;
+        Items.Reserve(NumItems);
+
+        for (int32 i = 0; i < NumItems; ++i)
+        {
+            UTradeItemDataAsset* Item = NewObject<UTradeItemDataAsset>(GetTransientPackage());
+            Item->AddToRoot();
+            Item->ItemID = FName(TEXT("BenchItem"), i + 1);
+            Item->BasePrice = 50.0f + (i % 20) * 25.0f;
+            Item->ReplenishmentRate = 50 + (i % 10) * 25;
+            Items.Add(Item);
+        }
+
+        return Items;
+    }
+
+    /** Create rooted transient markets stocking every item with seeded supply/demand */
+    static TArray<UMarketDataAsset*> CreateMarkets(int32 NumMarkets, const TArray<UTradeItemDataAsset*>& Items, int32 Seed)
+    {
+        FRandomStream Random(Seed);
+        TArray<UMarketDataAsset*> Markets;
+        Markets.Reserve(NumMarkets);
+
+        for (int32 m = 0; m < NumMarkets; ++m)
+        {
+            UMarketDataAsset* Market = NewObject<UMarketDataAsset>(GetTransientPackage());
+            Market->AddToRoot();
+            Market->MarketID = FName(TEXT("BenchMarket"), m + 1);
+            Market->Inventory.Reserve(Items.Num());
+
+            for (UTradeItemDataAsset* Item : Items)
+            {
+                FMarketInventoryEntry Entry;
+                Entry.TradeItem = Item;
+                Entry.MaxStock = 1000;
+                Entry.CurrentStock = Random.RandRange(0, Entry.MaxStock);
+                Entry.SupplyLevel = Random.FRandRange(0.1f, 3.0f);
+                Entry.DemandLevel = Random.FRandRange(0.1f, 3.0f);
+                Market->Inventory.Add(Entry);
+            }
+            Markets.Add(Market);
+        }
+
+        return Markets;
+    }
+
+    /** Build a state table with one row per market, in market order */
+    static void CreateStates(const TArray<UMarketDataAsset*>& Markets, FMarketStateTable& OutStates)
+    {
+        OutStates.Reset();
+        for (const UMarketDataAsset* Market : Markets)
+        {
+            OutStates.AddMarket(Market);
+        }
+    }
+
+    /** Primary instance of each market, in market order (matches CreateStates rows) */
+    static TArray<FMarketInstance> MakeInstances(const TArray<UMarketDataAsset*>& Markets)
+    {
+        TArray<FMarketInstance> Instances;
+        Instances.Reserve(Markets.Num());
+        for (UMarketDataAsset* Market : Markets)
+        {
+            FMarketInstance& Instance = Instances.AddDefaulted_GetRef();
+            Instance.Template = Market;
+            Instance.InstanceID = FMarketStateTable::GetMarketKey(Market);
+        }
+        return Instances;
+    }
+
+    /** Whether two tables hold the same item states row for row */
+    static bool StatesMatch(const FMarketStateTable& A, const FMarketStateTable& B)
+    {
+        if (A.NumRows() != B.NumRows())
+        {
+            return false;
+        }
+
+        for (int32 Row = 0; Row < A.NumRows(); ++Row)
+        {
+            const TConstArrayView<FMarketItemState> ItemsA = A.GetItems(Row);
+            const TConstArrayView<FMarketItemState> ItemsB = B.GetItems(Row);
+            if (ItemsA.Num() != ItemsB.Num())
+            {
+                return false;
+            }
+
+            for (int32 i = 0; i < ItemsA.Num(); ++i)
+            {
+                if (ItemsA[i] != ItemsB[i])
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /** Unroot benchmark objects so the next GC pass collects them */
+    template<typename T>
+    static void ReleaseObjects(TArray<T*>& Objects)
+    {
+        for (T* Object : Objects)
+        {
+            Object->RemoveFromRoot();
+        }
+        Objects.Empty();
+    }
+}
 
 //================================================================================
 // SHIP SPAWNING BENCHMARKS
@@ -324,6 +447,414 @@ FString UPerformanceBenchmarkLibrary::BenchmarkStationSystem(
     return Results;
 }
 
+//================================================================================
+// TRADING SYSTEM BENCHMARKS
+//================================================================================
+
+FString UPerformanceBenchmarkLibrary::BenchmarkEconomySimulation(
+    UObject* WorldContextObject,
+    int32 ItemsPerMarket,
+    int32 Iterations)
+{
+    if (!WorldContextObject || ItemsPerMarket <= 0 || Iterations <= 0)
+    {
+        return TEXT("ERROR: Invalid parameters");
+    }
+
+    FString Results = FString::Printf(TEXT("=== Economy Simulation Benchmark ===\n"));
+    Results += FString::Printf(TEXT("Items per market: %d, Iterations: %d\n\n"), ItemsPerMarket, Iterations);
+
+    // Mirror UEconomyManager defaults (5s update interval at 1x time scale)
+    const float DeltaHours = 5.0f / 60.0f;
+    const float RecoveryAlpha = 0.1f * DeltaHours;
+    const float MinLevel = 0.1f;
+    const float MaxLevel = 3.0f;
+
+    TArray<UTradeItemDataAsset*> Items = TradingBenchmarkHelpers::CreateItems(ItemsPerMarket);
+
+    const int32 EntryCounts[] = { 10000, 100000, 1000000 };
+    for (const int32 EntryCount : EntryCounts)
+    {
+        const int32 NumMarkets = FMath::Max(1, EntryCount / ItemsPerMarket);
+
+        // One template set, two state tables so both paths start from the same state
+        TArray<UMarketDataAsset*> Markets = TradingBenchmarkHelpers::CreateMarkets(NumMarkets, Items, 1337);
+        FMarketStateTable PerEntryStates;
+        FMarketStateTable BatchedStates;
+        TradingBenchmarkHelpers::CreateStates(Markets, PerEntryStates);
+        TradingBenchmarkHelpers::CreateStates(Markets, BatchedStates);
+        const TArray<FMarketInstance> Instances = TradingBenchmarkHelpers::MakeInstances(Markets);
+
+        // Per-entry path (UEconomyManager::UpdateMarketPrices + SimulateBackgroundActivity)
+        const double PerEntryTime = MeasureExecutionTime([&Markets, &PerEntryStates, Iterations, RecoveryAlpha, DeltaHours]() {
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                for (int32 Row = 0; Row < Markets.Num(); ++Row)
+                {
+                    const TArrayView<FMarketItemState> States = PerEntryStates.GetItems(Row);
+                    for (FMarketItemState& State : States)
+                    {
+                        State.SupplyLevel = FMath::Lerp(State.SupplyLevel, 1.0f, RecoveryAlpha);
+                        State.DemandLevel = FMath::Lerp(State.DemandLevel, 1.0f, RecoveryAlpha);
+                    }
+
+                    const TArray<FMarketInventoryEntry>& Entries = Markets[Row]->Inventory;
+                    for (int32 i = 0; i < States.Num(); ++i)
+                    {
+                        if (Entries[i].TradeItem)
+                        {
+                            int32 ReplenishAmount = FMath::RoundToInt(Entries[i].TradeItem->ReplenishmentRate * DeltaHours);
+                            if (ReplenishAmount > 0)
+                            {
+                                States[i].CurrentStock = FMath::Min(States[i].CurrentStock + ReplenishAmount, Entries[i].MaxStock);
+                                States[i].bInStock = States[i].CurrentStock > 0;
+                            }
+                        }
+                    }
+                }
+            }
+        });
+
+        // Batched path (layout build is included in the first iteration)
+        FEconomySimulationBatch Batch;
+        const double BatchedTime = MeasureExecutionTime([&Batch, &Instances, &BatchedStates, Iterations, RecoveryAlpha, MinLevel, MaxLevel, DeltaHours]() {
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                Batch.Gather(Instances, BatchedStates);
+                Batch.Simulate(RecoveryAlpha, MinLevel, MaxLevel, DeltaHours);
+                Batch.Scatter(Instances, BatchedStates, DeltaHours);
+            }
+        });
+
+        // Kernel only, excluding gather/scatter against the state table
+        const double KernelTime = MeasureExecutionTime([&Batch, Iterations, RecoveryAlpha, MinLevel, MaxLevel, DeltaHours]() {
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                Batch.Simulate(RecoveryAlpha, MinLevel, MaxLevel, DeltaHours);
+            }
+        });
+
+        // Verify both paths produced the same market state
+        const bool bResultsMatch = TradingBenchmarkHelpers::StatesMatch(PerEntryStates, BatchedStates);
+
+        const int32 TotalEntries = NumMarkets * ItemsPerMarket;
+        Results += FString::Printf(TEXT("--- %d entries (%d markets) ---\n"), TotalEntries, NumMarkets);
+        Results += FString::Printf(TEXT("Per-entry loop: %s per tick\n"), *FormatDuration(PerEntryTime / Iterations));
+        Results += FString::Printf(TEXT("Batched tick: %s per tick\n"), *FormatDuration(BatchedTime / Iterations));
+        Results += FString::Printf(TEXT("Kernel only: %s per tick\n"), *FormatDuration(KernelTime / Iterations));
+        Results += FString::Printf(TEXT("Speedup: %.2fx\n"), BatchedTime > 0.0 ? PerEntryTime / BatchedTime : 0.0);
+        Results += FString::Printf(TEXT("Results match: %s\n\n"), bResultsMatch ? TEXT("Yes") : TEXT("No"));
+
+        TradingBenchmarkHelpers::ReleaseObjects(Markets);
+    }
+
+    TradingBenchmarkHelpers::ReleaseObjects(Items);
+
+    return Results;
+}
+
+FString UPerformanceBenchmarkLibrary::BenchmarkEconomyCatchUp(
+    UObject* WorldContextObject,
+    int32 NumMarkets,
+    int32 ItemsPerMarket,
+    int32 Days,
+    int32 Seed)
+{
+    if (!WorldContextObject || NumMarkets <= 0 || ItemsPerMarket <= 0 || Days <= 0)
+    {
+        return TEXT("ERROR: Invalid parameters");
+    }
+
+    // Mirror UEconomyManager defaults (5 game minute fixed step)
+    const float StepHours = 5.0f / 60.0f;
+    const float RecoveryAlpha = 0.1f * StepHours;
+    const float MinLevel = 0.1f;
+    const float MaxLevel = 3.0f;
+    const int64 NumSteps = FMath::RoundToInt64(Days * 24.0 / StepHours);
+
+    FString Results = FString::Printf(TEXT("=== Economy Catch-Up Benchmark ===\n"));
+    Results += FString::Printf(TEXT("Markets: %d, Items per market: %d, Days: %d (%lld steps), Seed: %d\n\n"),
+        NumMarkets, ItemsPerMarket, Days, NumSteps, Seed);
+
+    TArray<UTradeItemDataAsset*> Items = TradingBenchmarkHelpers::CreateItems(ItemsPerMarket);
+
+    // One template set, identical state tables: stepped, catch-up, and a second catch-up run for determinism
+    TArray<UMarketDataAsset*> Markets = TradingBenchmarkHelpers::CreateMarkets(NumMarkets, Items, Seed);
+    FMarketStateTable SteppedStates;
+    FMarketStateTable CatchUpStates;
+    FMarketStateTable RepeatStates;
+    TradingBenchmarkHelpers::CreateStates(Markets, SteppedStates);
+    TradingBenchmarkHelpers::CreateStates(Markets, CatchUpStates);
+    TradingBenchmarkHelpers::CreateStates(Markets, RepeatStates);
+    const TArray<FMarketInstance> Instances = TradingBenchmarkHelpers::MakeInstances(Markets);
+
+    // One timer update at a time (gather/simulate/scatter per step)
+    FEconomySimulationBatch SteppedBatch;
+    const double SteppedTime = MeasureExecutionTime([&SteppedBatch, &Instances, &SteppedStates, NumSteps, RecoveryAlpha, MinLevel, MaxLevel, StepHours]() {
+        for (int64 Step = 0; Step < NumSteps; ++Step)
+        {
+            SteppedBatch.Gather(Instances, SteppedStates);
+            SteppedBatch.Simulate(RecoveryAlpha, MinLevel, MaxLevel, StepHours);
+            SteppedBatch.Scatter(Instances, SteppedStates, StepHours);
+        }
+    });
+
+    // Single catch-up batch
+    FEconomySimulationBatch CatchUpBatch;
+    const double CatchUpTime = MeasureExecutionTime([&CatchUpBatch, &Instances, &CatchUpStates, NumSteps, RecoveryAlpha, MinLevel, MaxLevel, StepHours]() {
+        CatchUpBatch.Gather(Instances, CatchUpStates);
+        CatchUpBatch.Simulate(RecoveryAlpha, MinLevel, MaxLevel, StepHours, NumSteps);
+        CatchUpBatch.Scatter(Instances, CatchUpStates, StepHours);
+    });
+
+    FEconomySimulationBatch RepeatBatch;
+    RepeatBatch.Gather(Instances, RepeatStates);
+    RepeatBatch.Simulate(RecoveryAlpha, MinLevel, MaxLevel, StepHours, NumSteps);
+    RepeatBatch.Scatter(Instances, RepeatStates, StepHours);
+
+    Results += FString::Printf(TEXT("Stepped (%lld updates): %s\n"), NumSteps, *FormatDuration(SteppedTime));
+    Results += FString::Printf(TEXT("Catch-up batch: %s\n"), *FormatDuration(CatchUpTime));
+    Results += FString::Printf(TEXT("Speedup: %.2fx\n"), CatchUpTime > 0.0 ? SteppedTime / CatchUpTime : 0.0);
+    Results += FString::Printf(TEXT("Bit-identical to stepped: %s\n"), TradingBenchmarkHelpers::StatesMatch(SteppedStates, CatchUpStates) ? TEXT("Yes") : TEXT("No"));
+    Results += FString::Printf(TEXT("Deterministic across runs: %s\n"), TradingBenchmarkHelpers::StatesMatch(CatchUpStates, RepeatStates) ? TEXT("Yes") : TEXT("No"));
+
+    TradingBenchmarkHelpers::ReleaseObjects(Markets);
+    TradingBenchmarkHelpers::ReleaseObjects(Items);
+
+    return Results;
+}
+
+FString UPerformanceBenchmarkLibrary::BenchmarkTradeRouteSearch(
+    UObject* WorldContextObject,
+    int32 NumMarkets,
+    int32 NumItems,
+    int32 NumTraders)
+{
+    if (!WorldContextObject || NumMarkets < 2 || NumItems <= 0 || NumTraders <= 0)
+    {
+        return TEXT("ERROR: Invalid parameters");
+    }
+
+    FString Results = FString::Printf(TEXT("=== Trade Route Search Benchmark ===\n"));
+    Results += FString::Printf(TEXT("Markets: %d, Items: %d, Traders: %d\n\n"), NumMarkets, NumItems, NumTraders);
+
+    const int32 MaxRoutes = 10;
+    TArray<UTradeItemDataAsset*> Items = TradingBenchmarkHelpers::CreateItems(NumItems);
+    TArray<UMarketDataAsset*> Markets = TradingBenchmarkHelpers::CreateMarkets(NumMarkets, Items, 4242);
+    FMarketStateTable States;
+    TradingBenchmarkHelpers::CreateStates(Markets, States);
+
+    // Per-trader exhaustive search (UAITraderComponent::FindBestTradeRoutesLocal, profit ranking)
+    float BruteForceBestProfit = 0.0f;
+    const double BruteForceTime = MeasureExecutionTime([&Markets, &States, &BruteForceBestProfit, NumTraders, MaxRoutes]() {
+        for (int32 Trader = 0; Trader < NumTraders; ++Trader)
+        {
+            TArray<float> RouteProfits;
+            for (int32 Row = 0; Row < Markets.Num(); ++Row)
+            {
+                const UMarketDataAsset* Origin = Markets[Row];
+                const TConstArrayView<FMarketItemState> OriginStates = States.GetItems(Row);
+                for (int32 i = 0; i < OriginStates.Num(); ++i)
+                {
+                    UTradeItemDataAsset* TradeItem = Origin->Inventory[i].TradeItem;
+                    if (!TradeItem || !OriginStates[i].bInStock)
+                    {
+                        continue;
+                    }
+
+                    const float BuyPrice = States.GetItemPrice(Origin, TradeItem, true);
+                    float BestProfit = 0.0f;
+                    for (const UMarketDataAsset* Destination : Markets)
+                    {
+                        if (Destination == Origin)
+                        {
+                            continue;
+                        }
+                        BestProfit = FMath::Max(BestProfit, States.GetItemPrice(Destination, TradeItem, false) - BuyPrice);
+                    }
+
+                    if (BestProfit > 0.0f)
+                    {
+                        RouteProfits.Add(BestProfit);
+                    }
+                }
+            }
+
+            RouteProfits.Sort(TGreater<float>());
+            RouteProfits.SetNum(FMath::Min(RouteProfits.Num(), MaxRoutes));
+            BruteForceBestProfit = RouteProfits.Num() > 0 ? RouteProfits[0] : 0.0f;
+        }
+    });
+
+    // Shared index: one build, then one top-K query per trader
+    FTradeArbitrageIndex Index;
+    Index.SetMarketStates(&States);
+    const double BuildTime = MeasureExecutionTime([&Index, &Markets]() {
+        Index.Rebuild(Markets);
+    });
+
+    TArray<FTradeRoute> Routes;
+    const double QueryTime = MeasureExecutionTime([&Index, &Routes, NumTraders, MaxRoutes]() {
+        const FArbitrageRouteFilter Filter;
+        for (int32 Trader = 0; Trader < NumTraders; ++Trader)
+        {
+            Index.FindTopRoutes(MaxRoutes, Filter, Routes);
+        }
+    });
+    const float IndexBestProfit = Routes.Num() > 0 ? Routes[0].ProfitPerUnit : 0.0f;
+
+    // Single transaction: one (market, item) pair changes
+    States.GetItems(0)[0].SupplyLevel *= 0.5f;
+    const double TransactionUpdateTime = MeasureExecutionTime([&Index, &Markets]() {
+        Index.RefreshMarketItem(Markets[0], Markets[0]->Inventory[0].TradeItem);
+    });
+
+    // Economy tick: every supply level drifts, every price is re-read
+    for (int32 Row = 0; Row < States.NumRows(); ++Row)
+    {
+        for (FMarketItemState& State : States.GetItems(Row))
+        {
+            State.SupplyLevel = FMath::Lerp(State.SupplyLevel, 1.0f, 0.05f);
+        }
+    }
+    int32 ChangedPrices = 0;
+    const double TickUpdateTime = MeasureExecutionTime([&Index, &ChangedPrices]() {
+        ChangedPrices = Index.RefreshAll();
+    });
+
+    Results += FString::Printf(TEXT("Per-trader search: %s total, %s per trader\n"),
+        *FormatDuration(BruteForceTime), *FormatDuration(BruteForceTime / NumTraders));
+    Results += FString::Printf(TEXT("Index build: %s\n"), *FormatDuration(BuildTime));
+    Results += FString::Printf(TEXT("Index queries: %s total, %s per trader\n"),
+        *FormatDuration(QueryTime), *FormatDuration(QueryTime / NumTraders));
+    Results += FString::Printf(TEXT("Transaction update: %s\n"), *FormatDuration(TransactionUpdateTime));
+    Results += FString::Printf(TEXT("Economy tick update: %s (%d prices changed)\n"), *FormatDuration(TickUpdateTime), ChangedPrices);
+    Results += FString::Printf(TEXT("Query speedup: %.1fx\n"), QueryTime > 0.0 ? BruteForceTime / QueryTime : 0.0);
+    Results += FString::Printf(TEXT("Best route matches: %s (%.2f vs %.2f)\n\n"),
+        FMath::IsNearlyEqual(BruteForceBestProfit, IndexBestProfit, 0.01f) ? TEXT("Yes") : TEXT("No"),
+        BruteForceBestProfit, IndexBestProfit);
+
+    TradingBenchmarkHelpers::ReleaseObjects(Markets);
+    TradingBenchmarkHelpers::ReleaseObjects(Items);
+
+    return Results;
+}
+
+FString UPerformanceBenchmarkLibrary::BenchmarkContractRoutePlanning(
+    UObject* WorldContextObject,
+    int32 NumContracts,
+    int32 NumTraders,
+    int32 Seed)
+{
+    if (!WorldContextObject || NumContracts <= 0 || NumTraders <= 0)
+    {
+        return TEXT("ERROR: Invalid parameters");
+    }
+
+    FString Results = FString::Printf(TEXT("=== Contract Route Planning Benchmark ===\n"));
+    Results += FString::Printf(TEXT("Contracts: %d, Traders: %d\n\n"), NumContracts, NumTraders);
+
+    FRandomStream Random(Seed);
+    TArray<UTradeItemDataAsset*> Items = TradingBenchmarkHelpers::CreateItems(10);
+
+    // Contracts run between shared sites, so several pickups and deliveries coincide
+    const float WorldExtent = 50000.0f;
+    const int32 NumSites = FMath::Max(2, NumContracts / 2);
+    TArray<FVector> Sites;
+    Sites.Reserve(NumSites);
+    for (int32 i = 0; i < NumSites; ++i)
+    {
+        Sites.Add(FVector(
+            Random.FRandRange(-WorldExtent, WorldExtent),
+            Random.FRandRange(-WorldExtent, WorldExtent),
+            Random.FRandRange(-WorldExtent, WorldExtent) * 0.1f));
+    }
+
+    TArray<UTradeContractDataAsset*> Contracts;
+    Contracts.Reserve(NumContracts);
+    float TotalCargoVolume = 0.0f;
+    for (int32 i = 0; i < NumContracts; ++i)
+    {
+        UTradeContractDataAsset* Contract = NewObject<UTradeContractDataAsset>(GetTransientPackage());
+        Contract->AddToRoot();
+        Contract->Status = EContractStatus::Available;
+        Contract->OriginLocation.Coordinates = Sites[Random.RandRange(0, NumSites - 1)];
+        Contract->DestinationLocation.Coordinates = Sites[Random.RandRange(0, NumSites - 1)];
+        Contract->TimeLimit = Random.FRand() < 0.25f ? 0.0f : Random.FRandRange(8.0f, 48.0f);
+        Contract->Rewards.Credits = Random.RandRange(1000, 20000);
+
+        FContractCargo Cargo;
+        Cargo.TradeItem = Items[Random.RandRange(0, Items.Num() - 1)];
+        Cargo.Quantity = Random.RandRange(1, 50);
+        Contract->RequiredCargo.Add(Cargo);
+
+        TotalCargoVolume += Contract->GetTotalCargoVolume();
+        Contracts.Add(Contract);
+    }
+
+    const float AverageCargoVolume = TotalCargoVolume / NumContracts;
+    TArray<FContractPlannerTrader> Traders;
+    Traders.Reserve(NumTraders);
+    for (int32 i = 0; i < NumTraders; ++i)
+    {
+        FContractPlannerTrader& Trader = Traders.AddDefaulted_GetRef();
+        Trader.StartLocation.Coordinates = Sites[Random.RandRange(0, NumSites - 1)];
+        Trader.Speed = Random.FRandRange(5000.0f, 15000.0f);
+        Trader.VolumeCapacity = AverageCargoVolume * Random.FRandRange(1.5f, 4.0f);
+    }
+
+    FContractRoutePlanner Planner;
+    const double SetupTime = MeasureExecutionTime([&Planner, &Contracts]() {
+        Planner.SetContracts(Contracts, &FContractRoutePlanner::GetStraightLineDistance);
+    });
+
+    // Traders split the board: each one claims its tour's contracts
+    TArray<FContractTour> Tours;
+    Tours.SetNum(NumTraders);
+    const double PlanTime = MeasureExecutionTime([&Planner, &Traders, &Tours]() {
+        TBitArray<> Claimed(false, Planner.GetContractCount());
+        for (int32 i = 0; i < Traders.Num(); ++i)
+        {
+            Planner.PlanTour(Traders[i], Tours[i], &Claimed);
+        }
+    });
+
+    // Quality: the same contracts served one at a time, in the order they were picked
+    int32 PlannedContracts = 0;
+    int32 MultiContractTours = 0;
+    int32 TotalReward = 0;
+    int32 SequentialLate = 0;
+    double TourHours = 0.0;
+    double SequentialHours = 0.0;
+    for (int32 i = 0; i < NumTraders; ++i)
+    {
+        const FContractTour& Tour = Tours[i];
+        PlannedContracts += Tour.Contracts.Num();
+        MultiContractTours += Tour.Contracts.Num() > 1 ? 1 : 0;
+        TotalReward += Tour.TotalReward;
+        TourHours += Tour.TravelHours;
+
+        int32 LateDeliveries = 0;
+        SequentialHours += Planner.EstimateSequentialHours(Traders[i], Tour, &LateDeliveries);
+        SequentialLate += LateDeliveries;
+    }
+
+    Results += FString::Printf(TEXT("Setup (%d locations): %s\n"), Planner.GetLocationCount(), *FormatDuration(SetupTime));
+    Results += FString::Printf(TEXT("Planning: %s total, %s per trader\n"),
+        *FormatDuration(PlanTime), *FormatDuration(PlanTime / NumTraders));
+    Results += FString::Printf(TEXT("Contracts planned: %d of %d (%d multi-contract tours, %d credits)\n"),
+        PlannedContracts, Planner.GetContractCount(), MultiContractTours, TotalReward);
+    Results += FString::Printf(TEXT("Tour time: %.1f h (no late deliveries)\n"), TourHours);
+    Results += FString::Printf(TEXT("One at a time: %.1f h (%d late deliveries)\n"), SequentialHours, SequentialLate);
+    Results += FString::Printf(TEXT("Time saved: %.1f%%\n\n"),
+        SequentialHours > 0.0 ? (1.0 - TourHours / SequentialHours) * 100.0 : 0.0);
+
+    TradingBenchmarkHelpers::ReleaseObjects(Contracts);
+    TradingBenchmarkHelpers::ReleaseObjects(Items);
+
+    return Results;
+}
+
 //================================================================================
 // LOD SYSTEM BENCHMARKS
 //================================================================================
@@ -467,6 +998,18 @@ FString UPerformanceBenchmarkLibrary::RunFullBenchmarkSuite(UObject* WorldContex
     Results += BenchmarkStationSystem(WorldContextObject, 5, 20);
     Results += TEXT("\n");
 
+    Results += BenchmarkEconomySimulation(WorldContextObject, 500, 5);
+    Results += TEXT("\n");
+
+    Results += BenchmarkEconomyCatchUp(WorldContextObject, 200, 50, 30, 1337);
+    Results += TEXT("\n");
+
+    Results += BenchmarkTradeRouteSearch(WorldContextObject, 50, 50, 10);
+    Results += TEXT("\n");
+
+    Results += BenchmarkContractRoutePlanning(WorldContextObject, 100, 50, 1337);
+    Results += TEXT("\n");
+
     Results += BenchmarkLODSystem(WorldContextObject, 100, 10.0f);
     Results += TEXT("\n");
 
@@ -3,9 +3,9 @@
 #include "Player/AdastreaPlayerController.h"
 #include "Ships/Spaceship.h"
 #include "Stations/SpaceStation.h"
+#include "Stations/StationRegistrySubsystem.h"
 #include "AdastreaLog.h"
 #include "Blueprint/UserWidget.h"
-#include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "UI/AdastreaHUDWidget.h"
 #include "UI/ShipStatusWidget.h"
@@ -24,7 +24,6 @@ AAdastreaPlayerController::AAdastreaPlayerController()
 	ModuleCatalog = nullptr;
 	StationSearchRadius = 5000.0f;
 	TradingInteractionRadius = 2000.0f;
-	StationCheckInterval = 0.5f;
 	StationEditorWidget = nullptr;
 	bIsStationEditorOpen = false;
 	HUDWidgetClass = nullptr;
@@ -75,19 +74,18 @@ void AAdastreaPlayerController::BeginPlay()
 		UE_LOG(LogAdastrea, Log, TEXT("AdastreaPlayerController: No HUD widget class set - HUD will not be displayed"));
 	}
 
-	// Start timer to check for nearby tradable stations
-	UWorld* World = GetWorld();
-	if (World)
+	// Nearby tradable stations are pushed by the station registry as the ship moves,
+	// so follow possession changes and listen for range events instead of polling
+	OnPossessedPawnChanged.AddDynamic(this, &AAdastreaPlayerController::HandlePossessedPawnChanged);
+
+	if (UStationRegistrySubsystem* StationRegistry = GetWorld()->GetSubsystem<UStationRegistrySubsystem>())
 	{
-		World->GetTimerManager().SetTimer(
-			StationCheckTimerHandle,
-			this,
-			&AAdastreaPlayerController::CheckForNearbyTradableStations,
-			StationCheckInterval,
-			true  // Loop
-		);
-		UE_LOG(LogAdastrea, Log, TEXT("AdastreaPlayerController: Started nearby station check timer"));
+		StationRegistry->OnStationEnteredRange.AddDynamic(this, &AAdastreaPlayerController::HandleStationRangeChanged);
+		StationRegistry->OnStationExitedRange.AddDynamic(this, &AAdastreaPlayerController::HandleStationRangeChanged);
+		UE_LOG(LogAdastrea, Log, TEXT("AdastreaPlayerController: Listening for nearby station events"));
 	}
+
+	WatchControlledPawnForStations();
 }
 
 void AAdastreaPlayerController::SetupInputComponent()
@@ -102,11 +100,19 @@ void AAdastreaPlayerController::SetupInputComponent()
 
 void AAdastreaPlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// Explicitly clear the station check timer to avoid dangling callbacks and keep timer usage maintainable
+	// Stop station proximity events so the registry doesn't call into a dead controller
+	OnPossessedPawnChanged.RemoveDynamic(this, &AAdastreaPlayerController::HandlePossessedPawnChanged);
+
 	if (UWorld* World = GetWorld())
 	{
-		World->GetTimerManager().ClearTimer(StationCheckTimerHandle);
+		if (UStationRegistrySubsystem* StationRegistry = World->GetSubsystem<UStationRegistrySubsystem>())
+		{
+			StationRegistry->StopWatchingProximity(StationWatchedPawn.Get());
+			StationRegistry->OnStationEnteredRange.RemoveDynamic(this, &AAdastreaPlayerController::HandleStationRangeChanged);
+			StationRegistry->OnStationExitedRange.RemoveDynamic(this, &AAdastreaPlayerController::HandleStationRangeChanged);
+		}
 	}
+	StationWatchedPawn.Reset();
 
 	Super::EndPlay(EndPlayReason);
 }
@@ -194,28 +200,14 @@ ASpaceStation* AAdastreaPlayerController::FindNearestStation()
 		return nullptr;
 	}
 
-	FVector PlayerLocation = ControlledPawn->GetActorLocation();
-	
-	// Find all space stations in the world
-	TArray<AActor*> FoundStations;
-	UGameplayStatics::GetAllActorsOfClass(World, ASpaceStation::StaticClass(), FoundStations);
-	
-	ASpaceStation* NearestStation = nullptr;
-	float NearestDistance = StationSearchRadius;
-	
-	// GetAllActorsOfClass returns actors of the specified class, so no Cast needed
-	for (AActor* Actor : FoundStations)
+	// Station registry answers from a KD-tree instead of scanning every station
+	UStationRegistrySubsystem* StationRegistry = World->GetSubsystem<UStationRegistrySubsystem>();
+	if (!StationRegistry)
 	{
-		ASpaceStation* Station = static_cast<ASpaceStation*>(Actor);
-		float Distance = FVector::Dist(PlayerLocation, Station->GetActorLocation());
-		if (Distance < NearestDistance)
-		{
-			NearestDistance = Distance;
-			NearestStation = Station;
-		}
+		return nullptr;
 	}
-	
-	return NearestStation;
+
+	return StationRegistry->FindNearestStation(ControlledPawn->GetActorLocation(), StationSearchRadius);
 }
 
 UUserWidget* AAdastreaPlayerController::CreateStationEditorWidget()
@@ -971,32 +963,9 @@ void AAdastreaPlayerController::CheckForNearbyTradableStations()
 		return;
 	}
 
-	FVector PlayerLocation = ControlledPawn->GetActorLocation();
-	
-	// Find all space stations in the world
-	TArray<AActor*> FoundStations;
-	UGameplayStatics::GetAllActorsOfClass(World, ASpaceStation::StaticClass(), FoundStations);
-	
-	ASpaceStation* ClosestStation = nullptr;
-	float ClosestDistance = TradingInteractionRadius;
-	
-	// Find the nearest station within trading interaction radius
-	for (AActor* Actor : FoundStations)
-	{
-		ASpaceStation* Station = Cast<ASpaceStation>(Actor);
-		if (!Station)
-		{
-			continue;
-		}
-		
-		float Distance = FVector::Dist(PlayerLocation, Station->GetActorLocation());
-		
-		if (Distance < ClosestDistance)
-		{
-			ClosestDistance = Distance;
-			ClosestStation = Station;
-		}
-	}
+	// The registry tracks the nearest station within TradingInteractionRadius of the watched ship
+	UStationRegistrySubsystem* StationRegistry = World->GetSubsystem<UStationRegistrySubsystem>();
+	ASpaceStation* ClosestStation = StationRegistry ? StationRegistry->GetStationInRange(ControlledPawn) : nullptr;
 
 	// Check if the nearby station state changed
 	bool bIsCurrentlyNear = (ClosestStation != nullptr);
@@ -1012,7 +981,7 @@ void AAdastreaPlayerController::CheckForNearbyTradableStations()
 		if (bIsCurrentlyNear)
 		{
 			UE_LOG(LogAdastrea, Log, TEXT("CheckForNearbyTradableStations: Now near station '%s' at distance %.1f"), 
-				*ClosestStation->GetName(), ClosestDistance);
+				*ClosestStation->GetName(), FVector::Dist(ControlledPawn->GetActorLocation(), ClosestStation->GetActorLocation()));
 		}
 		else
 		{
@@ -1021,6 +990,37 @@ void AAdastreaPlayerController::CheckForNearbyTradableStations()
 	}
 }
 
+void AAdastreaPlayerController::WatchControlledPawnForStations()
+{
+	UStationRegistrySubsystem* StationRegistry = GetWorld() ? GetWorld()->GetSubsystem<UStationRegistrySubsystem>() : nullptr;
+	if (StationRegistry)
+	{
+		StationRegistry->StopWatchingProximity(StationWatchedPawn.Get());
+		StationWatchedPawn.Reset();
+
+		if (ASpaceship* Spaceship = GetControlledSpaceship())
+		{
+			StationRegistry->WatchProximity(Spaceship, TradingInteractionRadius);
+			StationWatchedPawn = Spaceship;
+		}
+	}
+
+	CheckForNearbyTradableStations();
+}
+
+void AAdastreaPlayerController::HandlePossessedPawnChanged(APawn* OldPawn, APawn* NewPawn)
+{
+	WatchControlledPawnForStations();
+}
+
+void AAdastreaPlayerController::HandleStationRangeChanged(AActor* Watcher, ASpaceStation* Station)
+{
+	if (Watcher && Watcher == StationWatchedPawn.Get())
+	{
+		CheckForNearbyTradableStations();
+	}
+}
+
 void AAdastreaPlayerController::AttemptTradeWithNearestStation()
 {
 	if (!IsControllingSpaceship())
@@ -13,6 +13,7 @@
 #include "InputAction.h"
 #include "Stations/SpaceStationModule.h"
 #include "Stations/DockingBayModule.h"
+#include "Navigation/SpatialGridSubsystem.h"
 #include "Blueprint/UserWidget.h"
 
 // Debug flag for docking system - can be disabled for shipping builds
@@ -140,6 +141,25 @@ void ASpaceship::BeginPlay()
             InteriorInstance = SpawnedInterior;
         }
     }
+
+    // Make this ship visible to sector, radius and nearest-actor queries
+    if (USpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<USpatialGridSubsystem>())
+    {
+        SpatialGrid->RegisterActor(this);
+    }
+}
+
+void ASpaceship::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (USpatialGridSubsystem* SpatialGrid = World->GetSubsystem<USpatialGridSubsystem>())
+        {
+            SpatialGrid->UnregisterActor(this);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 #if WITH_EDITOR
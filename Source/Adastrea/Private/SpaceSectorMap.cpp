@@ -2,6 +2,9 @@
 
 #include "SpaceSectorMap.h"
 #include "AdastreaLog.h"
+#include "Trading/TradeArbitrageSubsystem.h"
+#include "Navigation/SpatialGridSubsystem.h"
+#include "Navigation/SectorGraphSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "EngineUtils.h"
 
@@ -39,6 +42,50 @@ void ASpaceSectorMap::BeginPlay()
 		GetActorLocation().X,
 		GetActorLocation().Y,
 		GetActorLocation().Z);
+
+	// Add this sector to the trade route travel graph
+	if (UTradeArbitrageSubsystem* Arbitrage = GetWorld()->GetSubsystem<UTradeArbitrageSubsystem>())
+	{
+		Arbitrage->RegisterSector(this);
+	}
+
+	// Add this sector to the sector routing graph
+	if (USectorGraphSubsystem* SectorGraph = GetWorld()->GetSubsystem<USectorGraphSubsystem>())
+	{
+		SectorGraph->RegisterSector(this);
+	}
+}
+
+void ASpaceSectorMap::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UTradeArbitrageSubsystem* Arbitrage = World->GetSubsystem<UTradeArbitrageSubsystem>())
+		{
+			Arbitrage->UnregisterSector(this);
+		}
+
+		if (USectorGraphSubsystem* SectorGraph = World->GetSubsystem<USectorGraphSubsystem>())
+		{
+			SectorGraph->UnregisterSector(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASpaceSectorMap::Destroyed()
+{
+	// Also covers sectors deleted in the editor, which never receive EndPlay
+	if (UWorld* World = GetWorld())
+	{
+		if (USectorGraphSubsystem* SectorGraph = World->GetSubsystem<USectorGraphSubsystem>())
+		{
+			SectorGraph->UnregisterSector(this);
+		}
+	}
+
+	Super::Destroyed();
 }
 
 
@@ -69,6 +116,12 @@ void ASpaceSectorMap::PostEditMove(bool bFinished)
 	
 	if (bFinished)
 	{
+		// Move this sector to its new grid cell before validating against its neighbors
+		if (USectorGraphSubsystem* SectorGraph = GetWorld() ? GetWorld()->GetSubsystem<USectorGraphSubsystem>() : nullptr)
+		{
+			SectorGraph->RegisterSector(this);
+		}
+
 		// Validate sector after move
 		ValidateSectorConfiguration();
 		
@@ -126,13 +179,16 @@ FVector ASpaceSectorMap::GetSectorCenter() const
 
 FIntVector ASpaceSectorMap::GetGridCoordinates() const
 {
-	const FVector Center = GetSectorCenter();
-	
+	return WorldToGridCoordinates(GetSectorCenter());
+}
+
+FIntVector ASpaceSectorMap::WorldToGridCoordinates(const FVector& WorldLocation)
+{
 	// Convert world position to grid coordinates
 	// Each grid cell is one sector size (20,000,000 units = 200km)
-	int32 GridX = FMath::RoundToInt(Center.X / SectorSize);
-	int32 GridY = FMath::RoundToInt(Center.Y / SectorSize);
-	int32 GridZ = FMath::RoundToInt(Center.Z / SectorSize);
+	int32 GridX = FMath::RoundToInt(WorldLocation.X / SectorSize);
+	int32 GridY = FMath::RoundToInt(WorldLocation.Y / SectorSize);
+	int32 GridZ = FMath::RoundToInt(WorldLocation.Z / SectorSize);
 	
 	return FIntVector(GridX, GridY, GridZ);
 }
@@ -147,6 +203,14 @@ TArray<AActor*> ASpaceSectorMap::GetActorsInSector(TSubclassOf<AActor> ActorClas
 	}
 	
 	const FBox Bounds = GetSectorBounds();
+
+	// During play, ask the spatial grid when it holds every actor of the class: only cells overlapping the sector are visited
+	const USpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<USpatialGridSubsystem>();
+	if (SpatialGrid && SpatialGrid->IsTrackedClass(ActorClass))
+	{
+		SpatialGrid->GetGrid().QueryBox(Bounds, ActorClass, ActorsInSector);
+		return ActorsInSector;
+	}
 	
 	// Get all actors of the specified class (or all actors if nullptr)
 	TArray<AActor*> AllActors;
@@ -183,6 +247,14 @@ int32 ASpaceSectorMap::GetActorCountInSector(TSubclassOf<AActor> ActorClass) con
 	}
 	
 	const FBox Bounds = GetSectorBounds();
+
+	// During play, count tracked classes from the spatial grid without building a list
+	const USpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<USpatialGridSubsystem>();
+	if (SpatialGrid && SpatialGrid->IsTrackedClass(ActorClass))
+	{
+		return SpatialGrid->GetGrid().CountInBox(Bounds, ActorClass);
+	}
+
 	int32 Count = 0;
 	
 	// Count actors within bounds
@@ -220,7 +292,13 @@ TArray<ASpaceSectorMap*> ASpaceSectorMap::GetNeighboringSectors() const
 	// Return cached neighbors if valid (cast away const for cache update)
 	ASpaceSectorMap* MutableThis = const_cast<ASpaceSectorMap*>(this);
 	
-	if (bNeighborCacheDirty || CachedNeighboringSectors.Num() == 0)
+	// With the sector registry, any sector being added, moved or removed bumps its version
+	const USectorGraphSubsystem* SectorGraph = GetWorld() ? GetWorld()->GetSubsystem<USectorGraphSubsystem>() : nullptr;
+	const bool bCacheStale = SectorGraph
+		? SectorGraph->GetRegistryVersion() != CachedRegistryVersion
+		: CachedNeighboringSectors.Num() == 0;
+	
+	if (bNeighborCacheDirty || bCacheStale)
 	{
 		MutableThis->RefreshNeighborCache();
 	}
@@ -251,15 +329,26 @@ bool ASpaceSectorMap::ValidateSectorConfiguration() const
 	}
 	
 	// Check for overlapping sectors
-	TArray<AActor*> AllSectorActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ASpaceSectorMap::StaticClass(), AllSectorActors);
+	// Centers less than half a sector apart are at most one grid cell apart on each axis,
+	// so the registry only needs to probe the surrounding 3x3x3 cells
+	TArray<ASpaceSectorMap*> CandidateSectors;
+	if (const USectorGraphSubsystem* SectorGraph = GetWorld()->GetSubsystem<USectorGraphSubsystem>())
+	{
+		SectorGraph->GetSectorsNear(GetGridCoordinates(), 1, CandidateSectors);
+	}
+	else
+	{
+		for (TActorIterator<ASpaceSectorMap> It(GetWorld()); It; ++It)
+		{
+			CandidateSectors.Add(*It);
+		}
+	}
 	
 	const FVector CurrentCenter = GetSectorCenter();
 	const float MinDistance = SectorSize * 0.5f; // Sectors should be at least half a sector apart to avoid overlap
 	
-	for (AActor* Actor : AllSectorActors)
+	for (ASpaceSectorMap* OtherSector : CandidateSectors)
 	{
-		ASpaceSectorMap* OtherSector = Cast<ASpaceSectorMap>(Actor);
 		if (OtherSector && OtherSector != this)
 		{
 			FVector OtherCenter = OtherSector->GetSectorCenter();
@@ -314,15 +403,25 @@ void ASpaceSectorMap::RefreshNeighborCache()
 		return;
 	}
 
-	// Collect all sector actors in the world
-	TArray<AActor*> AllSectorActors;
-	UGameplayStatics::GetAllActorsOfClass(World, ASpaceSectorMap::StaticClass(), AllSectorActors);
-
-	const FVector CurrentCenter = GetSectorCenter();
+	// Centers within one sector size are at most one grid cell apart on each axis, so the
+	// registry only probes the surrounding 3x3x3 cells; without it, scan every sector
+	TArray<ASpaceSectorMap*> CandidateSectors;
+	const USectorGraphSubsystem* SectorGraph = World->GetSubsystem<USectorGraphSubsystem>();
+	if (SectorGraph)
+	{
+		SectorGraph->GetSectorsNear(GetGridCoordinates(), 1, CandidateSectors);
+		CachedRegistryVersion = SectorGraph->GetRegistryVersion();
+	}
+	else
+	{
+		for (TActorIterator<ASpaceSectorMap> It(World); It; ++It)
+		{
+			CandidateSectors.Add(*It);
+		}
+	}
 
-	for (AActor* Actor : AllSectorActors)
+	for (ASpaceSectorMap* OtherSector : CandidateSectors)
 	{
-		ASpaceSectorMap* OtherSector = Cast<ASpaceSectorMap>(Actor);
 		if (!OtherSector || OtherSector == this)
 		{
 			continue;
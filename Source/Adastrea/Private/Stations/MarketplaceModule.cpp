@@ -1,6 +1,8 @@
 // Copyright (c) 2025 Mittenzx. Licensed under MIT.
 
 #include "Stations/MarketplaceModule.h"
+#include "Trading/TradeArbitrageSubsystem.h"
+#include "Engine/World.h"
 
 AMarketplaceModule::AMarketplaceModule()
 {
@@ -13,3 +15,29 @@ AMarketplaceModule::AMarketplaceModule()
     bIsOpen = true;
     MarketplaceName = FText::FromString(TEXT("Marketplace"));
 }
+
+void AMarketplaceModule::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UTradeArbitrageSubsystem* Arbitrage = World->GetSubsystem<UTradeArbitrageSubsystem>())
+        {
+            Arbitrage->RegisterMarketplace(this);
+        }
+    }
+}
+
+void AMarketplaceModule::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UTradeArbitrageSubsystem* Arbitrage = World->GetSubsystem<UTradeArbitrageSubsystem>())
+        {
+            Arbitrage->UnregisterMarketplace(this);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
@@ -3,6 +3,9 @@
 #include "Stations/SpaceStation.h"
 #include "Stations/MarketplaceModule.h"
 #include "Stations/DockingBayModule.h"
+#include "Navigation/SpatialGridSubsystem.h"
+#include "Stations/StationRegistrySubsystem.h"
+#include "Navigation/SpaceNavigationSubsystem.h"
 #include "AdastreaLog.h"
 
 ASpaceStation::ASpaceStation()
@@ -42,6 +45,47 @@ void ASpaceStation::BeginPlay()
     UE_LOG(LogAdastreaStations, Log,
         TEXT("SpaceStation::BeginPlay - Station %s initialized with %d modules"),
         *GetName(), Modules.Num());
+
+    // Make this station visible to sector, radius and nearest-actor queries
+    if (USpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<USpatialGridSubsystem>())
+    {
+        SpatialGrid->RegisterActor(this);
+    }
+
+    // Make this station visible to nearest-station lookups and proximity events
+    if (UStationRegistrySubsystem* StationRegistry = GetWorld()->GetSubsystem<UStationRegistrySubsystem>())
+    {
+        StationRegistry->RegisterStation(this);
+    }
+
+    // Keep autopilot paths clear of the station and its modules
+    if (USpaceNavigationSubsystem* SpaceNavigation = GetWorld()->GetSubsystem<USpaceNavigationSubsystem>())
+    {
+        SpaceNavigation->RegisterObstacle(this);
+    }
+}
+
+void ASpaceStation::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (USpatialGridSubsystem* SpatialGrid = World->GetSubsystem<USpatialGridSubsystem>())
+        {
+            SpatialGrid->UnregisterActor(this);
+        }
+
+        if (UStationRegistrySubsystem* StationRegistry = World->GetSubsystem<UStationRegistrySubsystem>())
+        {
+            StationRegistry->UnregisterStation(this);
+        }
+
+        if (USpaceNavigationSubsystem* SpaceNavigation = World->GetSubsystem<USpaceNavigationSubsystem>())
+        {
+            SpaceNavigation->UnregisterObstacle(this);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void ASpaceStation::AddModule(ASpaceStationModule* Module)
@@ -65,6 +109,7 @@ void ASpaceStation::AddModule(ASpaceStationModule* Module)
     
     // Attach the module to this station
     Module->AttachToActor(this, FAttachmentTransformRules::KeepRelativeTransform);
+    MarkNavigationObstacleDirty();
     
     UE_LOG(LogAdastreaStations, Log, TEXT("SpaceStation::AddModule - Successfully added module to station %s"), *GetName());
 }
@@ -87,6 +132,7 @@ bool ASpaceStation::AddModuleAtLocation(ASpaceStationModule* Module, FVector Rel
     {
         Modules.Add(Module);
     }
+    MarkNavigationObstacleDirty();
 
     UE_LOG(LogAdastreaStations, Log, TEXT("SpaceStation::AddModuleAtLocation - Added module at location (%.2f, %.2f, %.2f)"), 
         RelativeLocation.X, RelativeLocation.Y, RelativeLocation.Z);
@@ -115,6 +161,7 @@ bool ASpaceStation::RemoveModule(ASpaceStationModule* Module)
     
     // Detach the module from this station
     Module->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+    MarkNavigationObstacleDirty();
 
     UE_LOG(LogAdastreaStations, Log, TEXT("SpaceStation::RemoveModule - Successfully removed module from station %s"), *GetName());
     return true;
@@ -138,6 +185,7 @@ bool ASpaceStation::MoveModule(ASpaceStationModule* Module, FVector NewRelativeL
 
     // Update the module's relative location
     Module->SetActorRelativeLocation(NewRelativeLocation);
+    MarkNavigationObstacleDirty();
 
     UE_LOG(LogAdastreaStations, Log, TEXT("SpaceStation::MoveModule - Moved module to (%.2f, %.2f, %.2f)"), 
         NewRelativeLocation.X, NewRelativeLocation.Y, NewRelativeLocation.Z);
@@ -145,6 +193,17 @@ bool ASpaceStation::MoveModule(ASpaceStationModule* Module, FVector NewRelativeL
     return true;
 }
 
+void ASpaceStation::MarkNavigationObstacleDirty() const
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (USpaceNavigationSubsystem* SpaceNavigation = World->GetSubsystem<USpaceNavigationSubsystem>())
+        {
+            SpaceNavigation->MarkObstaclesDirty();
+        }
+    }
+}
+
 TArray<ASpaceStationModule*> ASpaceStation::GetModules() const
 {
     return Modules;
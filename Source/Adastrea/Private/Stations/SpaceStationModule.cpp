@@ -1,5 +1,6 @@
 #include "Stations/SpaceStationModule.h"
 #include "Stations/SpaceStation.h"
+#include "Navigation/SpatialGridSubsystem.h"
 #include "AdastreaLog.h"
 #include "UObject/ConstructorHelpers.h"
 
@@ -30,6 +31,30 @@ ASpaceStationModule::ASpaceStationModule()
     bIsDestroyed = false;
 }
 
+void ASpaceStationModule::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // Make this module visible to sector, radius and nearest-actor queries
+    if (USpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<USpatialGridSubsystem>())
+    {
+        SpatialGrid->RegisterActor(this);
+    }
+}
+
+void ASpaceStationModule::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (USpatialGridSubsystem* SpatialGrid = World->GetSubsystem<USpatialGridSubsystem>())
+        {
+            SpatialGrid->UnregisterActor(this);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 // ====================
 // IDamageable Interface Implementation
 // ====================
@@ -0,0 +1,155 @@
+#include "Stations/StationKDTree.h"
+#include "Algo/Sort.h"
+
+void FStationKDTree::Build(TConstArrayView<FVector> Points)
+{
+    Nodes.Reset(Points.Num());
+    for (int32 Index = 0; Index < Points.Num(); ++Index)
+    {
+        FNode& Node = Nodes.AddDefaulted_GetRef();
+        Node.Location = Points[Index];
+        Node.PointIndex = Index;
+    }
+
+    BuildRange(0, Nodes.Num());
+}
+
+void FStationKDTree::Reset()
+{
+    Nodes.Reset();
+}
+
+void FStationKDTree::BuildRange(int32 Begin, int32 End)
+{
+    if (End - Begin <= 1)
+    {
+        return;
+    }
+
+    FBox Bounds(ForceInit);
+    for (int32 Index = Begin; Index < End; ++Index)
+    {
+        Bounds += Nodes[Index].Location;
+    }
+
+    const FVector Extent = Bounds.GetSize();
+    uint8 Axis = 0;
+    if (Extent.Y > Extent.X && Extent.Y >= Extent.Z)
+    {
+        Axis = 1;
+    }
+    else if (Extent.Z > Extent.X && Extent.Z > Extent.Y)
+    {
+        Axis = 2;
+    }
+
+    Algo::Sort(MakeArrayView(Nodes.GetData() + Begin, End - Begin), [Axis](const FNode& A, const FNode& B)
+    {
+        return A.Location[Axis] < B.Location[Axis];
+    });
+
+    const int32 Mid = Begin + (End - Begin) / 2;
+    Nodes[Mid].Axis = Axis;
+
+    BuildRange(Begin, Mid);
+    BuildRange(Mid + 1, End);
+}
+
+int32 FStationKDTree::FindNearest(const FVector& Location, float MaxRadius, double* OutDistanceSquared) const
+{
+    double BestDistanceSquared = MaxRadius > 0.0f
+        ? FMath::Square(static_cast<double>(MaxRadius))
+        : TNumericLimits<double>::Max();
+    int32 BestIndex = INDEX_NONE;
+
+    FindNearestInRange(0, Nodes.Num(), Location, BestDistanceSquared, BestIndex);
+
+    if (OutDistanceSquared && BestIndex != INDEX_NONE)
+    {
+        *OutDistanceSquared = BestDistanceSquared;
+    }
+    return BestIndex;
+}
+
+void FStationKDTree::FindNearestInRange(int32 Begin, int32 End, const FVector& Location, double& BestDistanceSquared, int32& BestIndex) const
+{
+    if (Begin >= End)
+    {
+        return;
+    }
+
+    const int32 Mid = Begin + (End - Begin) / 2;
+    const FNode& Node = Nodes[Mid];
+
+    const double DistanceSquared = FVector::DistSquared(Location, Node.Location);
+    if (DistanceSquared < BestDistanceSquared)
+    {
+        BestDistanceSquared = DistanceSquared;
+        BestIndex = Node.PointIndex;
+    }
+
+    // Search the side containing the query first, then the far side only if
+    // the splitting plane is closer than the best match so far
+    const double PlaneOffset = Location[Node.Axis] - Node.Location[Node.Axis];
+    const bool bNearIsLeft = PlaneOffset < 0.0;
+
+    if (bNearIsLeft)
+    {
+        FindNearestInRange(Begin, Mid, Location, BestDistanceSquared, BestIndex);
+    }
+    else
+    {
+        FindNearestInRange(Mid + 1, End, Location, BestDistanceSquared, BestIndex);
+    }
+
+    if (FMath::Square(PlaneOffset) < BestDistanceSquared)
+    {
+        if (bNearIsLeft)
+        {
+            FindNearestInRange(Mid + 1, End, Location, BestDistanceSquared, BestIndex);
+        }
+        else
+        {
+            FindNearestInRange(Begin, Mid, Location, BestDistanceSquared, BestIndex);
+        }
+    }
+}
+
+void FStationKDTree::FindInRadius(const FVector& Location, float Radius, TArray<int32>& OutIndices) const
+{
+    if (Radius <= 0.0f)
+    {
+        return;
+    }
+
+    FindInRadiusRange(0, Nodes.Num(), Location, FMath::Square(static_cast<double>(Radius)), OutIndices);
+}
+
+void FStationKDTree::FindInRadiusRange(int32 Begin, int32 End, const FVector& Location, double RadiusSquared, TArray<int32>& OutIndices) const
+{
+    if (Begin >= End)
+    {
+        return;
+    }
+
+    const int32 Mid = Begin + (End - Begin) / 2;
+    const FNode& Node = Nodes[Mid];
+
+    if (FVector::DistSquared(Location, Node.Location) < RadiusSquared)
+    {
+        OutIndices.Add(Node.PointIndex);
+    }
+
+    const double PlaneOffset = Location[Node.Axis] - Node.Location[Node.Axis];
+    const double PlaneDistanceSquared = FMath::Square(PlaneOffset);
+
+    // Left holds coordinates <= the split, right holds >= the split
+    if (PlaneOffset < 0.0 || PlaneDistanceSquared < RadiusSquared)
+    {
+        FindInRadiusRange(Begin, Mid, Location, RadiusSquared, OutIndices);
+    }
+    if (PlaneOffset >= 0.0 || PlaneDistanceSquared < RadiusSquared)
+    {
+        FindInRadiusRange(Mid + 1, End, Location, RadiusSquared, OutIndices);
+    }
+}
@@ -0,0 +1,237 @@
+#include "Stations/StationRegistrySubsystem.h"
+#include "Stations/SpaceStation.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+bool UStationRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStationRegistrySubsystem::Deinitialize()
+{
+    for (const FProximityWatch& Watch : Watches)
+    {
+        if (USceneComponent* Root = Watch.Root.Get())
+        {
+            Root->TransformUpdated.Remove(Watch.TransformHandle);
+        }
+    }
+    Watches.Empty();
+    Stations.Empty();
+    Tree.Reset();
+
+    Super::Deinitialize();
+}
+
+void UStationRegistrySubsystem::RegisterStation(ASpaceStation* Station)
+{
+    if (!IsValid(Station) || Stations.Contains(Station))
+    {
+        return;
+    }
+
+    Stations.Add(Station);
+    bTreeDirty = true;
+    ScheduleRefreshAllWatches();
+}
+
+void UStationRegistrySubsystem::UnregisterStation(ASpaceStation* Station)
+{
+    if (!Station || Stations.RemoveSwap(Station, EAllowShrinking::No) == 0)
+    {
+        return;
+    }
+
+    bTreeDirty = true;
+
+    // Watchers in this station's range leave it now, while the station is still valid;
+    // the deferred refresh then picks up the next nearest station, if any
+    for (int32 WatchIndex = Watches.Num() - 1; WatchIndex >= 0; --WatchIndex)
+    {
+        if (Watches.IsValidIndex(WatchIndex) && Watches[WatchIndex].StationInRange.Get() == Station)
+        {
+            AActor* Watcher = Watches[WatchIndex].Watcher.Get();
+            Watches[WatchIndex].StationInRange.Reset();
+            OnStationExitedRange.Broadcast(Watcher, Station);
+        }
+    }
+
+    ScheduleRefreshAllWatches();
+}
+
+void UStationRegistrySubsystem::RebuildTreeIfDirty() const
+{
+    if (!bTreeDirty)
+    {
+        return;
+    }
+
+    TArray<FVector> Locations;
+    Locations.Reserve(Stations.Num());
+    for (const ASpaceStation* Station : Stations)
+    {
+        Locations.Add(Station->GetActorLocation());
+    }
+
+    Tree.Build(Locations);
+    bTreeDirty = false;
+}
+
+ASpaceStation* UStationRegistrySubsystem::FindNearestStation(const FVector& Location, float MaxRadius) const
+{
+    RebuildTreeIfDirty();
+
+    const int32 Index = Tree.FindNearest(Location, MaxRadius);
+    return Index != INDEX_NONE ? Stations[Index].Get() : nullptr;
+}
+
+TArray<ASpaceStation*> UStationRegistrySubsystem::GetStationsInRadius(const FVector& Location, float Radius) const
+{
+    RebuildTreeIfDirty();
+
+    TArray<int32> Indices;
+    Tree.FindInRadius(Location, Radius, Indices);
+
+    TArray<ASpaceStation*> Result;
+    Result.Reserve(Indices.Num());
+    for (const int32 Index : Indices)
+    {
+        Result.Add(Stations[Index].Get());
+    }
+    return Result;
+}
+
+void UStationRegistrySubsystem::WatchProximity(AActor* Watcher, float Radius)
+{
+    if (!IsValid(Watcher))
+    {
+        return;
+    }
+
+    int32 WatchIndex = FindWatchIndex(Watcher);
+    if (WatchIndex == INDEX_NONE)
+    {
+        WatchIndex = Watches.AddDefaulted();
+        FProximityWatch& Watch = Watches[WatchIndex];
+        Watch.Watcher = Watcher;
+
+        if (USceneComponent* Root = Watcher->GetRootComponent())
+        {
+            Watch.Root = Root;
+            Watch.TransformHandle = Root->TransformUpdated.AddUObject(this, &UStationRegistrySubsystem::HandleWatcherMoved);
+        }
+    }
+
+    Watches[WatchIndex].Radius = FMath::Max(Radius, 0.0f);
+    RefreshWatch(WatchIndex);
+}
+
+void UStationRegistrySubsystem::StopWatchingProximity(AActor* Watcher)
+{
+    const int32 WatchIndex = FindWatchIndex(Watcher);
+    if (WatchIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (USceneComponent* Root = Watches[WatchIndex].Root.Get())
+    {
+        Root->TransformUpdated.Remove(Watches[WatchIndex].TransformHandle);
+    }
+    Watches.RemoveAtSwap(WatchIndex, 1, EAllowShrinking::No);
+}
+
+ASpaceStation* UStationRegistrySubsystem::GetStationInRange(AActor* Watcher) const
+{
+    const int32 WatchIndex = FindWatchIndex(Watcher);
+    return WatchIndex != INDEX_NONE ? Watches[WatchIndex].StationInRange.Get() : nullptr;
+}
+
+int32 UStationRegistrySubsystem::FindWatchIndex(const AActor* Watcher) const
+{
+    if (!Watcher)
+    {
+        return INDEX_NONE;
+    }
+
+    return Watches.IndexOfByPredicate([Watcher](const FProximityWatch& Watch)
+    {
+        return Watch.Watcher.Get() == Watcher;
+    });
+}
+
+void UStationRegistrySubsystem::RefreshWatch(int32 WatchIndex)
+{
+    FProximityWatch& Watch = Watches[WatchIndex];
+
+    AActor* Watcher = Watch.Watcher.Get();
+    if (!Watcher)
+    {
+        if (USceneComponent* Root = Watch.Root.Get())
+        {
+            Root->TransformUpdated.Remove(Watch.TransformHandle);
+        }
+        Watches.RemoveAtSwap(WatchIndex, 1, EAllowShrinking::No);
+        return;
+    }
+
+    ASpaceStation* PreviousStation = Watch.StationInRange.Get();
+    ASpaceStation* CurrentStation = FindNearestStation(Watcher->GetActorLocation(), Watch.Radius);
+    if (CurrentStation == PreviousStation)
+    {
+        return;
+    }
+
+    // Update before broadcasting: listeners may query GetStationInRange or stop watching
+    Watch.StationInRange = CurrentStation;
+
+    if (PreviousStation)
+    {
+        OnStationExitedRange.Broadcast(Watcher, PreviousStation);
+    }
+    if (CurrentStation)
+    {
+        OnStationEnteredRange.Broadcast(Watcher, CurrentStation);
+    }
+}
+
+void UStationRegistrySubsystem::ScheduleRefreshAllWatches()
+{
+    if (bRefreshScheduled || Watches.Num() == 0)
+    {
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    bRefreshScheduled = true;
+    World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UStationRegistrySubsystem::RefreshAllWatches));
+}
+
+void UStationRegistrySubsystem::RefreshAllWatches()
+{
+    bRefreshScheduled = false;
+
+    // Backwards so watches removed by RefreshWatch or by listeners don't skip entries
+    for (int32 WatchIndex = Watches.Num() - 1; WatchIndex >= 0; --WatchIndex)
+    {
+        if (Watches.IsValidIndex(WatchIndex))
+        {
+            RefreshWatch(WatchIndex);
+        }
+    }
+}
+
+void UStationRegistrySubsystem::HandleWatcherMoved(USceneComponent* Component, EUpdateTransformFlags UpdateFlags, ETeleportType Teleport)
+{
+    const int32 WatchIndex = Component ? FindWatchIndex(Component->GetOwner()) : INDEX_NONE;
+    if (WatchIndex != INDEX_NONE && Watches[WatchIndex].Root.Get() == Component)
+    {
+        RefreshWatch(WatchIndex);
+    }
+}
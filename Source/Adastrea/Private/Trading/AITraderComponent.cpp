@@ -1,15 +1,46 @@
 #include "Trading/AITraderComponent.h"
 #include "Trading/MarketDataAsset.h"
+#include "Trading/MarketStateTable.h"
+#include "Trading/EconomyManager.h"
 #include "Trading/TradeItemDataAsset.h"
 #include "Trading/TradeContractDataAsset.h"
+#include "Trading/TradeArbitrageSubsystem.h"
+#include "Trading/ContractRoutePlanner.h"
+#include "Trading/AITraderSchedulerSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "AdastreaLog.h"
 // REMOVED: #include "Factions/FactionDataAsset.h" - faction system removed per Trade Simulator MVP
 
+namespace AITraderMarketState
+{
+	/** Live price of an item, or the template price when no state table is available */
+	static float GetPrice(const FMarketStateTable* States, const UMarketDataAsset* Market, UTradeItemDataAsset* Item, bool bIsBuying)
+	{
+		return States ? States->GetItemPrice(Market, Item, bIsBuying) : Market->GetItemPrice(Item, bIsBuying);
+	}
+
+	/** Live stock flag of an inventory entry, or the template stock when the market has no row */
+	static bool IsInStock(const FMarketStateTable* States, const UMarketDataAsset* Market, int32 InventoryIndex)
+	{
+		const int32 Row = States ? States->FindRow(Market) : INDEX_NONE;
+		if (Row != INDEX_NONE)
+		{
+			const TConstArrayView<FMarketItemState> Items = States->GetItems(Row);
+			return Items.IsValidIndex(InventoryIndex) && Items[InventoryIndex].bInStock;
+		}
+		return Market->Inventory[InventoryIndex].CurrentStock > 0;
+	}
+}
+
 UAITraderComponent::UAITraderComponent()
 	// REMOVED: TraderFaction - faction system removed per Trade Simulator MVP
 	: Strategy(EAITraderStrategy::Balanced)
 	, TradingCapital(10000)
 	, CargoCapacity(1000.0f)
+	, CargoMassCapacity(0.0f)
 	, TravelSpeed(100.0f)
+	, MaxRouteDistance(0.0f)
 	, TradingSkill(5)
 	, RiskTolerance(0.5f)
 	, MinProfitMargin(0.1f)
@@ -17,18 +48,68 @@ UAITraderComponent::UAITraderComponent()
 	, bOperatesInBlackMarkets(false)
 	, bAcceptsContracts(true)
 	, TradeFrequency(5)
+	, bUseTraderScheduler(true)
 	, CurrentLocation(nullptr)
 	, TotalProfit(0)
 	, SuccessfulTrades(0)
 	, UpdateTimer(0.0f)
+	, NextTourStop(0)
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.TickInterval = 1.0f; // Update every second
 }
 
+void UAITraderComponent::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildCargoHold();
+}
+
+void UAITraderComponent::PostDuplicate(bool bDuplicateForPIE)
+{
+	Super::PostDuplicate(bDuplicateForPIE);
+
+	RebuildCargoHold();
+}
+
+void UAITraderComponent::RebuildCargoHold()
+{
+	CargoHold.Reset();
+	for (const FAITraderInventory& Lot : Inventory)
+	{
+		CargoHold.Add(Lot.TradeItem, Lot.Quantity);
+	}
+}
+
 void UAITraderComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Inventory may have been restored without going through ExecuteTrade
+	RebuildCargoHold();
+
+	// Hand decision updates to the shared scheduler when one is running
+	if (bUseTraderScheduler)
+	{
+		UWorld* World = GetWorld();
+		if (UAITraderSchedulerSubsystem* Scheduler = World ? World->GetSubsystem<UAITraderSchedulerSubsystem>() : nullptr)
+		{
+			Scheduler->RegisterTrader(this);
+			SetComponentTickEnabled(false);
+		}
+	}
+}
+
+void UAITraderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UWorld* World = GetWorld();
+	if (UAITraderSchedulerSubsystem* Scheduler = World ? World->GetSubsystem<UAITraderSchedulerSubsystem>() : nullptr)
+	{
+		Scheduler->UnregisterTrader(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UAITraderComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -38,8 +119,7 @@ void UAITraderComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 	UpdateTimer += DeltaTime;
 	
 	// Update trader logic every few seconds based on trade frequency
-	float UpdateInterval = 3600.0f / FMath::Max(1, TradeFrequency); // Convert frequency to seconds
-	if (UpdateTimer >= UpdateInterval)
+	if (UpdateTimer >= GetUpdateInterval())
 	{
 		UpdateTrader(UpdateTimer);
 		UpdateTimer = 0.0f;
@@ -64,13 +144,91 @@ void UAITraderComponent::UpdateTrader(float DeltaTime)
 		return;
 	}
 
+	FAITraderDecisionContext Context;
+	Context.Arbitrage = GetArbitrageSubsystem();
+	Context.MarketStates = GetMarketStates();
+	Context.CaptureMarket(CurrentLocation);
+
+	FAITraderDecision Decision;
+	EvaluateDecisions(Context, Decision);
+	ApplyDecision(Decision);
+}
+
+float UAITraderComponent::GetUpdateInterval() const
+{
+	return 3600.0f / FMath::Max(1, TradeFrequency); // Convert frequency to seconds
+}
+
+void UAITraderComponent::EvaluateDecisions(const FAITraderDecisionContext& Context, FAITraderDecision& OutDecision) const
+{
+	OutDecision.Reset();
+	if (!CurrentLocation)
+	{
+		return;
+	}
+
 	// Execute different AI behaviors based on enabled behaviors
-	MakeTradeDecisions();
-	OptimizeTradeRoutes();
-	ManageInventory();
+	// Inventory first so sells are applied before buys and free up capital and cargo
+	ManageInventory(Context, OutDecision);
+	MakeTradeDecisions(Context, OutDecision);
+	OptimizeTradeRoutes(Context, OutDecision);
+}
+
+void UAITraderComponent::ApplyDecision(const FAITraderDecision& Decision)
+{
+	if (Decision.bUpdateRoutes)
+	{
+		ActiveRoutes = Decision.Routes;
+	}
+
+	// ExecuteTrade re-validates every intent against live prices, capital and cargo
+	for (const FAITradeIntent& Intent : Decision.Intents)
+	{
+		ExecuteTrade(Intent.TradeItem, Intent.Quantity, Intent.bIsBuying);
+	}
+
+	// Trade here first, then move on to the next contract stop
+	AdvanceContractTour();
 }
 
-TArray<FTradeRoute> UAITraderComponent::FindBestTradeRoutes(int32 MaxRoutes)
+TArray<FTradeRoute> UAITraderComponent::FindBestTradeRoutes(const FAITraderDecisionContext& Context, int32 MaxRoutes) const
+{
+	const UTradeArbitrageSubsystem* Arbitrage = Context.Arbitrage;
+	if (!Arbitrage || Arbitrage->GetTrackedMarketCount() == 0)
+	{
+		return Context.bAllowGameThreadReads ? FindBestTradeRoutesLocal(MaxRoutes) : TArray<FTradeRoute>();
+	}
+
+	// Shared index returns the best route per item under our constraints
+	FArbitrageRouteFilter Filter;
+	Filter.bRestrictToAllowedMarkets = true;
+	Filter.AllowedMarkets = KnownMarkets;
+	Filter.MaxBuyPrice = static_cast<float>(TradingCapital);
+	Filter.MinProfitMargin = MinProfitMargin;
+	Filter.IsRouteReachable = [Arbitrage, MaxDistance = MaxRouteDistance](const UMarketDataAsset* Origin, const UMarketDataAsset* Destination)
+	{
+		return Arbitrage->IsMarketInRange(Origin, Destination, MaxDistance);
+	};
+
+	TArray<FTradeRoute> BestRoutes;
+	Arbitrage->FindTopRoutes(MaxRoutes, Filter, BestRoutes);
+
+	// Apply travel-time scoring the same way the local search does
+	for (FTradeRoute& Route : BestRoutes)
+	{
+		Route.Distance = Arbitrage->GetMarketDistance(Route.OriginMarket, Route.DestinationMarket);
+		Route.TravelTime = TravelSpeed > 0.0f ? Route.Distance / TravelSpeed : 0.0f;
+		Route.ProfitabilityScore = Route.TravelTime > 0.0f ? Route.ProfitPerUnit / Route.TravelTime : Route.ProfitPerUnit;
+	}
+
+	BestRoutes.Sort([](const FTradeRoute& A, const FTradeRoute& B) {
+		return A.ProfitabilityScore > B.ProfitabilityScore;
+	});
+
+	return BestRoutes;
+}
+
+TArray<FTradeRoute> UAITraderComponent::FindBestTradeRoutesLocal(int32 MaxRoutes) const
 {
 	TArray<FTradeRoute> BestRoutes;
 	
@@ -84,14 +242,17 @@ TArray<FTradeRoute> UAITraderComponent::FindBestTradeRoutes(int32 MaxRoutes)
 	// Estimate: each market might have profitable routes to 25% of other markets
 	const int32 EstimatedRoutes = FMath::Max(1, (KnownMarkets.Num() * KnownMarkets.Num()) / 4);
 	BestRoutes.Reserve(EstimatedRoutes);
+
+	const FMarketStateTable* States = GetMarketStates();
 	
 	// Cache current location to optimize the most common case
 	if (CurrentLocation)
 	{
 		// Prioritize routes from current location first (most relevant)
-		for (const FMarketInventoryEntry& Entry : CurrentLocation->Inventory)
+		for (int32 EntryIndex = 0; EntryIndex < CurrentLocation->Inventory.Num(); ++EntryIndex)
 		{
-			if (!Entry.TradeItem || !Entry.bInStock)
+			const FMarketInventoryEntry& Entry = CurrentLocation->Inventory[EntryIndex];
+			if (!Entry.TradeItem || !AITraderMarketState::IsInStock(States, CurrentLocation, EntryIndex))
 			{
 				continue;
 			}
@@ -113,15 +274,16 @@ TArray<FTradeRoute> UAITraderComponent::FindBestTradeRoutes(int32 MaxRoutes)
 		}
 
 		// Process only in-stock items to reduce unnecessary calculations
-		for (const FMarketInventoryEntry& Entry : Origin->Inventory)
+		for (int32 EntryIndex = 0; EntryIndex < Origin->Inventory.Num(); ++EntryIndex)
 		{
-			if (!Entry.TradeItem || !Entry.bInStock)
+			const FMarketInventoryEntry& Entry = Origin->Inventory[EntryIndex];
+			if (!Entry.TradeItem || !AITraderMarketState::IsInStock(States, Origin, EntryIndex))
 			{
 				continue;
 			}
 
 			// Calculate arbitrage only if we have enough capital for at least one unit
-			float BuyPrice = Origin->GetItemPrice(Entry.TradeItem, true);
+			float BuyPrice = AITraderMarketState::GetPrice(States, Origin, Entry.TradeItem, true);
 			if (BuyPrice > TradingCapital)
 			{
 				continue;
@@ -133,12 +295,12 @@ TArray<FTradeRoute> UAITraderComponent::FindBestTradeRoutes(int32 MaxRoutes)
 			
 			for (UMarketDataAsset* Destination : KnownMarkets)
 			{
-				if (!Destination || Destination == Origin)
+				if (!Destination || Destination == Origin || !IsRouteInRange(Origin, Destination))
 				{
 					continue;
 				}
 				
-				float SellPrice = Destination->GetItemPrice(Entry.TradeItem, false);
+				float SellPrice = AITraderMarketState::GetPrice(States, Destination, Entry.TradeItem, false);
 				float ProfitPerUnit = SellPrice - BuyPrice;
 				
 				// Skip if not profitable
@@ -154,13 +316,7 @@ TArray<FTradeRoute> UAITraderComponent::FindBestTradeRoutes(int32 MaxRoutes)
 					continue;
 				}
 				
-				// Simplified distance calculation using name hash as placeholder
-				// TODO: Replace with actual market world positions when available
-				// For now, this provides consistent relative distances for route prioritization
-				float Distance = FVector::Dist(
-					FVector(static_cast<float>(Origin->GetFName().GetNumber()), 0, 0),
-					FVector(static_cast<float>(Destination->GetFName().GetNumber()), 0, 0)
-				);
+				float Distance = GetMarketDistance(Origin, Destination);
 				float TravelTime = TravelSpeed > 0.0f ? Distance / TravelSpeed : 0.0f;
 				float ProfitabilityScore = TravelTime > 0.0f ? ProfitPerUnit / TravelTime : ProfitPerUnit;
 				
@@ -180,14 +336,11 @@ TArray<FTradeRoute> UAITraderComponent::FindBestTradeRoutes(int32 MaxRoutes)
 				Route.DestinationMarket = BestDestination;
 				Route.TradeItem = Entry.TradeItem;
 				
-				float RouteBuyPrice = Origin->GetItemPrice(Entry.TradeItem, true);
-				float RouteSellPrice = BestDestination->GetItemPrice(Entry.TradeItem, false);
+				float RouteBuyPrice = AITraderMarketState::GetPrice(States, Origin, Entry.TradeItem, true);
+				float RouteSellPrice = AITraderMarketState::GetPrice(States, BestDestination, Entry.TradeItem, false);
 				Route.ProfitPerUnit = RouteSellPrice - RouteBuyPrice;
 				
-				Route.Distance = FVector::Dist(
-					FVector(static_cast<float>(Origin->GetFName().GetNumber()), 0, 0),
-					FVector(static_cast<float>(BestDestination->GetFName().GetNumber()), 0, 0)
-				);
+				Route.Distance = GetMarketDistance(Origin, BestDestination);
 				Route.TravelTime = TravelSpeed > 0.0f ? Route.Distance / TravelSpeed : 0.0f;
 				Route.ProfitabilityScore = BestProfitability;
 				
@@ -208,7 +361,7 @@ TArray<FTradeRoute> UAITraderComponent::FindBestTradeRoutes(int32 MaxRoutes)
 	return BestRoutes;
 }
 
-FTradeRoute UAITraderComponent::CalculateArbitrageOpportunity(UTradeItemDataAsset* TradeItem)
+FTradeRoute UAITraderComponent::CalculateArbitrageOpportunity(UTradeItemDataAsset* TradeItem) const
 {
 	FTradeRoute BestRoute;
 	
@@ -218,20 +371,21 @@ FTradeRoute UAITraderComponent::CalculateArbitrageOpportunity(UTradeItemDataAsse
 	}
 
 	float BestProfit = 0.0f;
+	const FMarketStateTable* States = GetMarketStates();
 	
 	// Check each destination market
 	for (UMarketDataAsset* DestMarket : KnownMarkets)
 	{
-		if (!DestMarket || DestMarket == CurrentLocation)
+		if (!DestMarket || DestMarket == CurrentLocation || !IsRouteInRange(CurrentLocation, DestMarket))
 		{
 			continue;
 		}
 
 		// Get buy price at current location
-		float BuyPrice = CurrentLocation->GetItemPrice(TradeItem, true);
+		float BuyPrice = AITraderMarketState::GetPrice(States, CurrentLocation, TradeItem, true);
 		
 		// Get sell price at destination
-		float SellPrice = DestMarket->GetItemPrice(TradeItem, false);
+		float SellPrice = AITraderMarketState::GetPrice(States, DestMarket, TradeItem, false);
 		
 		// Calculate profit per unit
 		float ProfitPerUnit = SellPrice - BuyPrice;
@@ -242,11 +396,8 @@ FTradeRoute UAITraderComponent::CalculateArbitrageOpportunity(UTradeItemDataAsse
 		// Check if meets minimum profit margin
 		if (ProfitMargin >= MinProfitMargin)
 		{
-			// Calculate travel time (simplified)
-			float Distance = FVector::Dist(
-				FVector(CurrentLocation->GetFName().GetNumber(), 0, 0),
-				FVector(DestMarket->GetFName().GetNumber(), 0, 0)
-			);
+			// Calculate travel time
+			float Distance = GetMarketDistance(CurrentLocation, DestMarket);
 			float TravelTime = TravelSpeed > 0.0f ? Distance / TravelSpeed : 0.0f;
 			
 			// Calculate profitability score (profit per unit / travel time)
@@ -282,7 +433,36 @@ bool UAITraderComponent::ExecuteTrade(UTradeItemDataAsset* TradeItem, int32 Quan
 		return false;
 	}
 
-	float Price = CurrentLocation->GetItemPrice(TradeItem, bIsBuying);
+	// Trades at a registered market go through its primary instance so stock and supply/demand react
+	UEconomyManager* EconomyManager = GetEconomyManager();
+	const FName InstanceID = FMarketStateTable::GetMarketKey(CurrentLocation);
+	const FMarketInstance* Instance = EconomyManager ? EconomyManager->FindMarketInstance(InstanceID) : nullptr;
+	const bool bRecordInEconomy = Instance && Instance->Template == CurrentLocation;
+
+	float Price = 0.0f;
+	if (bRecordInEconomy)
+	{
+		FMarketItemState ItemState;
+		const FMarketInventoryEntry* Entry = CurrentLocation->FindInventoryEntry(TradeItem);
+		if (!Entry || !EconomyManager->GetInstanceItemState(InstanceID, TradeItem, ItemState))
+		{
+			return false;
+		}
+
+		// Buy no more than the market stocks, sell no more than it can hold
+		const int32 StockLimit = bIsBuying ? ItemState.CurrentStock : Entry->MaxStock - ItemState.CurrentStock;
+		Quantity = FMath::Min(Quantity, StockLimit);
+		if (Quantity <= 0)
+		{
+			return false;
+		}
+
+		Price = EconomyManager->GetInstanceItemPrice(InstanceID, TradeItem, bIsBuying);
+	}
+	else
+	{
+		Price = AITraderMarketState::GetPrice(GetMarketStates(), CurrentLocation, TradeItem, bIsBuying);
+	}
 	int32 TotalCost = FMath::RoundToInt(Price * Quantity);
 
 	if (bIsBuying)
@@ -310,6 +490,7 @@ bool UAITraderComponent::ExecuteTrade(UTradeItemDataAsset* TradeItem, int32 Quan
 		NewInventory.PurchasePrice = Price;
 		NewInventory.PurchaseMarket = CurrentLocation;
 		Inventory.Add(NewInventory);
+		CargoHold.Add(TradeItem, Quantity);
 	}
 	else
 	{
@@ -343,10 +524,17 @@ bool UAITraderComponent::ExecuteTrade(UTradeItemDataAsset* TradeItem, int32 Quan
 		{
 			Inventory.RemoveAt(FoundIndex);
 		}
+		CargoHold.Remove(TradeItem, Quantity);
 
 		SuccessfulTrades++;
 	}
 
+	// Also records the trade in the market's price history
+	if (bRecordInEconomy)
+	{
+		EconomyManager->RecordInstanceTransaction(InstanceID, TradeItem, Quantity, bIsBuying);
+	}
+
 	OnTradeExecuted(TradeItem, Quantity, Price, bIsBuying);
 	return true;
 }
@@ -390,8 +578,13 @@ bool UAITraderComponent::AcceptContract(UTradeContractDataAsset* Contract)
 		return false;
 	}
 
-	// Accept the contract
-	if (Contract->AcceptContract(FName(*GetOwner()->GetName()), 0.0f))
+	return ClaimContract(Contract);
+}
+
+bool UAITraderComponent::ClaimContract(UTradeContractDataAsset* Contract)
+{
+	// The time limit runs from now in economy hours, matching the deadlines the tour planner assumes
+	if (Contract && Contract->AcceptContract(FName(*GetOwner()->GetName()), GetGameTime()))
 	{
 		ActiveContracts.Add(Contract);
 		return true;
@@ -457,12 +650,14 @@ float UAITraderComponent::TravelToMarket(UMarketDataAsset* DestinationMarket)
 		return 0.0f;
 	}
 
-	// Calculate travel time using placeholder distance (name hash)
-	// TODO: Replace with actual market world positions when available
-	float Distance = FVector::Dist(
-		FVector(static_cast<float>(CurrentLocation->GetFName().GetNumber()), 0, 0),
-		FVector(static_cast<float>(DestinationMarket->GetFName().GetNumber()), 0, 0)
-	);
+	// Calculate travel time
+	float Distance = GetMarketDistance(CurrentLocation, DestinationMarket);
+	if (Distance == FMarketTravelMatrix::Unreachable)
+	{
+		UE_LOG(LogAdastreaTrading, Warning, TEXT("AITraderComponent: No route from %s to %s"),
+			*CurrentLocation->GetName(), *DestinationMarket->GetName());
+		return -1.0f;
+	}
 	
 	float TravelTime = TravelSpeed > 0.0f ? Distance / TravelSpeed : 0.0f;
 	
@@ -471,34 +666,199 @@ float UAITraderComponent::TravelToMarket(UMarketDataAsset* DestinationMarket)
 	return TravelTime;
 }
 
-float UAITraderComponent::GetCargoUsage() const
+int32 UAITraderComponent::AcceptContractTour(const TArray<UTradeContractDataAsset*>& OpenContracts)
 {
-	float UsedSpace = 0.0f;
-	
-	for (const FAITraderInventory& Item : Inventory)
+	if (!bAcceptsContracts || !CurrentLocation || NextTourStop < ContractTour.Stops.Num())
+	{
+		return 0;
+	}
+
+	TArray<UTradeContractDataAsset*> Available;
+	Available.Reserve(OpenContracts.Num());
+	for (UTradeContractDataAsset* Contract : OpenContracts)
 	{
-		if (Item.TradeItem)
+		if (Contract && Contract->Status == EContractStatus::Available)
 		{
-			UsedSpace += Item.TradeItem->GetTotalVolume(Item.Quantity);
+			Available.Add(Contract);
 		}
 	}
-	
-	return CargoCapacity > 0.0f ? UsedSpace / CargoCapacity : 0.0f;
+
+	if (Available.Num() == 0)
+	{
+		return 0;
+	}
+
+	// Contract locations naming a known market travel along the sector graph; others fly straight
+	TMap<FName, const UMarketDataAsset*> MarketsByID;
+	for (const UMarketDataAsset* Market : KnownMarkets)
+	{
+		if (Market)
+		{
+			MarketsByID.Add(Market->MarketID, Market);
+		}
+	}
+	MarketsByID.Add(CurrentLocation->MarketID, CurrentLocation);
+
+	const UTradeArbitrageSubsystem* Arbitrage = GetArbitrageSubsystem();
+	FContractRoutePlanner Planner;
+	Planner.SetContracts(Available, [&MarketsByID, Arbitrage](const FContractLocation& From, const FContractLocation& To)
+	{
+		const UMarketDataAsset* const* FromMarket = From.MarketID.IsNone() ? nullptr : MarketsByID.Find(From.MarketID);
+		const UMarketDataAsset* const* ToMarket = To.MarketID.IsNone() ? nullptr : MarketsByID.Find(To.MarketID);
+		if (Arbitrage && FromMarket && ToMarket)
+		{
+			const float MarketDistance = Arbitrage->GetMarketDistance(*FromMarket, *ToMarket);
+			if (MarketDistance > 0.0f)
+			{
+				return MarketDistance;
+			}
+		}
+		return FContractRoutePlanner::GetStraightLineDistance(From, To);
+	});
+
+	FContractPlannerTrader Trader;
+	Trader.StartLocation.MarketID = CurrentLocation->MarketID;
+
+	// Deadheads that can't use the sector graph fly straight from where the trader actually is
+	if (const AActor* Owner = GetOwner())
+	{
+		Trader.StartLocation.Coordinates = Owner->GetActorLocation();
+	}
+	Trader.Speed = TravelSpeed;
+	Trader.VolumeCapacity = GetAvailableCargoSpace();
+	if (CargoMassCapacity > 0.0f)
+	{
+		// The planner reads <= 0 as unlimited, so a full hold still gets a (tiny) positive limit
+		Trader.MassCapacity = FMath::Max(CargoMassCapacity - CargoHold.GetUsedMass(), UE_KINDA_SMALL_NUMBER);
+	}
+	Trader.StartTime = GetGameTime();
+
+	FContractTour Tour;
+	Planner.PlanTour(Trader, Tour);
+
+	// The planner already checked capacity and deadlines, so planned contracts skip EvaluateContract
+	TSet<const UTradeContractDataAsset*> Claimed;
+	for (UTradeContractDataAsset* Contract : Tour.Contracts)
+	{
+		if (ClaimContract(Contract))
+		{
+			Claimed.Add(Contract);
+		}
+	}
+
+	// Keep the planned stop order, dropping stops of any contract that could not be claimed
+	ContractTour = MoveTemp(Tour);
+	NextTourStop = 0;
+	if (Claimed.Num() != ContractTour.Contracts.Num())
+	{
+		ContractTour.Stops.RemoveAll([&Claimed](const FContractTourStop& Stop) { return !Claimed.Contains(Stop.Contract); });
+		ContractTour.Contracts.RemoveAll([&Claimed](const UTradeContractDataAsset* Contract) { return !Claimed.Contains(Contract); });
+	}
+
+	UE_LOG(LogAdastreaTrading, Verbose, TEXT("AITraderComponent: Planned %d-stop contract tour (%.1f h), accepted %d contracts"),
+		ContractTour.Stops.Num(), ContractTour.TravelHours, Claimed.Num());
+	return Claimed.Num();
 }
 
-float UAITraderComponent::GetAvailableCargoSpace() const
+void UAITraderComponent::AdvanceContractTour()
 {
-	float UsedSpace = 0.0f;
-	
-	for (const FAITraderInventory& Item : Inventory)
+	if (NextTourStop >= ContractTour.Stops.Num())
+	{
+		return;
+	}
+
+	const FContractTourStop Stop = ContractTour.Stops[NextTourStop++];
+	if (NextTourStop == ContractTour.Stops.Num())
+	{
+		ContractTour.Reset();
+		NextTourStop = 0;
+	}
+
+	UTradeContractDataAsset* Contract = Stop.Contract;
+	if (!Contract || !ActiveContracts.Contains(Contract))
 	{
-		if (Item.TradeItem)
+		return;
+	}
+
+	// Stops at a known market move the trader there; other stops are reached by flying straight
+	const FContractLocation& Location = Stop.Type == EContractStopType::Pickup ? Contract->OriginLocation : Contract->DestinationLocation;
+	if (!Location.MarketID.IsNone())
+	{
+		for (UMarketDataAsset* Market : KnownMarkets)
 		{
-			UsedSpace += Item.TradeItem->GetTotalVolume(Item.Quantity);
+			if (Market && Market != CurrentLocation && Market->MarketID == Location.MarketID)
+			{
+				TravelToMarket(Market);
+				break;
+			}
 		}
 	}
-	
-	return FMath::Max(0.0f, CargoCapacity - UsedSpace);
+
+	if (Stop.Type != EContractStopType::Delivery)
+	{
+		return;
+	}
+
+	ActiveContracts.Remove(Contract);
+	if (Contract->CompleteContract(GetGameTime()))
+	{
+		const int32 Reward = Contract->Rewards.Credits;
+		TradingCapital += Reward;
+		TotalProfit += Reward;
+		OnContractCompleted(Contract, Reward);
+	}
+}
+
+float UAITraderComponent::GetGameTime() const
+{
+	const UEconomyManager* EconomyManager = GetEconomyManager();
+	return EconomyManager ? EconomyManager->GetGameTime() : 0.0f;
+}
+
+float UAITraderComponent::GetMarketDistance(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination) const
+{
+	if (!Origin || !Destination)
+	{
+		return 0.0f;
+	}
+
+	const UTradeArbitrageSubsystem* Arbitrage = GetArbitrageSubsystem();
+	return Arbitrage ? Arbitrage->GetMarketDistance(Origin, Destination) : 0.0f;
+}
+
+bool UAITraderComponent::IsRouteInRange(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination) const
+{
+	const UTradeArbitrageSubsystem* Arbitrage = GetArbitrageSubsystem();
+	return !Arbitrage || Arbitrage->IsMarketInRange(Origin, Destination, MaxRouteDistance);
+}
+
+UTradeArbitrageSubsystem* UAITraderComponent::GetArbitrageSubsystem() const
+{
+	UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UTradeArbitrageSubsystem>() : nullptr;
+}
+
+UEconomyManager* UAITraderComponent::GetEconomyManager() const
+{
+	const UWorld* World = GetWorld();
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UEconomyManager>() : nullptr;
+}
+
+const FMarketStateTable* UAITraderComponent::GetMarketStates() const
+{
+	const UEconomyManager* EconomyManager = GetEconomyManager();
+	return EconomyManager ? &EconomyManager->GetMarketStates() : nullptr;
+}
+
+float UAITraderComponent::GetCargoUsage() const
+{
+	return CargoCapacity > 0.0f ? CargoHold.GetUsedVolume() / CargoCapacity : 0.0f;
+}
+
+float UAITraderComponent::GetAvailableCargoSpace() const
+{
+	return CargoHold.GetAvailableVolume(CargoCapacity);
 }
 
 bool UAITraderComponent::IsBehaviorEnabled(EAITradeBehavior Behavior) const
@@ -537,7 +897,7 @@ void UAITraderComponent::OnContractCompleted_Implementation(UTradeContractDataAs
 }
 
 // Private helper functions
-void UAITraderComponent::MakeTradeDecisions()
+void UAITraderComponent::MakeTradeDecisions(const FAITraderDecisionContext& Context, FAITraderDecision& OutDecision) const
 {
 	if (!CurrentLocation)
 	{
@@ -551,8 +911,42 @@ void UAITraderComponent::MakeTradeDecisions()
 			// Look for high-risk, high-reward opportunities
 			if (IsBehaviorEnabled(EAITradeBehavior::Arbitrage))
 			{
-				TArray<FTradeRoute> Routes = FindBestTradeRoutes(3);
-				// Execute top routes
+				// Execute top routes that start here, within remaining capital and cargo space
+				float RemainingCapital = static_cast<float>(TradingCapital);
+				float RemainingCargo = GetAvailableCargoSpace();
+
+				for (const FTradeRoute& Route : FindBestTradeRoutes(Context, 3))
+				{
+					if (Route.OriginMarket != CurrentLocation || !Route.TradeItem)
+					{
+						continue;
+					}
+
+					const FAITraderItemQuote* Quote = Context.FindQuote(CurrentLocation, Route.TradeItem);
+					if (!Quote || !Quote->bInStock || Quote->BuyPrice <= 0.0f)
+					{
+						continue;
+					}
+
+					int32 Quantity = FMath::FloorToInt(RemainingCapital / Quote->BuyPrice);
+					const float UnitVolume = Route.TradeItem->GetTotalVolume(1);
+					if (UnitVolume > 0.0f)
+					{
+						Quantity = FMath::Min(Quantity, FMath::FloorToInt(RemainingCargo / UnitVolume));
+					}
+					if (Quantity <= 0)
+					{
+						continue;
+					}
+
+					FAITradeIntent& Intent = OutDecision.Intents.AddDefaulted_GetRef();
+					Intent.TradeItem = Route.TradeItem;
+					Intent.Quantity = Quantity;
+					Intent.bIsBuying = true;
+
+					RemainingCapital -= Quote->BuyPrice * Quantity;
+					RemainingCargo -= UnitVolume * Quantity;
+				}
 			}
 			break;
 
@@ -577,7 +971,7 @@ void UAITraderComponent::MakeTradeDecisions()
 	}
 }
 
-void UAITraderComponent::OptimizeTradeRoutes()
+void UAITraderComponent::OptimizeTradeRoutes(const FAITraderDecisionContext& Context, FAITraderDecision& OutDecision) const
 {
 	if (!IsBehaviorEnabled(EAITradeBehavior::RoutePlanning))
 	{
@@ -585,11 +979,70 @@ void UAITraderComponent::OptimizeTradeRoutes()
 	}
 
 	// Find and update best trade routes
-	ActiveRoutes = FindBestTradeRoutes(10);
+	OutDecision.Routes = FindBestTradeRoutes(Context, 10);
+	OutDecision.bUpdateRoutes = true;
+}
+
+void UAITraderComponent::ManageInventory(const FAITraderDecisionContext& Context, FAITraderDecision& OutDecision) const
+{
+	// Sell cargo bought elsewhere once this market pays at least the minimum margin
+	for (const FAITraderInventory& Item : Inventory)
+	{
+		if (!Item.TradeItem || Item.Quantity <= 0 || Item.PurchaseMarket == CurrentLocation)
+		{
+			continue;
+		}
+
+		const FAITraderItemQuote* Quote = Context.FindQuote(CurrentLocation, Item.TradeItem);
+		if (!Quote || Quote->SellPrice < Item.PurchasePrice * (1.0f + MinProfitMargin))
+		{
+			continue;
+		}
+
+		FAITradeIntent& Intent = OutDecision.Intents.AddDefaulted_GetRef();
+		Intent.TradeItem = Item.TradeItem;
+		Intent.Quantity = Item.Quantity;
+		Intent.bIsBuying = false;
+	}
+}
+
+// ====================
+// FAITraderDecisionContext
+// ====================
+
+void FAITraderDecisionContext::CaptureMarket(const UMarketDataAsset* Market)
+{
+	if (!Market || Quotes.Contains(Market))
+	{
+		return;
+	}
+
+	TMap<const UTradeItemDataAsset*, FAITraderItemQuote>& MarketQuotes = Quotes.Add(Market);
+	MarketQuotes.Reserve(Market->Inventory.Num());
+
+	// Quote from the live state rows so decisions see what players trade against
+	for (int32 Index = 0; Index < Market->Inventory.Num(); ++Index)
+	{
+		UTradeItemDataAsset* Item = Market->Inventory[Index].TradeItem;
+		if (!Item || MarketQuotes.Contains(Item))
+		{
+			continue;
+		}
+
+		FAITraderItemQuote& Quote = MarketQuotes.Add(Item);
+		Quote.BuyPrice = AITraderMarketState::GetPrice(MarketStates, Market, Item, true);
+		Quote.SellPrice = AITraderMarketState::GetPrice(MarketStates, Market, Item, false);
+		Quote.bInStock = AITraderMarketState::IsInStock(MarketStates, Market, Index);
+	}
+}
+
+const FAITraderItemQuote* FAITraderDecisionContext::FindQuote(const UMarketDataAsset* Market, const UTradeItemDataAsset* Item) const
+{
+	const TMap<const UTradeItemDataAsset*, FAITraderItemQuote>* MarketQuotes = Quotes.Find(Market);
+	return MarketQuotes ? MarketQuotes->Find(Item) : nullptr;
 }
 
-void UAITraderComponent::ManageInventory()
+void FAITraderDecisionContext::Reset()
 {
-	// Sell old inventory, manage cargo space
-	// Remove items that have been held too long
+	Quotes.Reset();
 }
@@ -0,0 +1,214 @@
+#include "Trading/AITraderSchedulerSubsystem.h"
+#include "Trading/TradeArbitrageSubsystem.h"
+#include "Trading/EconomyManager.h"
+#include "Async/ParallelFor.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "AdastreaLog.h"
+
+UAITraderSchedulerSubsystem::UAITraderSchedulerSubsystem()
+	: Cursor(0)
+	, FrameBudgetMs(2.0f)
+	, BatchSize(256)
+	, bParallelEvaluation(true)
+	, bProcessing(false)
+	, bNeedsCompaction(false)
+	, LastFrameUpdateCount(0)
+	, LastFrameTimeMs(0.0f)
+	, bLastFrameRolledOver(false)
+{
+}
+
+bool UAITraderSchedulerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAITraderSchedulerSubsystem::Deinitialize()
+{
+	Traders.Reset();
+	NextUpdateTimes.Reset();
+	Context.Reset();
+	Cursor = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UAITraderSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAITraderSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+void UAITraderSchedulerSubsystem::RegisterTrader(UAITraderComponent* Trader)
+{
+	if (!Trader || Traders.Contains(Trader))
+	{
+		return;
+	}
+
+	// First update after one full interval, like the component's own tick
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	Traders.Add(Trader);
+	NextUpdateTimes.Add(Now + Trader->GetUpdateInterval());
+}
+
+void UAITraderSchedulerSubsystem::UnregisterTrader(UAITraderComponent* Trader)
+{
+	const int32 Index = Traders.Find(Trader);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// A trade applied mid-frame may destroy its owner; keep indices stable until the frame ends
+	if (bProcessing)
+	{
+		Traders[Index] = nullptr;
+		bNeedsCompaction = true;
+		return;
+	}
+
+	Traders.RemoveAt(Index);
+	NextUpdateTimes.RemoveAt(Index);
+	if (Index < Cursor)
+	{
+		--Cursor;
+	}
+}
+
+void UAITraderSchedulerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	LastFrameUpdateCount = 0;
+	bLastFrameRolledOver = false;
+
+	const UWorld* World = GetWorld();
+	if (!World || Traders.Num() == 0)
+	{
+		LastFrameTimeMs = 0.0f;
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = FrameBudgetMs / 1000.0;
+	const double Now = World->GetTimeSeconds();
+
+	// Worker threads may only read the shared index and travel matrix, so flush lazy rebuilds first
+	const UTradeArbitrageSubsystem* Arbitrage = World->GetSubsystem<UTradeArbitrageSubsystem>();
+	const UGameInstance* GameInstance = World->GetGameInstance();
+	const UEconomyManager* EconomyManager = GameInstance ? GameInstance->GetSubsystem<UEconomyManager>() : nullptr;
+	const bool bParallel = bParallelEvaluation && Arbitrage && Arbitrage->GetTrackedMarketCount() > 0;
+	if (Arbitrage)
+	{
+		Arbitrage->GetTravelMatrix().UpdateIfDirty();
+	}
+	Context.Arbitrage = Arbitrage;
+	Context.MarketStates = EconomyManager ? &EconomyManager->GetMarketStates() : nullptr;
+	Context.bAllowGameThreadReads = !bParallel;
+
+	bProcessing = true;
+
+	const int32 NumTraders = Traders.Num();
+	Cursor = Cursor % NumTraders;
+	int32 Scanned = 0;
+
+	while (Scanned < NumTraders)
+	{
+		// Collect the next batch of due traders in round-robin order
+		Batch.Reset();
+		Context.Reset();
+		while (Batch.Num() < BatchSize && Scanned < NumTraders)
+		{
+			const int32 Index = Cursor;
+			Cursor = (Cursor + 1) % NumTraders;
+			++Scanned;
+
+			UAITraderComponent* Trader = Traders[Index];
+			if (!Trader || Now < NextUpdateTimes[Index])
+			{
+				continue;
+			}
+
+			Batch.Add(Index);
+			Context.CaptureMarket(Trader->CurrentLocation);
+		}
+
+		if (Batch.Num() > 0)
+		{
+			ProcessBatch(Now, bParallel);
+			LastFrameUpdateCount += Batch.Num();
+		}
+
+		if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			bLastFrameRolledOver = Scanned < NumTraders;
+			break;
+		}
+	}
+
+	bProcessing = false;
+	Context.Reset();
+
+	if (bNeedsCompaction)
+	{
+		CompactTraders();
+	}
+
+	LastFrameTimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	UE_LOG(LogAdastreaTrading, VeryVerbose, TEXT("AITraderScheduler: Updated %d/%d traders in %.3f ms%s"),
+		LastFrameUpdateCount, NumTraders, LastFrameTimeMs, bLastFrameRolledOver ? TEXT(" (rolled over)") : TEXT(""));
+}
+
+void UAITraderSchedulerSubsystem::ProcessBatch(double Now, bool bParallel)
+{
+	Decisions.SetNum(Batch.Num(), EAllowShrinking::No);
+
+	// Decision phase: read-only, one output slot per trader
+	ParallelFor(Batch.Num(), [this](int32 BatchIndex)
+	{
+		Traders[Batch[BatchIndex]]->EvaluateDecisions(Context, Decisions[BatchIndex]);
+	}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+	// Apply phase: serial, in round-robin order
+	for (int32 BatchIndex = 0; BatchIndex < Batch.Num(); ++BatchIndex)
+	{
+		const int32 TraderIndex = Batch[BatchIndex];
+		UAITraderComponent* Trader = Traders[TraderIndex];
+		if (!Trader)
+		{
+			continue;
+		}
+
+		Trader->ApplyDecision(Decisions[BatchIndex]);
+		NextUpdateTimes[TraderIndex] = Now + Trader->GetUpdateInterval();
+	}
+}
+
+void UAITraderSchedulerSubsystem::CompactTraders()
+{
+	int32 WriteIndex = 0;
+	int32 NewCursor = 0;
+	for (int32 ReadIndex = 0; ReadIndex < Traders.Num(); ++ReadIndex)
+	{
+		if (ReadIndex == Cursor)
+		{
+			NewCursor = WriteIndex;
+		}
+
+		if (Traders[ReadIndex])
+		{
+			Traders[WriteIndex] = Traders[ReadIndex];
+			NextUpdateTimes[WriteIndex] = NextUpdateTimes[ReadIndex];
+			++WriteIndex;
+		}
+	}
+
+	Traders.SetNum(WriteIndex);
+	NextUpdateTimes.SetNum(WriteIndex);
+	Cursor = NewCursor;
+	bNeedsCompaction = false;
+}
@@ -7,6 +7,39 @@ UCargoComponent::UCargoComponent()
 	CargoCapacity = 10.0f;  // Default 10 units
 }
 
+void UCargoComponent::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildCargoHold();
+}
+
+void UCargoComponent::PostDuplicate(bool bDuplicateForPIE)
+{
+	Super::PostDuplicate(bDuplicateForPIE);
+
+	RebuildCargoHold();
+}
+
+void UCargoComponent::RebuildCargoHold()
+{
+	CargoHold.Reset();
+	for (const FCargoEntry& Entry : CargoInventory)
+	{
+		CargoHold.Add(Entry.Item, Entry.Quantity);
+	}
+
+	// Drop empty entries and merge duplicates so entries line up with hold slots again
+	if (CargoInventory.Num() != CargoHold.Num())
+	{
+		CargoInventory.Reset(CargoHold.Num());
+		for (int32 Slot = 0; Slot < CargoHold.Num(); ++Slot)
+		{
+			CargoInventory.Add(FCargoEntry(CargoHold.GetItem(Slot), CargoHold.GetSlotQuantity(Slot)));
+		}
+	}
+}
+
 bool UCargoComponent::AddCargo(UTradeItemDataAsset* Item, int32 Quantity)
 {
 	if (!Item || Quantity <= 0)
@@ -22,17 +55,14 @@ bool UCargoComponent::AddCargo(UTradeItemDataAsset* Item, int32 Quantity)
 		return false;
 	}
 
-	// Find existing entry or create new one
-	int32 EntryIndex = FindCargoEntryIndex(Item);
-
-	if (EntryIndex != INDEX_NONE)
+	// Stack onto the item's slot, or open a new one
+	const int32 Slot = CargoHold.Add(Item, Quantity);
+	if (CargoInventory.IsValidIndex(Slot))
 	{
-		// Add to existing entry
-		CargoInventory[EntryIndex].Quantity += Quantity;
+		CargoInventory[Slot].Quantity += Quantity;
 	}
 	else
 	{
-		// Create new entry
 		CargoInventory.Add(FCargoEntry(Item, Quantity));
 	}
 
@@ -62,17 +92,14 @@ bool UCargoComponent::RemoveCargo(UTradeItemDataAsset* Item, int32 Quantity)
 		return false;
 	}
 
-	// Find entry
-	int32 EntryIndex = FindCargoEntryIndex(Item);
-
-	if (EntryIndex != INDEX_NONE)
+	// Slot is dropped once its quantity reaches zero; the entry follows it
+	const int32 Slot = CargoHold.FindSlot(Item);
+	if (CargoHold.Remove(Item, Quantity))
 	{
-		CargoInventory[EntryIndex].Quantity -= Quantity;
-
-		// Remove entry if quantity is now zero
-		if (CargoInventory[EntryIndex].Quantity <= 0)
+		CargoInventory[Slot].Quantity -= Quantity;
+		if (CargoInventory[Slot].Quantity == 0)
 		{
-			CargoInventory.RemoveAt(EntryIndex);
+			CargoInventory.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
 		}
 
 		UE_LOG(LogTemp, Log, TEXT("CargoComponent: Removed %d x %s (remaining: %d, available space: %.1f)"), 
@@ -90,24 +117,15 @@ bool UCargoComponent::RemoveCargo(UTradeItemDataAsset* Item, int32 Quantity)
 
 void UCargoComponent::ClearCargo()
 {
-	CargoInventory.Empty();
+	CargoInventory.Reset();
+	CargoHold.Reset();
 	UE_LOG(LogTemp, Log, TEXT("CargoComponent: Cleared all cargo"));
 	OnCargoSpaceChanged.Broadcast(GetAvailableCargoSpace());
 }
 
 float UCargoComponent::GetAvailableCargoSpace() const
 {
-	float UsedSpace = 0.0f;
-
-	for (const FCargoEntry& Entry : CargoInventory)
-	{
-		if (Entry.Item)
-		{
-			UsedSpace += Entry.Item->GetTotalVolume(Entry.Quantity);
-		}
-	}
-
-	return FMath::Max(0.0f, CargoCapacity - UsedSpace);
+	return CargoHold.GetAvailableVolume(CargoCapacity);
 }
 
 bool UCargoComponent::HasSpaceFor(UTradeItemDataAsset* Item, int32 Quantity) const
@@ -118,40 +136,15 @@ bool UCargoComponent::HasSpaceFor(UTradeItemDataAsset* Item, int32 Quantity) con
 	}
 
 	float RequiredSpace = Item->GetTotalVolume(Quantity);
-	return GetAvailableCargoSpace() >= RequiredSpace;
+	return CargoHold.CanFit(RequiredSpace, CargoCapacity);
 }
 
-int32 UCargoComponent::GetItemQuantity(UTradeItemDataAsset* Item) const
+bool UCargoComponent::HasSpaceForAll(const TMap<UTradeItemDataAsset*, int32>& Items) const
 {
-	if (!Item)
-	{
-		return 0;
-	}
-
-	int32 EntryIndex = FindCargoEntryIndex(Item);
-	
-	if (EntryIndex != INDEX_NONE)
-	{
-		return CargoInventory[EntryIndex].Quantity;
-	}
-
-	return 0;
+	return CargoHold.CanFitAll(Items, CargoCapacity);
 }
 
-int32 UCargoComponent::FindCargoEntryIndex(UTradeItemDataAsset* Item) const
+int32 UCargoComponent::GetItemQuantity(UTradeItemDataAsset* Item) const
 {
-	if (!Item)
-	{
-		return INDEX_NONE;
-	}
-
-	for (int32 i = 0; i < CargoInventory.Num(); ++i)
-	{
-		if (CargoInventory[i].Item == Item)
-		{
-			return i;
-		}
-	}
-
-	return INDEX_NONE;
+	return CargoHold.GetQuantity(Item);
 }
@@ -0,0 +1,102 @@
+#include "Trading/CargoHold.h"
+#include "Trading/TradeItemDataAsset.h"
+
+int32 FCargoHold::Add(UTradeItemDataAsset* Item, int32 Quantity)
+{
+	if (!Item || Quantity <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 Slot = FindSlot(Item);
+	if (Slot == INDEX_NONE)
+	{
+		Slot = Items.Add(Item);
+		Quantities.Add(0);
+		UnitVolumes.Add(Item->VolumePerUnit);
+		UnitMasses.Add(Item->MassPerUnit);
+		SlotByItem.Add(Item, Slot);
+	}
+
+	Quantities[Slot] += Quantity;
+	UsedVolume += static_cast<double>(UnitVolumes[Slot]) * Quantity;
+	UsedMass += static_cast<double>(UnitMasses[Slot]) * Quantity;
+	return Slot;
+}
+
+bool FCargoHold::Remove(const UTradeItemDataAsset* Item, int32 Quantity)
+{
+	const int32 Slot = FindSlot(Item);
+	if (Slot == INDEX_NONE || Quantity <= 0 || Quantities[Slot] < Quantity)
+	{
+		return false;
+	}
+
+	Quantities[Slot] -= Quantity;
+	UsedVolume -= static_cast<double>(UnitVolumes[Slot]) * Quantity;
+	UsedMass -= static_cast<double>(UnitMasses[Slot]) * Quantity;
+
+	if (Quantities[Slot] == 0)
+	{
+		SlotByItem.Remove(Item);
+
+		const int32 LastSlot = Items.Num() - 1;
+		if (Slot != LastSlot)
+		{
+			SlotByItem[Items[LastSlot]] = Slot;
+		}
+		Items.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+		Quantities.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+		UnitVolumes.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+		UnitMasses.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	}
+
+	// An empty hold is exactly empty, whatever rounding the totals picked up
+	if (Items.Num() == 0)
+	{
+		UsedVolume = 0.0;
+		UsedMass = 0.0;
+	}
+	return true;
+}
+
+void FCargoHold::Reset()
+{
+	Items.Reset();
+	Quantities.Reset();
+	UnitVolumes.Reset();
+	UnitMasses.Reset();
+	SlotByItem.Reset();
+	UsedVolume = 0.0;
+	UsedMass = 0.0;
+}
+
+int32 FCargoHold::FindSlot(const UTradeItemDataAsset* Item) const
+{
+	const int32* Slot = Item ? SlotByItem.Find(Item) : nullptr;
+	return Slot ? *Slot : INDEX_NONE;
+}
+
+int32 FCargoHold::GetQuantity(const UTradeItemDataAsset* Item) const
+{
+	const int32 Slot = FindSlot(Item);
+	return Slot != INDEX_NONE ? Quantities[Slot] : 0;
+}
+
+bool FCargoHold::CanFitAll(const TMap<UTradeItemDataAsset*, int32>& Batch, float VolumeCapacity) const
+{
+	return CanFit(GetBatchVolume(Batch), VolumeCapacity);
+}
+
+float FCargoHold::GetBatchVolume(const TMap<UTradeItemDataAsset*, int32>& Batch)
+{
+	float Volume = 0.0f;
+	for (const TPair<UTradeItemDataAsset*, int32>& Entry : Batch)
+	{
+		if (Entry.Key && Entry.Value > 0)
+		{
+			Volume += Entry.Key->GetTotalVolume(Entry.Value);
+		}
+	}
+	return Volume;
+}
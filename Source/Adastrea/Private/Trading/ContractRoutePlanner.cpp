@@ -0,0 +1,572 @@
+#include "Trading/ContractRoutePlanner.h"
+#include "Trading/TradeItemDataAsset.h"
+#include "Algo/Reverse.h"
+
+namespace ContractRoutePlanning
+{
+	/** Node index standing for the trader's start location */
+	constexpr int32 StartNode = INDEX_NONE;
+
+	/** Node index standing for the open end of the tour (no return leg) */
+	constexpr int32 EndNode = -2;
+
+	/** Improvement a 2-opt move must make, so float noise cannot cycle */
+	constexpr float MinImprovement = 1.0e-3f;
+
+	/** 2-opt passes per tour; tours are short so this is rarely reached */
+	constexpr int32 MaxTwoOptPasses = 4;
+
+	/** Stop code: tour slot of the contract, and whether it is the delivery */
+	FORCEINLINE int32 MakeStop(int32 Slot, bool bDelivery) { return Slot * 2 + (bDelivery ? 1 : 0); }
+	FORCEINLINE int32 GetStopSlot(int32 Stop) { return Stop >> 1; }
+	FORCEINLINE bool IsDelivery(int32 Stop) { return (Stop & 1) != 0; }
+}
+
+// ====================
+// FContractTour
+// ====================
+
+void FContractTour::Reset()
+{
+	Stops.Reset();
+	Contracts.Reset();
+	TravelHours = 0.0f;
+	TotalReward = 0;
+}
+
+// ====================
+// FTourState
+// ====================
+
+/**
+ * One trader's tour while it is being built
+ * Positions are 1-based (position 0 is the start); Stops[Position - 1] is the stop at a position.
+ */
+struct FContractRoutePlanner::FTourState
+{
+	FTourState(const FContractRoutePlanner& InPlanner, const FContractPlannerTrader& InTrader)
+		: Planner(InPlanner)
+		, Trader(InTrader)
+		, InvSpeed(InTrader.Speed > 0.0f ? 1.0f / InTrader.Speed : 0.0f)
+	{
+		StartDistances.SetNumUninitialized(Planner.NumNodes);
+		for (int32 Node = 0; Node < Planner.NumNodes; ++Node)
+		{
+			StartDistances[Node] = Planner.DistanceFunction
+				? Planner.DistanceFunction(Trader.StartLocation, Planner.Nodes[Node])
+				: GetStraightLineDistance(Trader.StartLocation, Planner.Nodes[Node]);
+		}
+	}
+
+	float GetDistance(int32 From, int32 To) const
+	{
+		if (To == ContractRoutePlanning::EndNode)
+		{
+			return 0.0f;
+		}
+		return From == ContractRoutePlanning::StartNode ? StartDistances[To] : Planner.GetNodeDistance(From, To);
+	}
+
+	int32 GetStopNode(int32 Stop) const
+	{
+		const FPlannedContract& Contract = Planner.Planned[Slots[ContractRoutePlanning::GetStopSlot(Stop)]];
+		return ContractRoutePlanning::IsDelivery(Stop) ? Contract.DeliveryNode : Contract.PickupNode;
+	}
+
+	/** Node at a position, StartNode for 0 and EndNode past the last stop */
+	int32 GetPositionNode(int32 Position) const
+	{
+		if (Position == 0)
+		{
+			return ContractRoutePlanning::StartNode;
+		}
+		return Position <= Stops.Num() ? GetStopNode(Stops[Position - 1]) : ContractRoutePlanning::EndNode;
+	}
+
+	/**
+	 * Walk a stop sequence checking precedence, capacity and deadlines
+	 * @param OutDistance Total travel distance if feasible
+	 */
+	bool Evaluate(const TArray<int32>& Sequence, float& OutDistance) const
+	{
+		uint32 PickedUp = 0;
+		float Volume = 0.0f;
+		float Mass = 0.0f;
+		float TourDistance = 0.0f;
+		int32 Node = ContractRoutePlanning::StartNode;
+
+		for (const int32 Stop : Sequence)
+		{
+			const int32 Slot = ContractRoutePlanning::GetStopSlot(Stop);
+			const FPlannedContract& Contract = Planner.Planned[Slots[Slot]];
+			const int32 NextNode = GetStopNode(Stop);
+			const float Leg = GetDistance(Node, NextNode);
+			if (Leg >= Unreachable)
+			{
+				return false;
+			}
+			TourDistance += Leg;
+			Node = NextNode;
+
+			if (ContractRoutePlanning::IsDelivery(Stop))
+			{
+				if ((PickedUp & (1u << Slot)) == 0 || Trader.StartTime + TourDistance * InvSpeed > Deadlines[Slot])
+				{
+					return false;
+				}
+				Volume -= Contract.Volume;
+				Mass -= Contract.Mass;
+			}
+			else
+			{
+				PickedUp |= 1u << Slot;
+				Volume += Contract.Volume;
+				Mass += Contract.Mass;
+				if (!FitsCapacity(Volume, Mass))
+				{
+					return false;
+				}
+			}
+		}
+
+		OutDistance = TourDistance;
+		return true;
+	}
+
+	bool FitsCapacity(float Volume, float Mass) const
+	{
+		return Volume <= Trader.VolumeCapacity && (Trader.MassCapacity <= 0.0f || Mass <= Trader.MassCapacity);
+	}
+
+	/** Recompute cached arrival times, loads and deadline slack after the stops changed */
+	void Rebuild()
+	{
+		const int32 NumPositions = Stops.Num() + 1;
+		Arrival.SetNumUninitialized(NumPositions);
+		LoadVolume.SetNumUninitialized(NumPositions);
+		LoadMass.SetNumUninitialized(NumPositions);
+		OwnSlack.SetNumUninitialized(NumPositions);
+		SuffixSlack.SetNumUninitialized(NumPositions + 1);
+
+		Arrival[0] = Trader.StartTime;
+		LoadVolume[0] = 0.0f;
+		LoadMass[0] = 0.0f;
+		OwnSlack[0] = TNumericLimits<float>::Max();
+		TotalDistance = 0.0f;
+
+		for (int32 Position = 1; Position < NumPositions; ++Position)
+		{
+			const int32 Stop = Stops[Position - 1];
+			const int32 Slot = ContractRoutePlanning::GetStopSlot(Stop);
+			const FPlannedContract& Contract = Planner.Planned[Slots[Slot]];
+			const float Leg = GetDistance(GetPositionNode(Position - 1), GetStopNode(Stop));
+
+			TotalDistance += Leg;
+			Arrival[Position] = Arrival[Position - 1] + Leg * InvSpeed;
+
+			const float Sign = ContractRoutePlanning::IsDelivery(Stop) ? -1.0f : 1.0f;
+			LoadVolume[Position] = LoadVolume[Position - 1] + Sign * Contract.Volume;
+			LoadMass[Position] = LoadMass[Position - 1] + Sign * Contract.Mass;
+			OwnSlack[Position] = ContractRoutePlanning::IsDelivery(Stop) ? Deadlines[Slot] - Arrival[Position] : TNumericLimits<float>::Max();
+		}
+
+		SuffixSlack[NumPositions] = TNumericLimits<float>::Max();
+		for (int32 Position = NumPositions - 1; Position >= 0; --Position)
+		{
+			SuffixSlack[Position] = FMath::Min(OwnSlack[Position], SuffixSlack[Position + 1]);
+		}
+	}
+
+	/**
+	 * Cheapest feasible pickup/delivery insertion of a contract
+	 * The pickup goes right after position OutPickupAfter and the delivery right after
+	 * position OutDeliveryAfter (in the current tour; equal means directly after the pickup)
+	 * @return Added distance, or Unreachable if the contract cannot be inserted
+	 */
+	float FindInsertion(const FPlannedContract& Contract, float Deadline, int32& OutPickupAfter, int32& OutDeliveryAfter) const
+	{
+		const int32 NumStops = Stops.Num();
+		const int32 PickupNode = Contract.PickupNode;
+		const int32 DeliveryNode = Contract.DeliveryNode;
+		const float DirectLeg = Planner.GetNodeDistance(PickupNode, DeliveryNode);
+		if (DirectLeg >= Unreachable)
+		{
+			return Unreachable;
+		}
+
+		float BestAdded = Unreachable;
+		for (int32 i = 0; i <= NumStops; ++i)
+		{
+			float MaxVolume = LoadVolume[i];
+			float MaxMass = LoadMass[i];
+			if (!FitsCapacity(MaxVolume + Contract.Volume, MaxMass + Contract.Mass))
+			{
+				continue;
+			}
+
+			const int32 NodeA = GetPositionNode(i);
+			const int32 NodeB = GetPositionNode(i + 1);
+			const float ToPickup = GetDistance(NodeA, PickupNode);
+			if (ToPickup >= Unreachable)
+			{
+				continue;
+			}
+			const float ExistingLeg = GetDistance(NodeA, NodeB);
+
+			// Delivery directly after the pickup
+			{
+				const float FromDelivery = GetDistance(DeliveryNode, NodeB);
+				const float Added = ToPickup + DirectLeg + FromDelivery - ExistingLeg;
+				const float DeliveryArrival = Arrival[i] + (ToPickup + DirectLeg) * InvSpeed;
+				if (FromDelivery < Unreachable && Added < BestAdded
+					&& DeliveryArrival <= Deadline && Added * InvSpeed <= SuffixSlack[i + 1])
+				{
+					BestAdded = Added;
+					OutPickupAfter = i;
+					OutDeliveryAfter = i;
+				}
+			}
+
+			// Delivery later: stops between are delayed by the pickup detour only
+			const float FromPickup = GetDistance(PickupNode, NodeB);
+			if (FromPickup >= Unreachable)
+			{
+				continue;
+			}
+			const float AddedPickup = ToPickup + FromPickup - ExistingLeg;
+			const float PickupDelay = AddedPickup * InvSpeed;
+			float MinSlackBetween = TNumericLimits<float>::Max();
+
+			for (int32 j = i + 1; j <= NumStops; ++j)
+			{
+				MaxVolume = FMath::Max(MaxVolume, LoadVolume[j]);
+				MaxMass = FMath::Max(MaxMass, LoadMass[j]);
+				MinSlackBetween = FMath::Min(MinSlackBetween, OwnSlack[j]);
+
+				// Load, slack and arrival only get worse further along, so stop at the first violation
+				if (!FitsCapacity(MaxVolume + Contract.Volume, MaxMass + Contract.Mass) || PickupDelay > MinSlackBetween)
+				{
+					break;
+				}
+
+				if (Arrival[j] + PickupDelay > Deadline)
+				{
+					break;
+				}
+
+				const int32 NodeC = GetPositionNode(j);
+				const int32 NodeD = GetPositionNode(j + 1);
+				const float ToDelivery = GetDistance(NodeC, DeliveryNode);
+				const float FromDelivery = GetDistance(DeliveryNode, NodeD);
+				if (ToDelivery >= Unreachable || FromDelivery >= Unreachable
+					|| Arrival[j] + PickupDelay + ToDelivery * InvSpeed > Deadline)
+				{
+					continue;
+				}
+
+				const float Added = AddedPickup + ToDelivery + FromDelivery - GetDistance(NodeC, NodeD);
+				if (Added < BestAdded && Added * InvSpeed <= SuffixSlack[j + 1])
+				{
+					BestAdded = Added;
+					OutPickupAfter = i;
+					OutDeliveryAfter = j;
+				}
+			}
+		}
+
+		return BestAdded;
+	}
+
+	void Insert(int32 PlannedIndex, float Deadline, int32 PickupAfter, int32 DeliveryAfter)
+	{
+		const int32 Slot = Slots.Add(PlannedIndex);
+		Deadlines.Add(Deadline);
+
+		Stops.Insert(ContractRoutePlanning::MakeStop(Slot, false), PickupAfter);
+		Stops.Insert(ContractRoutePlanning::MakeStop(Slot, true), DeliveryAfter + 1);
+		Rebuild();
+	}
+
+	/** Reverse segments while that shortens the tour and keeps it feasible */
+	void ImproveTwoOpt()
+	{
+		TArray<int32> Candidate;
+		for (int32 Pass = 0; Pass < ContractRoutePlanning::MaxTwoOptPasses; ++Pass)
+		{
+			bool bImproved = false;
+			for (int32 First = 0; First < Stops.Num() - 1; ++First)
+			{
+				for (int32 Last = First + 1; Last < Stops.Num(); ++Last)
+				{
+					Candidate = Stops;
+					Algo::Reverse(Candidate.GetData() + First, Last - First + 1);
+
+					float CandidateDistance = 0.0f;
+					if (Evaluate(Candidate, CandidateDistance) && CandidateDistance < TotalDistance - ContractRoutePlanning::MinImprovement)
+					{
+						Swap(Stops, Candidate);
+						TotalDistance = CandidateDistance;
+						bImproved = true;
+					}
+				}
+			}
+
+			if (!bImproved)
+			{
+				break;
+			}
+		}
+		Rebuild();
+	}
+
+	const FContractRoutePlanner& Planner;
+	const FContractPlannerTrader& Trader;
+	const float InvSpeed;
+
+	/** Distance from the trader's start to every node */
+	TArray<float> StartDistances;
+
+	/** Planned contract index per tour slot, and its absolute deadline */
+	TArray<int32> Slots;
+	TArray<float> Deadlines;
+
+	/** Stop codes in travel order */
+	TArray<int32> Stops;
+
+	// Per position (0 = start): arrival time, load after the stop, deadline slack of the stop itself
+	TArray<float> Arrival;
+	TArray<float> LoadVolume;
+	TArray<float> LoadMass;
+	TArray<float> OwnSlack;
+
+	/** Smallest OwnSlack from a position to the end (one extra entry past the last stop) */
+	TArray<float> SuffixSlack;
+
+	float TotalDistance = 0.0f;
+};
+
+// ====================
+// FContractRoutePlanner
+// ====================
+
+float FContractRoutePlanner::GetStraightLineDistance(const FContractLocation& From, const FContractLocation& To)
+{
+	return FVector::Dist(From.Coordinates, To.Coordinates);
+}
+
+void FContractRoutePlanner::SetContracts(const TArray<UTradeContractDataAsset*>& Contracts, FDistanceFunction Distance)
+{
+	Reset();
+	DistanceFunction = MoveTemp(Distance);
+
+	Planned.Reserve(Contracts.Num());
+	for (UTradeContractDataAsset* Contract : Contracts)
+	{
+		if (!Contract || ContractToIndex.Contains(Contract)
+			|| (Contract->Status != EContractStatus::Available && Contract->Status != EContractStatus::Active))
+		{
+			continue;
+		}
+
+		FPlannedContract& Entry = Planned.AddDefaulted_GetRef();
+		Entry.Contract = Contract;
+		Entry.PickupNode = FindOrAddNode(Contract->OriginLocation);
+		Entry.DeliveryNode = FindOrAddNode(Contract->DestinationLocation);
+		Entry.Volume = Contract->GetTotalCargoVolume();
+		Entry.Mass = Contract->GetTotalCargoMass();
+		Entry.Reward = Contract->Rewards.Credits;
+		ContractToIndex.Add(Contract, Planned.Num() - 1);
+	}
+
+	NumNodes = Nodes.Num();
+	NodeDistances.SetNumUninitialized(NumNodes * NumNodes);
+	for (int32 From = 0; From < NumNodes; ++From)
+	{
+		for (int32 To = 0; To < NumNodes; ++To)
+		{
+			NodeDistances[From * NumNodes + To] = From == To ? 0.0f
+				: DistanceFunction ? DistanceFunction(Nodes[From], Nodes[To])
+				: GetStraightLineDistance(Nodes[From], Nodes[To]);
+		}
+	}
+}
+
+void FContractRoutePlanner::Reset()
+{
+	Planned.Reset();
+	ContractToIndex.Reset();
+	Nodes.Reset();
+	NodeByMarket.Reset();
+	NodeByCoordinates.Reset();
+	NumNodes = 0;
+	NodeDistances.Reset();
+	DistanceFunction = nullptr;
+}
+
+void FContractRoutePlanner::PlanTour(const FContractPlannerTrader& Trader, FContractTour& OutTour, TBitArray<>* InOutClaimed) const
+{
+	OutTour.Reset();
+
+	const int32 MaxContracts = FMath::Clamp(Trader.MaxContracts, 0, MaxTourContracts);
+	if (Planned.Num() == 0 || MaxContracts == 0 || Trader.Speed <= 0.0f)
+	{
+		return;
+	}
+
+	FTourState Tour(*this, Trader);
+	Tour.Rebuild();
+
+	// Try the best naive reward rates first; contracts that cannot be served even alone are dropped here
+	struct FCandidate
+	{
+		int32 PlannedIndex;
+		float Deadline;
+		float Score;
+	};
+	TArray<FCandidate> Candidates;
+	Candidates.Reserve(Planned.Num());
+
+	for (int32 Index = 0; Index < Planned.Num(); ++Index)
+	{
+		if (InOutClaimed && InOutClaimed->IsValidIndex(Index) && (*InOutClaimed)[Index])
+		{
+			continue;
+		}
+
+		const FPlannedContract& Contract = Planned[Index];
+		if (!Tour.FitsCapacity(Contract.Volume, Contract.Mass))
+		{
+			continue;
+		}
+
+		const float Deadhead = Tour.StartDistances[Contract.PickupNode];
+		const float DirectLeg = GetNodeDistance(Contract.PickupNode, Contract.DeliveryNode);
+		if (Deadhead >= Unreachable || DirectLeg >= Unreachable)
+		{
+			continue;
+		}
+
+		const float AloneHours = (Deadhead + DirectLeg) * Tour.InvSpeed;
+		const float Deadline = GetDeadline(Contract.Contract, Trader.StartTime);
+		if (Trader.StartTime + AloneHours > Deadline)
+		{
+			continue;
+		}
+
+		Candidates.Add({ Index, Deadline, static_cast<float>(Contract.Reward) / FMath::Max(AloneHours, UE_KINDA_SMALL_NUMBER) });
+	}
+
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.Score > B.Score; });
+
+	for (const FCandidate& Candidate : Candidates)
+	{
+		if (Tour.Slots.Num() >= MaxContracts)
+		{
+			break;
+		}
+
+		int32 PickupAfter = INDEX_NONE;
+		int32 DeliveryAfter = INDEX_NONE;
+		if (Tour.FindInsertion(Planned[Candidate.PlannedIndex], Candidate.Deadline, PickupAfter, DeliveryAfter) < Unreachable)
+		{
+			Tour.Insert(Candidate.PlannedIndex, Candidate.Deadline, PickupAfter, DeliveryAfter);
+		}
+	}
+
+	if (Tour.Stops.Num() > 2)
+	{
+		Tour.ImproveTwoOpt();
+	}
+
+	OutTour.Stops.Reserve(Tour.Stops.Num());
+	for (int32 Position = 1; Position <= Tour.Stops.Num(); ++Position)
+	{
+		const int32 Stop = Tour.Stops[Position - 1];
+		FContractTourStop& TourStop = OutTour.Stops.AddDefaulted_GetRef();
+		TourStop.Contract = Planned[Tour.Slots[ContractRoutePlanning::GetStopSlot(Stop)]].Contract;
+		TourStop.Type = ContractRoutePlanning::IsDelivery(Stop) ? EContractStopType::Delivery : EContractStopType::Pickup;
+		TourStop.ArrivalTime = Tour.Arrival[Position];
+	}
+
+	OutTour.Contracts.Reserve(Tour.Slots.Num());
+	for (const int32 PlannedIndex : Tour.Slots)
+	{
+		OutTour.Contracts.Add(Planned[PlannedIndex].Contract);
+		OutTour.TotalReward += Planned[PlannedIndex].Reward;
+		if (InOutClaimed && InOutClaimed->IsValidIndex(PlannedIndex))
+		{
+			(*InOutClaimed)[PlannedIndex] = true;
+		}
+	}
+	OutTour.TravelHours = Tour.TotalDistance * Tour.InvSpeed;
+}
+
+float FContractRoutePlanner::EstimateSequentialHours(const FContractPlannerTrader& Trader, const FContractTour& Tour, int32* OutLateDeliveries) const
+{
+	int32 LateDeliveries = 0;
+	float Hours = 0.0f;
+
+	if (Trader.Speed > 0.0f)
+	{
+		const float InvSpeed = 1.0f / Trader.Speed;
+		int32 Node = ContractRoutePlanning::StartNode;
+
+		for (const UTradeContractDataAsset* Contract : Tour.Contracts)
+		{
+			const int32* Index = ContractToIndex.Find(Contract);
+			if (!Index)
+			{
+				continue;
+			}
+
+			const FPlannedContract& Entry = Planned[*Index];
+			const float Deadhead = Node == ContractRoutePlanning::StartNode
+				? (DistanceFunction ? DistanceFunction(Trader.StartLocation, Nodes[Entry.PickupNode]) : GetStraightLineDistance(Trader.StartLocation, Nodes[Entry.PickupNode]))
+				: GetNodeDistance(Node, Entry.PickupNode);
+
+			Hours += (Deadhead + GetNodeDistance(Entry.PickupNode, Entry.DeliveryNode)) * InvSpeed;
+			if (Trader.StartTime + Hours > GetDeadline(Contract, Trader.StartTime))
+			{
+				++LateDeliveries;
+			}
+			Node = Entry.DeliveryNode;
+		}
+	}
+
+	if (OutLateDeliveries)
+	{
+		*OutLateDeliveries = LateDeliveries;
+	}
+	return Hours;
+}
+
+int32 FContractRoutePlanner::FindOrAddNode(const FContractLocation& Location)
+{
+	if (!Location.MarketID.IsNone())
+	{
+		if (const int32* Node = NodeByMarket.Find(Location.MarketID))
+		{
+			return *Node;
+		}
+		const int32 Node = Nodes.Add(Location);
+		NodeByMarket.Add(Location.MarketID, Node);
+		return Node;
+	}
+
+	if (const int32* Node = NodeByCoordinates.Find(Location.Coordinates))
+	{
+		return *Node;
+	}
+	const int32 Node = Nodes.Add(Location);
+	NodeByCoordinates.Add(Location.Coordinates, Node);
+	return Node;
+}
+
+float FContractRoutePlanner::GetDeadline(const UTradeContractDataAsset* Contract, float StartTime)
+{
+	if (!Contract || Contract->TimeLimit <= 0.0f)
+	{
+		return TNumericLimits<float>::Max();
+	}
+	return Contract->Status == EContractStatus::Active ? Contract->ExpirationTime : StartTime + Contract->TimeLimit;
+}
@@ -1,8 +1,45 @@
 #include "Trading/EconomyManager.h"
 #include "Trading/MarketDataAsset.h"
 #include "Trading/TradeItemDataAsset.h"
+#include "Trading/MarketPriceHistorySubsystem.h"
 #include "TimerManager.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "AdastreaLog.h"
+
+namespace EconomyMarketState
+{
+	/** Template event with a market instance's live start time and active flag */
+	static FMarketEvent MakeEventView(const FMarketEvent& Template, const FMarketEventState& State)
+	{
+		FMarketEvent Event = Template;
+		Event.StartTime = State.StartTime;
+		Event.bIsActive = State.bIsActive;
+		return Event;
+	}
+
+	/** Template inventory with a state row's live values filled in (template values if Row is INDEX_NONE) */
+	static TArray<FMarketInventoryEntry> MakeInventoryView(const UMarketDataAsset* Template, const FMarketStateTable& States, int32 Row)
+	{
+		TArray<FMarketInventoryEntry> Entries = Template->Inventory;
+		if (Row == INDEX_NONE)
+		{
+			return Entries;
+		}
+
+		const TConstArrayView<FMarketItemState> ItemStates = States.GetItems(Row);
+		for (int32 Index = 0; Index < FMath::Min(Entries.Num(), ItemStates.Num()); ++Index)
+		{
+			FMarketInventoryEntry& Entry = Entries[Index];
+			Entry.CurrentStock = ItemStates[Index].CurrentStock;
+			Entry.SupplyLevel = ItemStates[Index].SupplyLevel;
+			Entry.DemandLevel = ItemStates[Index].DemandLevel;
+			Entry.LastTradePrice = ItemStates[Index].LastTradePrice;
+			Entry.bInStock = ItemStates[Index].bInStock;
+		}
+		return Entries;
+	}
+}
 
 UEconomyManager::UEconomyManager()
 	: SupplyDemandAdjustmentRate(0.05f)  // 5% change per transaction
@@ -12,6 +49,10 @@ UEconomyManager::UEconomyManager()
 	, CurrentGameTime(0.0f)
 	, TimeScale(1.0f)
 	, UpdateInterval(5.0f)
+	, FixedStepHours(5.0f / 60.0f)
+	, bUseBatchedSimulation(true)
+	, SimulationStep(0)
+	, PendingHours(0.0)
 {
 }
 
@@ -24,6 +65,8 @@ void UEconomyManager::Initialize(FSubsystemCollectionBase& Collection)
 	CurrentGameTime = 0.0f;
 	TimeScale = 1.0f;
 	UpdateInterval = 5.0f;
+	SimulationStep = 0;
+	PendingHours = 0.0;
 
 	// Start update timer
 	if (UGameInstance* GameInstance = GetGameInstance())
@@ -51,26 +94,58 @@ void UEconomyManager::Deinitialize()
 	}
 
 	ActiveMarkets.Empty();
+	MarketInstances.Empty();
+	MarketStates.Reset();
+	SimulationBatch.MarkLayoutDirty();
+	Snapshots.Reset();
 
 	Super::Deinitialize();
 }
 
-void UEconomyManager::RegisterMarket(UMarketDataAsset* Market)
+FName UEconomyManager::RegisterMarket(UMarketDataAsset* Market, FName InstanceID)
 {
 	if (!Market)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("EconomyManager: Cannot register null market"));
-		return;
+		return NAME_None;
 	}
 
-	if (ActiveMarkets.Contains(Market))
+	if (InstanceID.IsNone())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("EconomyManager: Market '%s' already registered"), *Market->MarketName.ToString());
-		return;
+		// A template's MarketID belongs to it; only further instances of the same template get numbered IDs
+		const FMarketInstance* Primary = FindMarketInstance(FMarketStateTable::GetMarketKey(Market));
+		if (Primary && Primary->Template != Market)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("EconomyManager: Market ID '%s' of '%s' is already in use by another market"),
+				*FMarketStateTable::GetMarketKey(Market).ToString(), *Market->MarketName.ToString());
+			return NAME_None;
+		}
+		InstanceID = MarketStates.MakeInstanceID(Market);
+	}
+
+	// Each instance gets its own runtime state row; the asset is only read from
+	if (MarketStates.AddMarket(Market, InstanceID) == INDEX_NONE)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EconomyManager: Market instance ID '%s' for '%s' is already in use"),
+			*InstanceID.ToString(), *Market->MarketName.ToString());
+		return NAME_None;
+	}
+
+	FMarketInstance& Instance = MarketInstances.AddDefaulted_GetRef();
+	Instance.Template = Market;
+	Instance.InstanceID = InstanceID;
+	SimulationBatch.MarkLayoutDirty();
+
+	UE_LOG(LogTemp, Log, TEXT("EconomyManager: Registered market '%s' as '%s' (total: %d)"),
+		*Market->MarketName.ToString(), *InstanceID.ToString(), MarketInstances.Num());
+
+	if (!ActiveMarkets.Contains(Market))
+	{
+		ActiveMarkets.Add(Market);
+		OnMarketRegistered.Broadcast(Market);
 	}
 
-	ActiveMarkets.Add(Market);
-	UE_LOG(LogTemp, Log, TEXT("EconomyManager: Registered market '%s' (total: %d)"), *Market->MarketName.ToString(), ActiveMarkets.Num());
+	return InstanceID;
 }
 
 void UEconomyManager::UnregisterMarket(UMarketDataAsset* Market)
@@ -80,12 +155,70 @@ void UEconomyManager::UnregisterMarket(UMarketDataAsset* Market)
 		return;
 	}
 
-	if (ActiveMarkets.Remove(Market) > 0)
+	for (int32 Index = MarketInstances.Num() - 1; Index >= 0; --Index)
 	{
-		UE_LOG(LogTemp, Log, TEXT("EconomyManager: Unregistered market '%s' (total: %d)"), *Market->MarketName.ToString(), ActiveMarkets.Num());
+		if (MarketInstances[Index].Template == Market)
+		{
+			RemoveMarketInstance(Index);
+		}
+	}
+}
+
+void UEconomyManager::UnregisterMarketInstance(FName InstanceID)
+{
+	// Instances and state rows are added and removed together, so they share indices
+	if (FindMarketInstance(InstanceID))
+	{
+		RemoveMarketInstance(MarketStates.FindRow(InstanceID));
 	}
 }
 
+void UEconomyManager::RemoveMarketInstance(int32 InstanceIndex)
+{
+	const FMarketInstance Removed = MarketInstances[InstanceIndex];
+	MarketInstances.RemoveAt(InstanceIndex, 1, EAllowShrinking::No);
+	MarketStates.RemoveMarket(Removed.InstanceID);
+	SimulationBatch.MarkLayoutDirty();
+
+	UMarketDataAsset* Market = Removed.Template;
+	UE_LOG(LogTemp, Log, TEXT("EconomyManager: Unregistered market instance '%s' (total: %d)"), *Removed.InstanceID.ToString(), MarketInstances.Num());
+
+	const bool bTemplateStillUsed = MarketInstances.ContainsByPredicate([Market](const FMarketInstance& Instance)
+	{
+		return Instance.Template == Market;
+	});
+	if (!bTemplateStillUsed && ActiveMarkets.Remove(Market) > 0)
+	{
+		OnMarketUnregistered.Broadcast(Market);
+	}
+}
+
+const FMarketInstance* UEconomyManager::FindMarketInstance(FName InstanceID) const
+{
+	// Instances and state rows are added and removed together, so they share indices
+	const int32 Row = MarketStates.FindRow(InstanceID);
+	return MarketInstances.IsValidIndex(Row) && MarketInstances[Row].InstanceID == InstanceID ? &MarketInstances[Row] : nullptr;
+}
+
+UMarketDataAsset* UEconomyManager::GetMarketInstanceTemplate(FName InstanceID) const
+{
+	const FMarketInstance* Instance = FindMarketInstance(InstanceID);
+	return Instance ? Instance->Template.Get() : nullptr;
+}
+
+TArray<FName> UEconomyManager::GetMarketInstanceIDs(UMarketDataAsset* Market) const
+{
+	TArray<FName> InstanceIDs;
+	for (const FMarketInstance& Instance : MarketInstances)
+	{
+		if (Instance.Template == Market)
+		{
+			InstanceIDs.Add(Instance.InstanceID);
+		}
+	}
+	return InstanceIDs;
+}
+
 bool UEconomyManager::IsMarketRegistered(UMarketDataAsset* Market) const
 {
 	return Market && ActiveMarkets.Contains(Market);
@@ -101,6 +234,21 @@ int32 UEconomyManager::GetMarketCount() const
 	return ActiveMarkets.Num();
 }
 
+int64 UEconomyManager::GetSnapshotVersion() const
+{
+	return static_cast<int64>(Snapshots.GetVersion());
+}
+
+bool UEconomyManager::HasMarketChangedSince(UMarketDataAsset* Market, int64 SinceVersion) const
+{
+	const FEconomySnapshotHandle Snapshot = Snapshots.Acquire();
+	if (!Market || !Snapshot.IsValid())
+	{
+		return false;
+	}
+	return Snapshot->HasMarketChangedSince(FMarketStateTable::GetMarketKey(Market), static_cast<uint64>(FMath::Max<int64>(0, SinceVersion)));
+}
+
 float UEconomyManager::GetGameTime() const
 {
 	return CurrentGameTime;
@@ -130,83 +278,286 @@ void UEconomyManager::UpdateEconomy()
 {
 	// Convert update interval to game time hours
 	// 1 real second = 1 game minute by default (60x speed)
-	float DeltaHours = (UpdateInterval * TimeScale) / 60.0f;
-	CurrentGameTime += DeltaHours;
+	AdvanceTime((UpdateInterval * TimeScale) / 60.0f);
+}
 
-	// Update all markets
-	for (UMarketDataAsset* Market : ActiveMarkets)
+void UEconomyManager::AdvanceTime(float GameHours)
+{
+	if (GameHours <= 0.0f || FixedStepHours <= 0.0f)
 	{
-		if (Market)
+		return;
+	}
+
+	// Small tolerance so an update of exactly one step is not lost to float rounding
+	PendingHours += GameHours;
+	const int64 NumSteps = FMath::FloorToInt64(PendingHours / FixedStepHours + 1.0e-4);
+	PendingHours = FMath::Max(0.0, PendingHours - static_cast<double>(NumSteps) * FixedStepHours);
+
+	StepEconomy(NumSteps);
+}
+
+void UEconomyManager::AdvanceRealTime(float RealSeconds)
+{
+	AdvanceTime((RealSeconds * TimeScale) / 60.0f);
+}
+
+void UEconomyManager::StepEconomy(int64 NumSteps)
+{
+	if (NumSteps <= 0)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (bUseBatchedSimulation)
+	{
+		UpdateMarketsBatched(FixedStepHours, NumSteps);
+	}
+	else
+	{
+		// Legacy path: one pass over every market per step
+		for (int64 Step = 0; Step < NumSteps; ++Step)
 		{
-			UpdateMarketPrices(Market, DeltaHours);
-			SimulateBackgroundActivity(Market, DeltaHours);
+			for (const FMarketInstance& Market : MarketInstances)
+			{
+				UpdateMarketPrices(Market, FixedStepHours);
+				SimulateBackgroundActivity(Market, FixedStepHours);
+			}
 		}
 	}
+
+	// Derived from the step count rather than accumulated, so it never drifts
+	SimulationStep += NumSteps;
+	CurrentGameTime = static_cast<float>(static_cast<double>(SimulationStep) * FixedStepHours);
+
+	// Expire finished market events (refreshes each market's event price multipliers)
+	for (const FMarketInstance& Market : MarketInstances)
+	{
+		UpdateMarketEvents(Market);
+	}
+
+	if (NumSteps > 1)
+	{
+		UE_LOG(LogAdastreaTrading, Log, TEXT("EconomyManager: Caught up %lld steps (%.1f game hours) in %.2f ms"),
+			NumSteps, static_cast<double>(NumSteps) * FixedStepHours, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	// Also picks up transactions and registrations since the last tick
+	Snapshots.Publish(MarketStates, CurrentGameTime);
+
+	OnEconomyUpdated.Broadcast(CurrentGameTime);
+}
+
+void UEconomyManager::UpdateMarketsBatched(float DeltaHours, int64 NumSteps)
+{
+	if (MarketInstances.Num() == 0)
+	{
+		return;
+	}
+
+	SimulationBatch.Gather(MarketInstances, MarketStates);
+	SimulationBatch.Simulate(EconomicRecoveryRate * DeltaHours, MinSupplyDemandLevel, MaxSupplyDemandLevel, DeltaHours, NumSteps);
+	SimulationBatch.Scatter(MarketInstances, MarketStates, DeltaHours);
 }
 
 float UEconomyManager::GetItemPrice(UMarketDataAsset* Market, UTradeItemDataAsset* Item, bool bIsBuying) const
 {
-	if (!Market || !Item)
+	return MarketStates.GetItemPrice(Market, Item, bIsBuying);
+}
+
+void UEconomyManager::GetItemPrices(UMarketDataAsset* Market, const TArray<UTradeItemDataAsset*>& Items, bool bIsBuying, TArray<float>& OutPrices) const
+{
+	OutPrices.SetNumUninitialized(Items.Num());
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		OutPrices[Index] = MarketStates.GetItemPrice(Market, Items[Index], bIsBuying);
+	}
+}
+
+bool UEconomyManager::GetItemState(UMarketDataAsset* Market, UTradeItemDataAsset* Item, FMarketItemState& OutState) const
+{
+	if (const FMarketItemState* State = FindItemState(Market, Item))
+	{
+		OutState = *State;
+		return true;
+	}
+	return false;
+}
+
+const FMarketItemState* UEconomyManager::FindItemState(const UMarketDataAsset* Market, const UTradeItemDataAsset* Item) const
+{
+	return MarketStates.FindItem(Market, Item);
+}
+
+bool UEconomyManager::IsItemInStock(UMarketDataAsset* Market, UTradeItemDataAsset* Item, int32 Quantity) const
+{
+	const FMarketItemState* State = FindItemState(Market, Item);
+	return State && State->bInStock && State->CurrentStock >= Quantity;
+}
+
+TArray<FMarketInventoryEntry> UEconomyManager::GetMarketInventory(UMarketDataAsset* Market) const
+{
+	if (!Market)
+	{
+		return TArray<FMarketInventoryEntry>();
+	}
+
+	return EconomyMarketState::MakeInventoryView(Market, MarketStates, MarketStates.FindRow(Market));
+}
+
+bool UEconomyManager::GetInstanceItemState(FName InstanceID, UTradeItemDataAsset* Item, FMarketItemState& OutState) const
+{
+	const FMarketInstance* Instance = FindMarketInstance(InstanceID);
+	if (const FMarketItemState* State = Instance ? MarketStates.FindItem(InstanceID, Instance->Template, Item) : nullptr)
 	{
-		return 0.0f;
+		OutState = *State;
+		return true;
 	}
+	return false;
+}
 
-	return Market->GetItemPrice(Item, bIsBuying);
+TArray<FMarketInventoryEntry> UEconomyManager::GetInstanceInventory(FName InstanceID) const
+{
+	const FMarketInstance* Instance = FindMarketInstance(InstanceID);
+	if (!Instance)
+	{
+		return TArray<FMarketInventoryEntry>();
+	}
+
+	return EconomyMarketState::MakeInventoryView(Instance->Template, MarketStates, MarketStates.FindRow(InstanceID));
+}
+
+bool UEconomyManager::StartMarketEvent(UMarketDataAsset* Market, FName EventID)
+{
+	const int32 Row = MarketStates.FindRow(Market);
+	if (Row == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const TArrayView<FMarketEventState> Events = MarketStates.GetEvents(Row);
+	for (int32 Index = 0; Index < FMath::Min(Events.Num(), Market->ActiveEvents.Num()); ++Index)
+	{
+		if (Market->ActiveEvents[Index].EventID == EventID && !Events[Index].bIsActive)
+		{
+			Events[Index].bIsActive = true;
+			Events[Index].StartTime = CurrentGameTime;
+			MarketStates.RefreshEventMultipliers(Row, Market);
+			Market->OnMarketEventStarted(EconomyMarketState::MakeEventView(Market->ActiveEvents[Index], Events[Index]));
+			return true;
+		}
+	}
+	return false;
+}
+
+TArray<FMarketEvent> UEconomyManager::GetActiveEventsForItem(UMarketDataAsset* Market, FName ItemID) const
+{
+	TArray<FMarketEvent> Result;
+
+	const int32 Row = MarketStates.FindRow(Market);
+	if (Row == INDEX_NONE)
+	{
+		return Result;
+	}
+
+	const TConstArrayView<FMarketEventState> Events = MarketStates.GetEvents(Row);
+	for (int32 Index = 0; Index < FMath::Min(Events.Num(), Market->ActiveEvents.Num()); ++Index)
+	{
+		const FMarketEvent& Event = Market->ActiveEvents[Index];
+		if (!Events[Index].bIsActive)
+		{
+			continue;
+		}
+
+		// If event has no specific items, it affects all items
+		if (Event.AffectedItemIDs.Num() == 0 || Event.AffectedItemIDs.Contains(ItemID))
+		{
+			Result.Add(EconomyMarketState::MakeEventView(Event, Events[Index]));
+		}
+	}
+
+	return Result;
 }
 
 void UEconomyManager::RecordTransaction(UMarketDataAsset* Market, UTradeItemDataAsset* Item, int32 Quantity, bool bPlayerBought)
 {
-	if (!Market || !Item || Quantity <= 0)
+	const FMarketInstance* Primary = Market ? FindMarketInstance(FMarketStateTable::GetMarketKey(Market)) : nullptr;
+	if (Primary && Primary->Template == Market)
+	{
+		RecordInstanceTransaction(Primary->InstanceID, Item, Quantity, bPlayerBought);
+	}
+}
+
+float UEconomyManager::GetInstanceItemPrice(FName InstanceID, UTradeItemDataAsset* Item, bool bIsBuying) const
+{
+	const FMarketInstance* Instance = FindMarketInstance(InstanceID);
+	return Instance ? MarketStates.GetItemPrice(InstanceID, Instance->Template, Item, bIsBuying) : 0.0f;
+}
+
+void UEconomyManager::RecordInstanceTransaction(FName InstanceID, UTradeItemDataAsset* Item, int32 Quantity, bool bPlayerBought)
+{
+	const FMarketInstance* Instance = FindMarketInstance(InstanceID);
+	if (!Instance || !Item || Quantity <= 0)
+	{
+		return;
+	}
+
+	// Runtime state lives in the state table; the Data Asset is only a template
+	UMarketDataAsset* Market = Instance->Template;
+	FMarketItemState* Entry = MarketStates.FindItem(InstanceID, Market, Item);
+	if (!Entry)
 	{
 		return;
 	}
 
-	// NOTE: This method modifies the MarketDataAsset's Inventory array at runtime.
-	// The Data Asset serves as a template, but runtime market state is mutable and won't persist
-	// between sessions unless explicitly saved. For persistent state, consider implementing
-	// a separate runtime market state structure that references the Data Asset template.
+	// Trade happens at the price before supply/demand react
+	const float TradePrice = Market->CalculateItemPrice(Item, bPlayerBought, *Entry);
+	Entry->LastTradePrice = TradePrice;
 
-	// Find inventory entry
-	for (FMarketInventoryEntry& Entry : Market->Inventory)
+	if (bPlayerBought)
 	{
-		if (Entry.TradeItem == Item)
-		{
-			if (bPlayerBought)
-			{
-				// Player bought from station
-				Entry.CurrentStock = FMath::Max(0, Entry.CurrentStock - Quantity);
-				Entry.SupplyLevel *= (1.0f - SupplyDemandAdjustmentRate);  // Supply decreased
-				Entry.DemandLevel *= (1.0f + SupplyDemandAdjustmentRate);  // Demand increased
+		// Player bought from station
+		Entry->CurrentStock = FMath::Max(0, Entry->CurrentStock - Quantity);
+		Entry->SupplyLevel *= (1.0f - SupplyDemandAdjustmentRate);  // Supply decreased
+		Entry->DemandLevel *= (1.0f + SupplyDemandAdjustmentRate);  // Demand increased
 
-				UE_LOG(LogTemp, Log, TEXT("EconomyManager: Player bought %d x %s from %s"), 
-					Quantity, *Item->ItemName.ToString(), *Market->MarketName.ToString());
-			}
-			else
-			{
-				// Player sold to station
-				Entry.CurrentStock += Quantity;
-				Entry.SupplyLevel *= (1.0f + SupplyDemandAdjustmentRate);  // Supply increased
-				Entry.DemandLevel *= (1.0f - SupplyDemandAdjustmentRate);  // Demand decreased
+		UE_LOG(LogTemp, Log, TEXT("EconomyManager: Player bought %d x %s from %s"), 
+			Quantity, *Item->ItemName.ToString(), *Market->MarketName.ToString());
+	}
+	else
+	{
+		// Player sold to station
+		Entry->CurrentStock += Quantity;
+		Entry->SupplyLevel *= (1.0f + SupplyDemandAdjustmentRate);  // Supply increased
+		Entry->DemandLevel *= (1.0f - SupplyDemandAdjustmentRate);  // Demand decreased
 
-				UE_LOG(LogTemp, Log, TEXT("EconomyManager: Player sold %d x %s to %s"), 
-					Quantity, *Item->ItemName.ToString(), *Market->MarketName.ToString());
-			}
+		UE_LOG(LogTemp, Log, TEXT("EconomyManager: Player sold %d x %s to %s"), 
+			Quantity, *Item->ItemName.ToString(), *Market->MarketName.ToString());
+	}
 
-			// Clamp supply/demand to reasonable ranges
-			Entry.SupplyLevel = FMath::Clamp(Entry.SupplyLevel, MinSupplyDemandLevel, MaxSupplyDemandLevel);
-			Entry.DemandLevel = FMath::Clamp(Entry.DemandLevel, MinSupplyDemandLevel, MaxSupplyDemandLevel);
+	// Clamp supply/demand to reasonable ranges
+	Entry->SupplyLevel = FMath::Clamp(Entry->SupplyLevel, MinSupplyDemandLevel, MaxSupplyDemandLevel);
+	Entry->DemandLevel = FMath::Clamp(Entry->DemandLevel, MinSupplyDemandLevel, MaxSupplyDemandLevel);
 
-			// Update stock status
-			Entry.bInStock = Entry.CurrentStock > 0;
+	// Update stock status
+	Entry->bInStock = Entry->CurrentStock > 0;
 
-			break;
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		if (UMarketPriceHistorySubsystem* PriceHistory = GameInstance->GetSubsystem<UMarketPriceHistorySubsystem>())
+		{
+			PriceHistory->RecordTradeAt(Market, Item, TradePrice, Quantity, CurrentGameTime);
 		}
 	}
+
+	OnMarketItemUpdated.Broadcast(Market, Item);
 }
 
-void UEconomyManager::UpdateMarketPrices(UMarketDataAsset* Market, float DeltaHours)
+void UEconomyManager::UpdateMarketPrices(const FMarketInstance& Market, float DeltaHours)
 {
-	if (!Market)
+	const int32 Row = MarketStates.FindRow(Market.InstanceID);
+	if (Row == INDEX_NONE)
 	{
 		return;
 	}
@@ -214,7 +565,7 @@ void UEconomyManager::UpdateMarketPrices(UMarketDataAsset* Market, float DeltaHo
 	// Gradually return supply/demand to baseline (recovery)
 	const float RecoveryRate = EconomicRecoveryRate * DeltaHours;
 
-	for (FMarketInventoryEntry& Entry : Market->Inventory)
+	for (FMarketItemState& Entry : MarketStates.GetItems(Row))
 	{
 		// Move supply/demand back toward 1.0 (normal) over time
 		Entry.SupplyLevel = FMath::Lerp(Entry.SupplyLevel, 1.0f, RecoveryRate);
@@ -222,26 +573,66 @@ void UEconomyManager::UpdateMarketPrices(UMarketDataAsset* Market, float DeltaHo
 	}
 }
 
-void UEconomyManager::SimulateBackgroundActivity(UMarketDataAsset* Market, float DeltaHours)
+void UEconomyManager::SimulateBackgroundActivity(const FMarketInstance& Market, float DeltaHours)
 {
-	if (!Market)
+	const int32 Row = Market.Template ? MarketStates.FindRow(Market.InstanceID) : INDEX_NONE;
+	if (Row == INDEX_NONE)
 	{
 		return;
 	}
 
 	// Simple stock replenishment
-	for (FMarketInventoryEntry& Entry : Market->Inventory)
+	const TArrayView<FMarketItemState> States = MarketStates.GetItems(Row);
+	const TArray<FMarketInventoryEntry>& Inventory = Market.Template->Inventory;
+	for (int32 Index = 0; Index < FMath::Min(States.Num(), Inventory.Num()); ++Index)
 	{
-		if (Entry.TradeItem)
+		const FMarketInventoryEntry& Template = Inventory[Index];
+		if (Template.TradeItem)
 		{
 			// Replenish stock based on item's replenishment rate
-			int32 ReplenishAmount = FMath::RoundToInt(Entry.TradeItem->ReplenishmentRate * DeltaHours);
+			int32 ReplenishAmount = FMath::RoundToInt(Template.TradeItem->ReplenishmentRate * DeltaHours);
 			
 			if (ReplenishAmount > 0)
 			{
-				Entry.CurrentStock = FMath::Min(Entry.CurrentStock + ReplenishAmount, Entry.MaxStock);
+				FMarketItemState& Entry = States[Index];
+				Entry.CurrentStock = FMath::Min(Entry.CurrentStock + ReplenishAmount, Template.MaxStock);
 				Entry.bInStock = Entry.CurrentStock > 0;
 			}
 		}
 	}
 }
+
+void UEconomyManager::UpdateMarketEvents(const FMarketInstance& Instance)
+{
+	UMarketDataAsset* Market = Instance.Template;
+	const int32 Row = Market ? MarketStates.FindRow(Instance.InstanceID) : INDEX_NONE;
+	if (Row == INDEX_NONE)
+	{
+		return;
+	}
+
+	bool bEventsChanged = false;
+	const TArrayView<FMarketEventState> Events = MarketStates.GetEvents(Row);
+	for (int32 Index = 0; Index < FMath::Min(Events.Num(), Market->ActiveEvents.Num()); ++Index)
+	{
+		FMarketEventState& State = Events[Index];
+		const FMarketEvent& Event = Market->ActiveEvents[Index];
+		if (!State.bIsActive || Event.DurationHours <= 0.0f)
+		{
+			continue;
+		}
+
+		// Check if event should expire
+		if (CurrentGameTime - State.StartTime >= Event.DurationHours)
+		{
+			State.bIsActive = false;
+			bEventsChanged = true;
+			Market->OnMarketEventEnded(EconomyMarketState::MakeEventView(Event, State));
+		}
+	}
+
+	if (bEventsChanged)
+	{
+		MarketStates.RefreshEventMultipliers(Row, Market);
+	}
+}
@@ -0,0 +1,244 @@
+#include "Trading/EconomySimulationBatch.h"
+#include "Trading/MarketDataAsset.h"
+#include "Trading/MarketStateTable.h"
+#include "Trading/TradeItemDataAsset.h"
+
+namespace EconomySimulationKernel
+{
+	/** One recovery step toward 1.0 (same formulation as FMath::Lerp), then clamp; shared so both kernels round identically */
+	FORCEINLINE float RecoverLevel(float Level, float Alpha, float MinLevel, float MaxLevel)
+	{
+		return FMath::Clamp(Level + Alpha * (1.0f - Level), MinLevel, MaxLevel);
+	}
+}
+
+int32 FEconomySimulationBatch::GetBatchEntryCount(const FMarketInstance& Market, const FMarketStateTable& States, int32& OutRow)
+{
+	OutRow = Market.Template ? States.FindRow(Market.InstanceID) : INDEX_NONE;
+	return OutRow != INDEX_NONE ? States.GetRow(OutRow).NumItems : 0;
+}
+
+void FEconomySimulationBatch::Gather(const TArray<FMarketInstance>& Markets, const FMarketStateTable& States)
+{
+	if (bLayoutDirty || !IsLayoutValid(Markets, States))
+	{
+		RebuildLayout(Markets, States);
+	}
+
+	float* RESTRICT SupplyData = Supply.GetData();
+	float* RESTRICT DemandData = Demand.GetData();
+	int32* RESTRICT StockData = Stock.GetData();
+
+	int32 Index = 0;
+	for (const FMarketInstance& Market : Markets)
+	{
+		int32 Row;
+		if (GetBatchEntryCount(Market, States, Row) == 0)
+		{
+			continue;
+		}
+
+		for (const FMarketItemState& Entry : States.GetItems(Row))
+		{
+			SupplyData[Index] = Entry.SupplyLevel;
+			DemandData[Index] = Entry.DemandLevel;
+			StockData[Index] = Entry.CurrentStock;
+			++Index;
+		}
+	}
+}
+
+void FEconomySimulationBatch::Simulate(float RecoveryAlpha, float MinLevel, float MaxLevel, float DeltaHours, int64 NumSteps)
+{
+	if (NumSteps <= 0)
+	{
+		return;
+	}
+
+	if (NumSteps > 1)
+	{
+		SimulateSteps(
+			GetNum(),
+			Supply.GetData(),
+			Demand.GetData(),
+			Stock.GetData(),
+			MaxStock.GetData(),
+			ReplenishRate.GetData(),
+			RecoveryAlpha,
+			MinLevel,
+			MaxLevel,
+			DeltaHours,
+			NumSteps);
+		return;
+	}
+
+	SimulateStep(
+		GetNum(),
+		Supply.GetData(),
+		Demand.GetData(),
+		Stock.GetData(),
+		MaxStock.GetData(),
+		ReplenishRate.GetData(),
+		RecoveryAlpha,
+		MinLevel,
+		MaxLevel,
+		DeltaHours);
+}
+
+void FEconomySimulationBatch::Scatter(const TArray<FMarketInstance>& Markets, FMarketStateTable& States, float DeltaHours) const
+{
+	const float* RESTRICT SupplyData = Supply.GetData();
+	const float* RESTRICT DemandData = Demand.GetData();
+	const int32* RESTRICT StockData = Stock.GetData();
+	const float* RESTRICT RateData = ReplenishRate.GetData();
+
+	int32 Index = 0;
+	for (const FMarketInstance& Market : Markets)
+	{
+		int32 Row;
+		if (GetBatchEntryCount(Market, States, Row) == 0)
+		{
+			continue;
+		}
+
+		for (FMarketItemState& Entry : States.GetItems(Row))
+		{
+			Entry.SupplyLevel = SupplyData[Index];
+			Entry.DemandLevel = DemandData[Index];
+
+			// Match the per-entry path: stock flags only change when stock was replenished
+			if (FMath::RoundToInt(RateData[Index] * DeltaHours) > 0)
+			{
+				Entry.CurrentStock = StockData[Index];
+				Entry.bInStock = Entry.CurrentStock > 0;
+			}
+			++Index;
+		}
+	}
+}
+
+void FEconomySimulationBatch::SimulateStep(
+	int32 Num,
+	float* RESTRICT SupplyLevels,
+	float* RESTRICT DemandLevels,
+	int32* RESTRICT StockLevels,
+	const int32* RESTRICT MaxStockLevels,
+	const float* RESTRICT ReplenishRates,
+	float RecoveryAlpha,
+	float MinLevel,
+	float MaxLevel,
+	float DeltaHours)
+{
+	// Large time steps must not overshoot the baseline
+	const float Alpha = FMath::Clamp(RecoveryAlpha, 0.0f, 1.0f);
+
+	for (int32 i = 0; i < Num; ++i)
+	{
+		// Recovery toward 1.0, then clamp
+		SupplyLevels[i] = EconomySimulationKernel::RecoverLevel(SupplyLevels[i], Alpha, MinLevel, MaxLevel);
+		DemandLevels[i] = EconomySimulationKernel::RecoverLevel(DemandLevels[i], Alpha, MinLevel, MaxLevel);
+
+		// Replenishment, selected rather than branched so the loop stays vectorizable
+		const int32 ReplenishAmount = FMath::RoundToInt(ReplenishRates[i] * DeltaHours);
+		const int32 Replenished = FMath::Min(StockLevels[i] + ReplenishAmount, MaxStockLevels[i]);
+		StockLevels[i] = ReplenishAmount > 0 ? Replenished : StockLevels[i];
+	}
+}
+
+void FEconomySimulationBatch::SimulateSteps(
+	int32 Num,
+	float* RESTRICT SupplyLevels,
+	float* RESTRICT DemandLevels,
+	int32* RESTRICT StockLevels,
+	const int32* RESTRICT MaxStockLevels,
+	const float* RESTRICT ReplenishRates,
+	float RecoveryAlpha,
+	float MinLevel,
+	float MaxLevel,
+	float DeltaHours,
+	int64 NumSteps)
+{
+	const float Alpha = FMath::Clamp(RecoveryAlpha, 0.0f, 1.0f);
+
+	for (int32 i = 0; i < Num; ++i)
+	{
+		// A step is a pure function of (supply, demand), so once it maps them onto themselves the remaining steps are no-ops
+		float SupplyLevel = SupplyLevels[i];
+		float DemandLevel = DemandLevels[i];
+		for (int64 Step = 0; Step < NumSteps; ++Step)
+		{
+			const float NewSupply = EconomySimulationKernel::RecoverLevel(SupplyLevel, Alpha, MinLevel, MaxLevel);
+			const float NewDemand = EconomySimulationKernel::RecoverLevel(DemandLevel, Alpha, MinLevel, MaxLevel);
+			if (NewSupply == SupplyLevel && NewDemand == DemandLevel)
+			{
+				break;
+			}
+			SupplyLevel = NewSupply;
+			DemandLevel = NewDemand;
+		}
+		SupplyLevels[i] = SupplyLevel;
+		DemandLevels[i] = DemandLevel;
+
+		// min(Stock + R, Max) applied N times is min(Stock + N * R, Max)
+		const int32 ReplenishAmount = FMath::RoundToInt(ReplenishRates[i] * DeltaHours);
+		if (ReplenishAmount > 0)
+		{
+			StockLevels[i] = static_cast<int32>(FMath::Min<int64>(StockLevels[i] + ReplenishAmount * NumSteps, MaxStockLevels[i]));
+		}
+	}
+}
+
+void FEconomySimulationBatch::RebuildLayout(const TArray<FMarketInstance>& Markets, const FMarketStateTable& States)
+{
+	int32 TotalEntries = 0;
+	MarketEntryCounts.Reset(Markets.Num());
+	for (const FMarketInstance& Market : Markets)
+	{
+		int32 Row;
+		const int32 Count = GetBatchEntryCount(Market, States, Row);
+		MarketEntryCounts.Add(Count);
+		TotalEntries += Count;
+	}
+
+	Supply.SetNumUninitialized(TotalEntries);
+	Demand.SetNumUninitialized(TotalEntries);
+	Stock.SetNumUninitialized(TotalEntries);
+	MaxStock.SetNumUninitialized(TotalEntries);
+	ReplenishRate.SetNumUninitialized(TotalEntries);
+
+	// Resolve item assets once so the per-tick kernel never dereferences them
+	int32 Index = 0;
+	for (int32 MarketIndex = 0; MarketIndex < Markets.Num(); ++MarketIndex)
+	{
+		const UMarketDataAsset* Market = Markets[MarketIndex].Template;
+		for (int32 EntryIndex = 0; EntryIndex < MarketEntryCounts[MarketIndex]; ++EntryIndex)
+		{
+			// Rows are built from the template, but guard against inventory edited after registration
+			const FMarketInventoryEntry* Entry = Market->Inventory.IsValidIndex(EntryIndex) ? &Market->Inventory[EntryIndex] : nullptr;
+			MaxStock[Index] = Entry ? Entry->MaxStock : 0;
+			ReplenishRate[Index] = Entry && Entry->TradeItem ? static_cast<float>(Entry->TradeItem->ReplenishmentRate) : 0.0f;
+			++Index;
+		}
+	}
+
+	bLayoutDirty = false;
+}
+
+bool FEconomySimulationBatch::IsLayoutValid(const TArray<FMarketInstance>& Markets, const FMarketStateTable& States) const
+{
+	if (MarketEntryCounts.Num() != Markets.Num())
+	{
+		return false;
+	}
+
+	for (int32 i = 0; i < Markets.Num(); ++i)
+	{
+		int32 Row;
+		if (GetBatchEntryCount(Markets[i], States, Row) != MarketEntryCounts[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
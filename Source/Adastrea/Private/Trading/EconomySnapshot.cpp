@@ -0,0 +1,188 @@
+#include "Trading/EconomySnapshot.h"
+#include "AdastreaLog.h"
+
+// ====================
+// FEconomySnapshot
+// ====================
+
+bool FEconomySnapshot::HasMarketChangedSince(FName MarketID, uint64 SinceVersion) const
+{
+	const uint64* MarketVersion = MarketVersions.Find(MarketID);
+	return MarketVersion ? *MarketVersion > SinceVersion : Version > SinceVersion;
+}
+
+// ====================
+// FEconomySnapshotHandle
+// ====================
+
+FEconomySnapshotHandle::FEconomySnapshotHandle(FEconomySnapshotHandle&& Other)
+	: Snapshot(Other.Snapshot)
+	, Readers(Other.Readers)
+{
+	Other.Snapshot = nullptr;
+	Other.Readers = nullptr;
+}
+
+FEconomySnapshotHandle& FEconomySnapshotHandle::operator=(FEconomySnapshotHandle&& Other)
+{
+	if (this != &Other)
+	{
+		Release();
+		Snapshot = Other.Snapshot;
+		Readers = Other.Readers;
+		Other.Snapshot = nullptr;
+		Other.Readers = nullptr;
+	}
+	return *this;
+}
+
+void FEconomySnapshotHandle::Release()
+{
+	if (Readers)
+	{
+		Readers->fetch_sub(1);
+	}
+	Snapshot = nullptr;
+	Readers = nullptr;
+}
+
+// ====================
+// FEconomySnapshotBuffer
+// ====================
+
+bool FEconomySnapshotBuffer::Publish(const FMarketStateTable& States, float GameTimeHours)
+{
+	// Only this thread stores PublishedSlot, so the current slot cannot change underneath us
+	const int32 CurrentSlot = PublishedSlot.load();
+	const FEconomySnapshot* Previous = CurrentSlot != INDEX_NONE ? &Slots[CurrentSlot].Snapshot : nullptr;
+
+	// Diff against the published snapshot first, so unchanged ticks cost no copy
+	TBitArray<> ChangedRows(Previous == nullptr, States.NumRows());
+	bool bChanged = Previous == nullptr;
+	if (Previous)
+	{
+		int32 MatchedRows = 0;
+		for (int32 Row = 0; Row < States.NumRows(); ++Row)
+		{
+			MatchedRows += Previous->MarketStates.FindRow(States.GetRow(Row).MarketID) != INDEX_NONE ? 1 : 0;
+			if (HasRowChanged(States, Row, Previous->MarketStates))
+			{
+				ChangedRows[Row] = true;
+				bChanged = true;
+			}
+		}
+
+		// Rows that only exist in the previous snapshot were unregistered
+		bChanged |= MatchedRows != Previous->MarketStates.NumRows();
+	}
+
+	if (!bChanged)
+	{
+		return false;
+	}
+
+	int32 TargetSlot = INDEX_NONE;
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		if (Slot != CurrentSlot && Slots[Slot].Readers.load() == 0)
+		{
+			TargetSlot = Slot;
+			break;
+		}
+	}
+
+	if (TargetSlot == INDEX_NONE)
+	{
+		UE_LOG(LogAdastreaTrading, Verbose, TEXT("EconomySnapshot: All buffers pinned by readers, publish deferred"));
+		return false;
+	}
+
+	const uint64 NewVersion = PublishedVersion.load() + 1;
+
+	FEconomySnapshot& Next = Slots[TargetSlot].Snapshot;
+	Next.Version = NewVersion;
+	Next.GameTimeHours = GameTimeHours;
+	Next.MarketStates = States;
+
+	Next.MarketVersions.Reset();
+	Next.MarketVersions.Reserve(States.NumRows());
+	for (int32 Row = 0; Row < States.NumRows(); ++Row)
+	{
+		const FName MarketID = States.GetRow(Row).MarketID;
+		Next.MarketVersions.Add(MarketID, ChangedRows[Row] ? NewVersion : Previous->MarketVersions.FindRef(MarketID));
+	}
+
+	// Buffer is fully written before readers can see it
+	PublishedSlot.store(TargetSlot);
+	PublishedVersion.store(NewVersion);
+	return true;
+}
+
+FEconomySnapshotHandle FEconomySnapshotBuffer::Acquire() const
+{
+	for (;;)
+	{
+		const int32 Slot = PublishedSlot.load();
+		if (Slot == INDEX_NONE)
+		{
+			return FEconomySnapshotHandle();
+		}
+
+		// Pin, then confirm the slot is still published; otherwise the writer may already be reusing it
+		Slots[Slot].Readers.fetch_add(1);
+		if (PublishedSlot.load() == Slot)
+		{
+			return FEconomySnapshotHandle(&Slots[Slot].Snapshot, &Slots[Slot].Readers);
+		}
+		Slots[Slot].Readers.fetch_sub(1);
+	}
+}
+
+void FEconomySnapshotBuffer::Reset()
+{
+	PublishedSlot.store(INDEX_NONE);
+
+	for (FSlot& Slot : Slots)
+	{
+		if (Slot.Readers.load() == 0)
+		{
+			Slot.Snapshot = FEconomySnapshot();
+		}
+	}
+}
+
+SIZE_T FEconomySnapshotBuffer::GetAllocatedSize() const
+{
+	SIZE_T Size = 0;
+	for (const FSlot& Slot : Slots)
+	{
+		Size += Slot.Snapshot.MarketStates.GetAllocatedSize() + Slot.Snapshot.MarketVersions.GetAllocatedSize();
+	}
+	return Size;
+}
+
+bool FEconomySnapshotBuffer::HasRowChanged(const FMarketStateTable& States, int32 Row, const FMarketStateTable& Previous)
+{
+	const int32 PreviousRow = Previous.FindRow(States.GetRow(Row).MarketID);
+	if (PreviousRow == INDEX_NONE)
+	{
+		return true;
+	}
+
+	// Event state only reaches prices through each item's EventMultiplier, so items are enough
+	const TConstArrayView<FMarketItemState> Items = States.GetItems(Row);
+	const TConstArrayView<FMarketItemState> PreviousItems = Previous.GetItems(PreviousRow);
+	if (Items.Num() != PreviousItems.Num())
+	{
+		return true;
+	}
+
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		if (Items[Index] != PreviousItems[Index])
+		{
+			return true;
+		}
+	}
+	return false;
+}
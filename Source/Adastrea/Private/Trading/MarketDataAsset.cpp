@@ -1,5 +1,9 @@
 #include "Trading/MarketDataAsset.h"
 #include "Trading/TradeItemDataAsset.h"
+#include "Trading/EconomyManager.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
 // REMOVED: #include "Factions/FactionDataAsset.h" - faction system removed per Trade Simulator MVP
 
 UMarketDataAsset::UMarketDataAsset()
@@ -17,14 +21,59 @@ UMarketDataAsset::UMarketDataAsset()
 	, bAllowAITraders(true)
 	// REMOVED: MinReputationRequired - faction reputation system removed per Trade Simulator MVP
 	, StockRefreshRate(24.0f)
-	, LastStockRefreshTime(0.0f)
 	, RandomEventChance(0.1f)
 	, AITraderCount(5)
 	, AITradeFrequency(10)
 	, bAllowAIPriceManipulation(true)
+	, IndexedInventoryNum(0)
+	, bInventoryIndexDirty(true)
+	, GlobalEventMultiplier(1.0f)
+	, CachedEventCount(0)
+	, bEventCacheDirty(true)
+	, bHasCustomMarketPriceOverride(true)
 {
 }
 
+void UMarketDataAsset::PostInitProperties()
+{
+	Super::PostInitProperties();
+	DetectPriceOverride();
+}
+
+void UMarketDataAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	// Blueprint classes are fully linked by now
+	DetectPriceOverride();
+
+	// Loaded inventory/events may differ from whatever was cached before
+	InvalidateInventoryIndex();
+	InvalidateEventCache();
+}
+
+#if WITH_EDITOR
+void UMarketDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UMarketDataAsset, Inventory))
+	{
+		InvalidateInventoryIndex();
+	}
+	else if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UMarketDataAsset, ActiveEvents))
+	{
+		InvalidateEventCache();
+	}
+}
+#endif
+
+void UMarketDataAsset::DetectPriceOverride()
+{
+	bHasCustomMarketPriceOverride = TradePricing::IsPriceEventOverridden(
+		GetClass(), UMarketDataAsset::StaticClass(), GET_FUNCTION_NAME_CHECKED(UMarketDataAsset, OnCalculateCustomMarketPrice));
+}
+
 float UMarketDataAsset::GetItemPrice(UTradeItemDataAsset* TradeItem, bool bIsBuying) const
 {
 	if (!TradeItem)
@@ -32,15 +81,39 @@ float UMarketDataAsset::GetItemPrice(UTradeItemDataAsset* TradeItem, bool bIsBuy
 		return 0.0f;
 	}
 
-	// Find inventory entry for supply/demand data
-	FMarketInventoryEntry FoundEntry;
-	bool bFound = GetInventoryEntry(TradeItem->ItemID, FoundEntry);
+	// Unlisted items price at neutral supply/demand
+	const int32 Index = FindInventoryIndex(TradeItem->ItemID);
+	FMarketItemState State;
+	if (Index != INDEX_NONE)
+	{
+		State = MakeInitialItemState(Index);
+	}
+	else
+	{
+		State.EventMultiplier = GetEventPriceMultiplier(TradeItem->ItemID);
+	}
+
+	return CalculateItemPrice(TradeItem, bIsBuying, State);
+}
+
+FMarketItemState UMarketDataAsset::MakeInitialItemState(int32 InventoryIndex) const
+{
+	const FMarketInventoryEntry& Entry = Inventory[InventoryIndex];
 
-	float Supply = bFound ? FoundEntry.SupplyLevel : 1.0f;
-	float Demand = bFound ? FoundEntry.DemandLevel : 1.0f;
+	FMarketItemState State;
+	State.CurrentStock = Entry.CurrentStock;
+	State.SupplyLevel = Entry.SupplyLevel;
+	State.DemandLevel = Entry.DemandLevel;
+	State.EventMultiplier = Entry.TradeItem ? GetEventPriceMultiplier(Entry.TradeItem->ItemID) : 1.0f;
+	State.bInStock = Entry.CurrentStock > 0;
+	return State;
+}
 
-	// Get event multiplier
-	float EventMultiplier = GetEventPriceMultiplier(TradeItem->ItemID);
+float UMarketDataAsset::CalculateNativePrice(const UTradeItemDataAsset* TradeItem, bool bIsBuying, const FMarketItemState& State) const
+{
+	const float Supply = State.SupplyLevel;
+	const float Demand = State.DemandLevel;
+	const float EventMultiplier = State.EventMultiplier;
 
 	// Calculate base price using supply/demand dynamics
 	// This logic moved from TradeItemDataAsset to centralize pricing in Market
@@ -95,32 +168,113 @@ float UMarketDataAsset::GetItemPrice(UTradeItemDataAsset* TradeItem, bool bIsBuy
 	// Apply transaction tax
 	BasePrice *= (1.0f + TransactionTaxRate);
 
-	// Allow TradeItem Blueprint override, then Market Blueprint override
-	float CustomPrice = TradeItem->OnCalculateCustomPrice(Supply, Demand, EventMultiplier, BasePrice);
-	return OnCalculateCustomMarketPrice(TradeItem, bIsBuying, CustomPrice);
+	return BasePrice;
+}
+
+float UMarketDataAsset::CalculateItemPrice(UTradeItemDataAsset* TradeItem, bool bIsBuying, const FMarketItemState& State) const
+{
+	float Price = CalculateNativePrice(TradeItem, bIsBuying, State);
+
+	// Allow TradeItem Blueprint override, then Market Blueprint override.
+	// The default implementations return the price unchanged, so skip the
+	// Blueprint VM entirely for classes that do not override them.
+	if (TradeItem->HasCustomPriceOverride())
+	{
+		Price = TradeItem->OnCalculateCustomPrice(State.SupplyLevel, State.DemandLevel, State.EventMultiplier, Price);
+	}
+	if (bHasCustomMarketPriceOverride)
+	{
+		Price = OnCalculateCustomMarketPrice(TradeItem, bIsBuying, Price);
+	}
+	return Price;
 }
 
 bool UMarketDataAsset::GetInventoryEntry(FName ItemID, FMarketInventoryEntry& OutEntry) const
 {
-	for (const FMarketInventoryEntry& Entry : Inventory)
+	if (const FMarketInventoryEntry* Entry = FindInventoryEntry(ItemID))
 	{
-		if (Entry.TradeItem && Entry.TradeItem->ItemID == ItemID)
-		{
-			OutEntry = Entry;
-			return true;
-		}
+		OutEntry = *Entry;
+		return true;
 	}
 	return false;
 }
 
-bool UMarketDataAsset::IsItemInStock(FName ItemID, int32 Quantity) const
+const FMarketInventoryEntry* UMarketDataAsset::FindInventoryEntry(FName ItemID) const
 {
-	FMarketInventoryEntry Entry;
-	if (GetInventoryEntry(ItemID, Entry))
+	const int32 Index = FindInventoryIndex(ItemID);
+	return Index != INDEX_NONE ? &Inventory[Index] : nullptr;
+}
+
+const FMarketInventoryEntry* UMarketDataAsset::FindInventoryEntry(const UTradeItemDataAsset* TradeItem) const
+{
+	const int32 Index = FindInventoryIndex(TradeItem);
+	return Index != INDEX_NONE ? &Inventory[Index] : nullptr;
+}
+
+int32 UMarketDataAsset::FindInventoryIndex(FName ItemID) const
+{
+	if (ItemID.IsNone())
 	{
-		return Entry.bInStock && Entry.CurrentStock >= Quantity;
+		return INDEX_NONE;
 	}
-	return false;
+
+	UpdateInventoryIndex();
+
+	const int32* Index = ItemIDToInventoryIndex.Find(ItemID);
+	return Index ? *Index : INDEX_NONE;
+}
+
+int32 UMarketDataAsset::FindInventoryIndex(const UTradeItemDataAsset* TradeItem) const
+{
+	if (!TradeItem)
+	{
+		return INDEX_NONE;
+	}
+
+	UpdateInventoryIndex();
+
+	const int32* Index = ItemToInventoryIndex.Find(TradeItem);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void UMarketDataAsset::InvalidateInventoryIndex()
+{
+	bInventoryIndexDirty = true;
+}
+
+void UMarketDataAsset::UpdateInventoryIndex() const
+{
+	if (!bInventoryIndexDirty && IndexedInventoryNum == Inventory.Num())
+	{
+		return;
+	}
+
+	ItemIDToInventoryIndex.Reset();
+	ItemToInventoryIndex.Reset();
+	ItemIDToInventoryIndex.Reserve(Inventory.Num());
+	ItemToInventoryIndex.Reserve(Inventory.Num());
+
+	for (int32 Index = 0; Index < Inventory.Num(); ++Index)
+	{
+		const UTradeItemDataAsset* TradeItem = Inventory[Index].TradeItem;
+		if (!TradeItem)
+		{
+			continue;
+		}
+
+		// First entry wins, matching the previous linear search
+		if (!ItemToInventoryIndex.Contains(TradeItem))
+		{
+			ItemToInventoryIndex.Add(TradeItem, Index);
+		}
+		if (!ItemIDToInventoryIndex.Contains(TradeItem->ItemID))
+		{
+			ItemIDToInventoryIndex.Add(TradeItem->ItemID, Index);
+		}
+	}
+
+	IndexedInventoryNum = Inventory.Num();
+	bInventoryIndexDirty = false;
 }
 
 TArray<FMarketInventoryEntry> UMarketDataAsset::GetItemsByCategory(ETradeItemCategory Category) const
@@ -141,106 +295,116 @@ TArray<FMarketInventoryEntry> UMarketDataAsset::GetItemsByCategory(ETradeItemCat
 // REMOVED: CanPlayerAccess() - faction reputation system removed per Trade Simulator MVP
 // All players can access all markets in MVP Trading
 
-TArray<FMarketEvent> UMarketDataAsset::GetActiveEventsForItem(FName ItemID) const
+namespace MarketDataAssetHelpers
 {
-	TArray<FMarketEvent> Result;
-	
-	for (const FMarketEvent& Event : ActiveEvents)
+	UEconomyManager* FindEconomyManager(const UObject* WorldContextObject)
 	{
-		if (!Event.bIsActive)
-		{
-			continue;
-		}
-
-		// If event has no specific items, it affects all items
-		if (Event.AffectedItemIDs.Num() == 0 || Event.AffectedItemIDs.Contains(ItemID))
-		{
-			Result.Add(Event);
-		}
+		const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+		UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		return GameInstance ? GameInstance->GetSubsystem<UEconomyManager>() : nullptr;
 	}
-	
-	return Result;
 }
 
-float UMarketDataAsset::GetEventPriceMultiplier(FName ItemID) const
+bool UMarketDataAsset::IsItemInStock(const UObject* WorldContextObject, FName ItemID, int32 Quantity) const
 {
-	float TotalMultiplier = 1.0f;
-	
-	TArray<FMarketEvent> Events = GetActiveEventsForItem(ItemID);
-	for (const FMarketEvent& Event : Events)
+	UEconomyManager* EconomyManager = MarketDataAssetHelpers::FindEconomyManager(WorldContextObject);
+	const FMarketInventoryEntry* Entry = FindInventoryEntry(ItemID);
+	if (!EconomyManager || !Entry)
 	{
-		TotalMultiplier *= Event.PriceMultiplier;
+		return false;
 	}
-	
-	return TotalMultiplier;
+
+	return EconomyManager->IsItemInStock(const_cast<UMarketDataAsset*>(this), Entry->TradeItem, Quantity);
 }
 
-void UMarketDataAsset::UpdateMarket(float DeltaHours)
+TArray<FMarketEvent> UMarketDataAsset::GetActiveEventsForItem(const UObject* WorldContextObject, FName ItemID) const
 {
-	// Update stock refresh
-	if (StockRefreshRate > 0.0f)
-	{
-		LastStockRefreshTime += DeltaHours;
-		if (LastStockRefreshTime >= StockRefreshRate)
-		{
-			RefreshStock();
-			LastStockRefreshTime = 0.0f;
-		}
-	}
+	UEconomyManager* EconomyManager = MarketDataAssetHelpers::FindEconomyManager(WorldContextObject);
+	return EconomyManager ? EconomyManager->GetActiveEventsForItem(const_cast<UMarketDataAsset*>(this), ItemID) : TArray<FMarketEvent>();
+}
 
-	// Update supply/demand based on trading activity
-	for (FMarketInventoryEntry& Entry : Inventory)
-	{
-		if (!Entry.TradeItem)
-		{
-			continue;
-		}
+bool UMarketDataAsset::StartMarketEvent(const UObject* WorldContextObject, FName EventID, float CurrentGameTime)
+{
+	UEconomyManager* EconomyManager = MarketDataAssetHelpers::FindEconomyManager(WorldContextObject);
+	return EconomyManager && EconomyManager->StartMarketEvent(this, EventID);
+}
 
-		// Gradually normalize supply and demand towards 1.0
-		float NormalizationRate = DeltaHours / 24.0f; // Normalize over 24 hours
-		Entry.SupplyLevel = FMath::Lerp(Entry.SupplyLevel, 1.0f, NormalizationRate);
-		Entry.DemandLevel = FMath::Lerp(Entry.DemandLevel, 1.0f, NormalizationRate);
-	}
+float UMarketDataAsset::GetEventPriceMultiplier(FName ItemID) const
+{
+	UpdateEventCache();
+
+	const float* ItemMultiplier = ItemEventMultipliers.Find(ItemID);
+	return ItemMultiplier ? GlobalEventMultiplier * *ItemMultiplier : GlobalEventMultiplier;
 }
 
-void UMarketDataAsset::RefreshStock()
+float UMarketDataAsset::GetEventPriceMultiplier(FName ItemID, TConstArrayView<FMarketEventState> EventStates) const
 {
-	for (FMarketInventoryEntry& Entry : Inventory)
+	float Multiplier = 1.0f;
+	const int32 NumEvents = FMath::Min(ActiveEvents.Num(), EventStates.Num());
+
+	for (int32 EventIndex = 0; EventIndex < NumEvents; ++EventIndex)
 	{
-		if (!Entry.TradeItem)
+		const FMarketEvent& Event = ActiveEvents[EventIndex];
+		if (!EventStates[EventIndex].bIsActive)
 		{
 			continue;
 		}
 
-		// Replenish stock
-		int32 ReplenishAmount = Entry.TradeItem->ReplenishmentRate;
-		Entry.CurrentStock = FMath::Min(Entry.CurrentStock + ReplenishAmount, Entry.MaxStock);
-		Entry.bInStock = Entry.CurrentStock > 0;
+		// Empty AffectedItemIDs affects every item; duplicates count once
+		if (Event.AffectedItemIDs.Num() == 0 || Event.AffectedItemIDs.Contains(ItemID))
+		{
+			Multiplier *= Event.PriceMultiplier;
+		}
 	}
 
-	OnStockRefreshed();
+	return Multiplier;
 }
 
-void UMarketDataAsset::UpdateMarketEvents(float CurrentGameTime)
+void UMarketDataAsset::InvalidateEventCache()
 {
-	for (FMarketEvent& Event : ActiveEvents)
+	bEventCacheDirty = true;
+}
+
+void UMarketDataAsset::UpdateEventCache() const
+{
+	if (!bEventCacheDirty && CachedEventCount == ActiveEvents.Num())
+	{
+		return;
+	}
+
+	ItemEventMultipliers.Reset();
+	GlobalEventMultiplier = 1.0f;
+
+	for (const FMarketEvent& Event : ActiveEvents)
 	{
 		if (!Event.bIsActive)
 		{
 			continue;
 		}
 
-		// Check if event should expire
-		if (Event.DurationHours > 0.0f)
+		// If event has no specific items, it affects all items
+		if (Event.AffectedItemIDs.Num() == 0)
+		{
+			GlobalEventMultiplier *= Event.PriceMultiplier;
+			continue;
+		}
+
+		for (int32 i = 0; i < Event.AffectedItemIDs.Num(); ++i)
 		{
-			float ElapsedTime = CurrentGameTime - Event.StartTime;
-			if (ElapsedTime >= Event.DurationHours)
+			const FName ItemID = Event.AffectedItemIDs[i];
+
+			// Apply each event once per item even if the ID is listed twice
+			if (Event.AffectedItemIDs.Find(ItemID) != i)
 			{
-				Event.bIsActive = false;
-				OnMarketEventEnded(Event);
+				continue;
 			}
+
+			ItemEventMultipliers.FindOrAdd(ItemID, 1.0f) *= Event.PriceMultiplier;
 		}
 	}
+
+	CachedEventCount = ActiveEvents.Num();
+	bEventCacheDirty = false;
 }
 
 // BlueprintNativeEvent implementations
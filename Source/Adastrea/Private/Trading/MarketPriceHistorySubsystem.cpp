@@ -0,0 +1,110 @@
+#include "Trading/MarketPriceHistorySubsystem.h"
+#include "Trading/EconomyManager.h"
+#include "Trading/MarketDataAsset.h"
+#include "Trading/TradeItemDataAsset.h"
+#include "AdastreaLog.h"
+
+UMarketPriceHistorySubsystem::UMarketPriceHistorySubsystem()
+	: HourCandleCount(48)		// 2 game days
+	, DayCandleCount(60)		// ~2 game months
+	, WeekCandleCount(52)		// 1 game year
+	, EconomyManager(nullptr)
+{
+}
+
+void UMarketPriceHistorySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	EconomyManager = Collection.InitializeDependency<UEconomyManager>();
+	if (EconomyManager)
+	{
+		EconomyManager->OnMarketUnregistered.AddDynamic(this, &UMarketPriceHistorySubsystem::HandleMarketUnregistered);
+	}
+}
+
+void UMarketPriceHistorySubsystem::Deinitialize()
+{
+	if (EconomyManager)
+	{
+		EconomyManager->OnMarketUnregistered.RemoveAll(this);
+		EconomyManager = nullptr;
+	}
+
+	History.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMarketPriceHistorySubsystem::RecordTrade(UMarketDataAsset* Market, UTradeItemDataAsset* Item, float Price, int32 Quantity)
+{
+	RecordTradeAt(Market, Item, Price, Quantity, EconomyManager ? EconomyManager->GetGameTime() : 0.0f);
+}
+
+void UMarketPriceHistorySubsystem::RecordTradeAt(const UMarketDataAsset* Market, const UTradeItemDataAsset* Item, float Price, int32 Quantity, float GameTimeHours)
+{
+	if (!Market || !Item || Quantity <= 0)
+	{
+		return;
+	}
+
+	TMap<const UTradeItemDataAsset*, FPriceCandleSeries>& MarketHistory = History.FindOrAdd(Market);
+	FPriceCandleSeries* Series = MarketHistory.Find(Item);
+	if (!Series)
+	{
+		Series = &MarketHistory.Add(Item);
+		Series->SetCapacities(HourCandleCount, DayCandleCount, WeekCandleCount);
+	}
+
+	Series->AddTrade(GameTimeHours, Price, Quantity);
+}
+
+void UMarketPriceHistorySubsystem::ClearMarketHistory(UMarketDataAsset* Market)
+{
+	History.Remove(Market);
+}
+
+TArray<FPriceCandle> UMarketPriceHistorySubsystem::GetCandles(UMarketDataAsset* Market, UTradeItemDataAsset* Item, EPriceCandleResolution Resolution, int32 MaxCount) const
+{
+	TArray<FPriceCandle> Candles;
+	if (const FPriceCandleSeries* Series = FindSeries(Market, Item))
+	{
+		Series->GetCandles(Resolution, MaxCount, Candles);
+	}
+	return Candles;
+}
+
+float UMarketPriceHistorySubsystem::GetAveragePrice(UMarketDataAsset* Market, UTradeItemDataAsset* Item, EPriceCandleResolution Resolution, int32 Buckets) const
+{
+	const FPriceCandleSeries* Series = FindSeries(Market, Item);
+	return Series ? Series->GetVolumeWeightedPrice(Resolution, Buckets) : 0.0f;
+}
+
+float UMarketPriceHistorySubsystem::GetPriceTrend(UMarketDataAsset* Market, UTradeItemDataAsset* Item, EPriceCandleResolution Resolution, int32 Buckets) const
+{
+	const FPriceCandleSeries* Series = FindSeries(Market, Item);
+	return Series ? Series->GetPriceTrend(Resolution, Buckets) : 0.0f;
+}
+
+const FPriceCandleSeries* UMarketPriceHistorySubsystem::FindSeries(const UMarketDataAsset* Market, const UTradeItemDataAsset* Item) const
+{
+	const TMap<const UTradeItemDataAsset*, FPriceCandleSeries>* MarketHistory = History.Find(Market);
+	return MarketHistory ? MarketHistory->Find(Item) : nullptr;
+}
+
+int32 UMarketPriceHistorySubsystem::GetSeriesCount() const
+{
+	int32 Count = 0;
+	for (const TPair<const UMarketDataAsset*, TMap<const UTradeItemDataAsset*, FPriceCandleSeries>>& Pair : History)
+	{
+		Count += Pair.Value.Num();
+	}
+	return Count;
+}
+
+void UMarketPriceHistorySubsystem::HandleMarketUnregistered(UMarketDataAsset* Market)
+{
+	ClearMarketHistory(Market);
+
+	UE_LOG(LogAdastreaTrading, Verbose, TEXT("MarketPriceHistory: Dropped history for unregistered market"));
+}
@@ -0,0 +1,281 @@
+#include "Trading/MarketStateTable.h"
+#include "Trading/MarketDataAsset.h"
+#include "Trading/TradeItemDataAsset.h"
+
+namespace MarketStateTableFormat
+{
+	/** Bump when the serialized layout changes */
+	constexpr int32 Version = 2;
+
+	/** Oldest layout still loaded; version 1 rows carried an unused stock refresh timer */
+	constexpr int32 MinLoadableVersion = 1;
+}
+
+FName FMarketStateTable::GetMarketKey(const UMarketDataAsset* Market)
+{
+	if (!Market)
+	{
+		return NAME_None;
+	}
+	return Market->MarketID.IsNone() ? Market->GetFName() : Market->MarketID;
+}
+
+FName FMarketStateTable::MakeInstanceID(const UMarketDataAsset* Template) const
+{
+	const FName Key = GetMarketKey(Template);
+	if (Key.IsNone() || !RowByID.Contains(Key))
+	{
+		return Key;
+	}
+
+	// Same name with the next free number suffix (Key_1, Key_2, ...)
+	for (int32 Number = Key.GetNumber() + 1; ; ++Number)
+	{
+		const FName Candidate(Key, Number);
+		if (!RowByID.Contains(Candidate))
+		{
+			return Candidate;
+		}
+	}
+}
+
+int32 FMarketStateTable::AddMarket(const UMarketDataAsset* Template, FName InstanceID)
+{
+	if (!Template || InstanceID.IsNone() || RowByID.Contains(InstanceID))
+	{
+		return INDEX_NONE;
+	}
+
+	FMarketStateRow& Row = Rows.AddDefaulted_GetRef();
+	Row.MarketID = InstanceID;
+	Row.FirstItem = Items.Num();
+	Row.NumItems = Template->Inventory.Num();
+	Row.FirstEvent = Events.Num();
+	Row.NumEvents = Template->ActiveEvents.Num();
+
+	Items.Reserve(Items.Num() + Row.NumItems);
+	for (int32 Index = 0; Index < Row.NumItems; ++Index)
+	{
+		Items.Add(Template->MakeInitialItemState(Index));
+	}
+
+	Events.Reserve(Events.Num() + Row.NumEvents);
+	for (const FMarketEvent& Event : Template->ActiveEvents)
+	{
+		FMarketEventState& EventState = Events.AddDefaulted_GetRef();
+		EventState.StartTime = Event.StartTime;
+		EventState.bIsActive = Event.bIsActive;
+	}
+
+	const int32 RowIndex = Rows.Num() - 1;
+	RowByID.Add(InstanceID, RowIndex);
+	return RowIndex;
+}
+
+bool FMarketStateTable::RemoveMarket(FName MarketID)
+{
+	const int32 RowIndex = FindRow(MarketID);
+	if (RowIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const FMarketStateRow Removed = Rows[RowIndex];
+	Items.RemoveAt(Removed.FirstItem, Removed.NumItems, EAllowShrinking::No);
+	Events.RemoveAt(Removed.FirstEvent, Removed.NumEvents, EAllowShrinking::No);
+	Rows.RemoveAt(RowIndex, 1, EAllowShrinking::No);
+
+	for (int32 Index = RowIndex; Index < Rows.Num(); ++Index)
+	{
+		Rows[Index].FirstItem -= Removed.NumItems;
+		Rows[Index].FirstEvent -= Removed.NumEvents;
+	}
+
+	RebuildRowIndex();
+	return true;
+}
+
+void FMarketStateTable::Reset()
+{
+	Rows.Reset();
+	Items.Reset();
+	Events.Reset();
+	RowByID.Reset();
+}
+
+int32 FMarketStateTable::FindRow(FName MarketID) const
+{
+	const int32* RowIndex = RowByID.Find(MarketID);
+	return RowIndex ? *RowIndex : INDEX_NONE;
+}
+
+TArrayView<FMarketItemState> FMarketStateTable::GetItems(int32 Row)
+{
+	return TArrayView<FMarketItemState>(Items.GetData() + Rows[Row].FirstItem, Rows[Row].NumItems);
+}
+
+TConstArrayView<FMarketItemState> FMarketStateTable::GetItems(int32 Row) const
+{
+	return TConstArrayView<FMarketItemState>(Items.GetData() + Rows[Row].FirstItem, Rows[Row].NumItems);
+}
+
+TArrayView<FMarketEventState> FMarketStateTable::GetEvents(int32 Row)
+{
+	return TArrayView<FMarketEventState>(Events.GetData() + Rows[Row].FirstEvent, Rows[Row].NumEvents);
+}
+
+TConstArrayView<FMarketEventState> FMarketStateTable::GetEvents(int32 Row) const
+{
+	return TConstArrayView<FMarketEventState>(Events.GetData() + Rows[Row].FirstEvent, Rows[Row].NumEvents);
+}
+
+FMarketItemState* FMarketStateTable::FindItem(FName InstanceID, const UMarketDataAsset* Template, const UTradeItemDataAsset* Item)
+{
+	return const_cast<FMarketItemState*>(static_cast<const FMarketStateTable*>(this)->FindItem(InstanceID, Template, Item));
+}
+
+const FMarketItemState* FMarketStateTable::FindItem(FName InstanceID, const UMarketDataAsset* Template, const UTradeItemDataAsset* Item) const
+{
+	const int32 RowIndex = FindRow(InstanceID);
+	if (RowIndex == INDEX_NONE || !Template || !Item)
+	{
+		return nullptr;
+	}
+
+	// Rows keep the template's inventory order
+	const int32 ItemIndex = Template->FindInventoryIndex(Item);
+	const FMarketStateRow& Row = Rows[RowIndex];
+	return ItemIndex != INDEX_NONE && ItemIndex < Row.NumItems ? &Items[Row.FirstItem + ItemIndex] : nullptr;
+}
+
+float FMarketStateTable::GetItemPrice(FName InstanceID, const UMarketDataAsset* Template, UTradeItemDataAsset* Item, bool bIsBuying) const
+{
+	if (!Template || !Item)
+	{
+		return 0.0f;
+	}
+
+	const FMarketItemState* State = FindItem(InstanceID, Template, Item);
+	return State ? Template->CalculateItemPrice(Item, bIsBuying, *State) : Template->GetItemPrice(Item, bIsBuying);
+}
+
+void FMarketStateTable::RefreshEventMultipliers(int32 Row, const UMarketDataAsset* Template)
+{
+	if (!Template || !Rows.IsValidIndex(Row))
+	{
+		return;
+	}
+
+	const TConstArrayView<FMarketEventState> EventStates = static_cast<const FMarketStateTable*>(this)->GetEvents(Row);
+	const TArrayView<FMarketItemState> ItemStates = GetItems(Row);
+	const int32 NumToRefresh = FMath::Min(ItemStates.Num(), Template->Inventory.Num());
+
+	for (int32 Index = 0; Index < NumToRefresh; ++Index)
+	{
+		const UTradeItemDataAsset* TradeItem = Template->Inventory[Index].TradeItem;
+		ItemStates[Index].EventMultiplier = TradeItem ? Template->GetEventPriceMultiplier(TradeItem->ItemID, EventStates) : 1.0f;
+	}
+}
+
+void FMarketStateTable::FindChangedItems(const FMarketStateTable& Baseline, TArray<FMarketStateItemRef>& OutChanged) const
+{
+	OutChanged.Reset();
+
+	for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+	{
+		const FMarketStateRow& Row = Rows[RowIndex];
+		const int32 BaselineRow = Baseline.FindRow(Row.MarketID);
+		const bool bSameShape = BaselineRow != INDEX_NONE && Baseline.Rows[BaselineRow].NumItems == Row.NumItems;
+
+		const TConstArrayView<FMarketItemState> Current = GetItems(RowIndex);
+		const TConstArrayView<FMarketItemState> Previous = bSameShape ? Baseline.GetItems(BaselineRow) : TConstArrayView<FMarketItemState>();
+		for (int32 Index = 0; Index < Current.Num(); ++Index)
+		{
+			if (!bSameShape || Current[Index] != Previous[Index])
+			{
+				OutChanged.Add({ Row.MarketID, Index });
+			}
+		}
+	}
+}
+
+SIZE_T FMarketStateTable::GetAllocatedSize() const
+{
+	return Rows.GetAllocatedSize() + Items.GetAllocatedSize() + Events.GetAllocatedSize() + RowByID.GetAllocatedSize();
+}
+
+void FMarketStateTable::RebuildRowIndex()
+{
+	RowByID.Reset();
+	for (int32 Index = 0; Index < Rows.Num(); ++Index)
+	{
+		RowByID.Add(Rows[Index].MarketID, Index);
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FMarketStateTable& Table)
+{
+	int32 Version = MarketStateTableFormat::Version;
+	Ar << Version;
+	if (Ar.IsLoading() && (Version < MarketStateTableFormat::MinLoadableVersion || Version > MarketStateTableFormat::Version))
+	{
+		Ar.SetError();
+		return Ar;
+	}
+
+	int32 NumRows = Table.Rows.Num();
+	int32 NumItems = Table.Items.Num();
+	int32 NumEvents = Table.Events.Num();
+	Ar << NumRows << NumItems << NumEvents;
+
+	if (Ar.IsLoading())
+	{
+		if (NumRows < 0 || NumItems < 0 || NumEvents < 0)
+		{
+			Ar.SetError();
+			return Ar;
+		}
+		Table.Rows.SetNum(NumRows);
+		Table.Items.SetNum(NumItems);
+		Table.Events.SetNum(NumEvents);
+	}
+
+	for (FMarketStateRow& Row : Table.Rows)
+	{
+		Ar << Row.MarketID;
+		if (Ar.IsLoading() && Version < 2)
+		{
+			float LegacyStockRefreshTime = 0.0f;
+			Ar << LegacyStockRefreshTime;
+		}
+		Ar << Row.FirstItem << Row.NumItems << Row.FirstEvent << Row.NumEvents;
+	}
+
+	for (FMarketItemState& Item : Table.Items)
+	{
+		Ar << Item.CurrentStock << Item.SupplyLevel << Item.DemandLevel << Item.LastTradePrice << Item.EventMultiplier << Item.bInStock;
+	}
+
+	for (FMarketEventState& Event : Table.Events)
+	{
+		Ar << Event.StartTime << Event.bIsActive;
+	}
+
+	if (Ar.IsLoading())
+	{
+		// Reject ranges that point outside the loaded arrays
+		for (const FMarketStateRow& Row : Table.Rows)
+		{
+			if (Row.FirstItem < 0 || Row.NumItems < 0 || Row.FirstItem + Row.NumItems > NumItems
+				|| Row.FirstEvent < 0 || Row.NumEvents < 0 || Row.FirstEvent + Row.NumEvents > NumEvents)
+			{
+				Table.Reset();
+				Ar.SetError();
+				return Ar;
+			}
+		}
+		Table.RebuildRowIndex();
+	}
+
+	return Ar;
+}
@@ -0,0 +1,211 @@
+#include "Trading/MarketTravelMatrix.h"
+#include "Navigation/SectorGraph.h"
+#include "SpaceSectorMap.h"
+
+void FMarketTravelMatrix::Reset()
+{
+	MarketSlots.Reset();
+	FreeMarketSlots.Reset();
+	MarketToSlot.Reset();
+	SectorGraph = nullptr;
+	SectorPaths.Reset();
+	Distances.Reset();
+	MatrixStride = 0;
+	bSectorsDirty = false;
+}
+
+void FMarketTravelMatrix::SetSectorGraph(const FSectorGraph* InGraph)
+{
+	if (SectorGraph != InGraph)
+	{
+		SectorGraph = InGraph;
+		bSectorsDirty = true;
+	}
+}
+
+void FMarketTravelMatrix::SetMarketLocation(const UMarketDataAsset* Market, const FVector& WorldLocation)
+{
+	if (!Market)
+	{
+		return;
+	}
+
+	int32 Slot = INDEX_NONE;
+	if (const int32* ExistingSlot = MarketToSlot.Find(Market))
+	{
+		Slot = *ExistingSlot;
+	}
+	else
+	{
+		Slot = FreeMarketSlots.Num() > 0 ? FreeMarketSlots.Pop(EAllowShrinking::No) : MarketSlots.AddDefaulted();
+		MarketToSlot.Add(Market, Slot);
+	}
+
+	FMarketNode& Node = MarketSlots[Slot];
+	Node.Market = Market;
+	Node.Location = WorldLocation;
+
+	// A pending sector rebuild recomputes every row anyway
+	if (!bSectorsDirty)
+	{
+		Node.Sector = FindSector(WorldLocation);
+		if (Node.Sector != INDEX_NONE)
+		{
+			SectorGraph->ComputeDistancesFrom(Node.Sector, SectorPaths);
+		}
+		ReserveSlots(MarketSlots.Num());
+		UpdateMarketRow(Slot, SectorPaths);
+	}
+}
+
+void FMarketTravelMatrix::RemoveMarket(const UMarketDataAsset* Market)
+{
+	int32 Slot = INDEX_NONE;
+	if (!MarketToSlot.RemoveAndCopyValue(Market, Slot))
+	{
+		return;
+	}
+
+	// Stale row/column is never read again and is overwritten when the slot is reused
+	MarketSlots[Slot] = FMarketNode();
+	FreeMarketSlots.Add(Slot);
+}
+
+float FMarketTravelMatrix::GetDistance(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination) const
+{
+	const int32* OriginSlot = MarketToSlot.Find(Origin);
+	const int32* DestinationSlot = MarketToSlot.Find(Destination);
+	if (!OriginSlot || !DestinationSlot)
+	{
+		return 0.0f;
+	}
+
+	UpdateIfDirty();
+	return Distances[*OriginSlot * MatrixStride + *DestinationSlot];
+}
+
+bool FMarketTravelMatrix::IsWithinRange(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination, float MaxDistance) const
+{
+	const float Distance = GetDistance(Origin, Destination);
+	if (Distance == Unreachable)
+	{
+		return false;
+	}
+	return MaxDistance <= 0.0f || Distance <= MaxDistance;
+}
+
+void FMarketTravelMatrix::UpdateIfDirty() const
+{
+	if (!bSectorsDirty)
+	{
+		return;
+	}
+	bSectorsDirty = false;
+
+	// Group markets by sector so each occupied sector runs Dijkstra once
+	TArray<int32> UsedSlots;
+	UsedSlots.Reserve(MarketToSlot.Num());
+	for (int32 Slot = 0; Slot < MarketSlots.Num(); ++Slot)
+	{
+		FMarketNode& Node = MarketSlots[Slot];
+		if (Node.Market)
+		{
+			Node.Sector = FindSector(Node.Location);
+			UsedSlots.Add(Slot);
+		}
+	}
+
+	UsedSlots.Sort([this](int32 A, int32 B)
+	{
+		return MarketSlots[A].Sector < MarketSlots[B].Sector;
+	});
+
+	ReserveSlots(MarketSlots.Num());
+
+	int32 PathsSector = INDEX_NONE;
+	SectorPaths.Reset();
+	for (const int32 Slot : UsedSlots)
+	{
+		const int32 Sector = MarketSlots[Slot].Sector;
+		if (Sector != INDEX_NONE && Sector != PathsSector)
+		{
+			SectorGraph->ComputeDistancesFrom(Sector, SectorPaths);
+			PathsSector = Sector;
+		}
+		UpdateMarketRow(Slot, SectorPaths);
+	}
+}
+
+int32 FMarketTravelMatrix::FindSector(const FVector& WorldLocation) const
+{
+	if (!SectorGraph)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Node = SectorGraph->FindNodeAt(ASpaceSectorMap::WorldToGridCoordinates(WorldLocation));
+	if (Node == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	// Sector centers need not sit exactly on the grid, so confirm the cell's sector actually contains the position
+	const FVector& Center = SectorGraph->GetCenter(Node);
+	const FVector HalfExtent(ASpaceSectorMap::SectorSize * 0.5f);
+	return FBox(Center - HalfExtent, Center + HalfExtent).IsInsideOrOn(WorldLocation) ? Node : INDEX_NONE;
+}
+
+void FMarketTravelMatrix::ReserveSlots(int32 MinStride) const
+{
+	if (MinStride <= MatrixStride)
+	{
+		return;
+	}
+
+	const int32 NewStride = FMath::Max(MinStride, MatrixStride * 2);
+	TArray<float> NewDistances;
+	NewDistances.SetNumZeroed(NewStride * NewStride);
+	for (int32 Row = 0; Row < MatrixStride; ++Row)
+	{
+		FMemory::Memcpy(&NewDistances[Row * NewStride], &Distances[Row * MatrixStride], MatrixStride * sizeof(float));
+	}
+
+	Distances = MoveTemp(NewDistances);
+	MatrixStride = NewStride;
+}
+
+void FMarketTravelMatrix::UpdateMarketRow(int32 Slot, const TArray<float>& PathsFromSlot) const
+{
+	for (int32 Other = 0; Other < MarketSlots.Num(); ++Other)
+	{
+		if (!MarketSlots[Other].Market)
+		{
+			continue;
+		}
+
+		const float Distance = ComputeDistance(Slot, Other, PathsFromSlot);
+		Distances[Slot * MatrixStride + Other] = Distance;
+		Distances[Other * MatrixStride + Slot] = Distance;
+	}
+}
+
+float FMarketTravelMatrix::ComputeDistance(int32 SlotA, int32 SlotB, const TArray<float>& PathsFromA) const
+{
+	const FMarketNode& A = MarketSlots[SlotA];
+	const FMarketNode& B = MarketSlots[SlotB];
+
+	if (A.Sector == INDEX_NONE || B.Sector == INDEX_NONE || A.Sector == B.Sector)
+	{
+		return static_cast<float>(FVector::Dist(A.Location, B.Location));
+	}
+
+	const float SectorPath = PathsFromA[B.Sector];
+	if (SectorPath == Unreachable)
+	{
+		return Unreachable;
+	}
+
+	return static_cast<float>(FVector::Dist(A.Location, SectorGraph->GetCenter(A.Sector))
+		+ SectorPath
+		+ FVector::Dist(SectorGraph->GetCenter(B.Sector), B.Location));
+}
@@ -25,7 +25,8 @@ bool UPlayerTraderComponent::BuyItem(UMarketDataAsset* Market, UTradeItemDataAss
 	}
 
 	// Check if market has stock
-	if (!Market->IsItemInStock(Item->ItemID, Quantity))
+	UEconomyManager* EconomyMgr = GetEconomyManager();
+	if (!EconomyMgr || !EconomyMgr->IsItemInStock(Market, Item, Quantity))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("PlayerTrader: Market doesn't have %d x %s"), Quantity, *Item->ItemName.ToString());
 		return false;
@@ -52,10 +53,7 @@ bool UPlayerTraderComponent::BuyItem(UMarketDataAsset* Market, UTradeItemDataAss
 	CargoComponent->AddCargo(Item, Quantity);
 
 	// Record transaction with economy manager
-	if (UEconomyManager* EconomyMgr = GetEconomyManager())
-	{
-		EconomyMgr->RecordTransaction(Market, Item, Quantity, true);
-	}
+	EconomyMgr->RecordTransaction(Market, Item, Quantity, true);
 
 	UE_LOG(LogTemp, Log, TEXT("PlayerTrader: Bought %d x %s for %d credits (remaining: %d)"), 
 		Quantity, *Item->ItemName.ToString(), TotalCost, Credits);
@@ -0,0 +1,148 @@
+#include "Trading/PriceCandleSeries.h"
+
+// ====================
+// CANDLE RING
+// ====================
+
+void FPriceCandleRing::SetCapacity(int32 InCapacity)
+{
+	const int32 NewCapacity = FMath::Max(1, InCapacity);
+	if (NewCapacity == Candles.Num())
+	{
+		return;
+	}
+
+	const int32 NumToKeep = FMath::Min(Count, NewCapacity);
+	TArray<FPriceCandle> Retained;
+	Retained.Reserve(NewCapacity);
+	for (int32 Index = Count - NumToKeep; Index < Count; ++Index)
+	{
+		Retained.Add(Get(Index));
+	}
+	Retained.SetNum(NewCapacity);
+
+	Candles = MoveTemp(Retained);
+	Head = 0;
+	Count = NumToKeep;
+}
+
+void FPriceCandleRing::AddTrade(float BucketStart, float Price, int32 Quantity)
+{
+	if (Candles.Num() == 0)
+	{
+		SetCapacity(1);
+	}
+
+	// Trades for the current bucket (or a late trade for an older one) update the newest candle
+	if (Count > 0 && BucketStart <= Last().StartTime)
+	{
+		FPriceCandle& Candle = Candles[(Head + Count - 1) % Candles.Num()];
+		Candle.High = FMath::Max(Candle.High, Price);
+		Candle.Low = FMath::Min(Candle.Low, Price);
+		Candle.Close = Price;
+		Candle.Volume += Quantity;
+		Candle.TradeCount += 1;
+		Candle.TradedValue += static_cast<double>(Price) * Quantity;
+		return;
+	}
+
+	// New bucket: overwrite the oldest candle once full
+	int32 Slot;
+	if (Count < Candles.Num())
+	{
+		Slot = (Head + Count) % Candles.Num();
+		++Count;
+	}
+	else
+	{
+		Slot = Head;
+		Head = (Head + 1) % Candles.Num();
+	}
+
+	FPriceCandle& Candle = Candles[Slot];
+	Candle.StartTime = BucketStart;
+	Candle.Open = Price;
+	Candle.High = Price;
+	Candle.Low = Price;
+	Candle.Close = Price;
+	Candle.Volume = Quantity;
+	Candle.TradeCount = 1;
+	Candle.TradedValue = static_cast<double>(Price) * Quantity;
+}
+
+// ====================
+// CANDLE SERIES
+// ====================
+
+float FPriceCandleSeries::GetBucketHours(EPriceCandleResolution Resolution)
+{
+	switch (Resolution)
+	{
+	case EPriceCandleResolution::Day:
+		return 24.0f;
+	case EPriceCandleResolution::Week:
+		return 24.0f * 7.0f;
+	default:
+		return 1.0f;
+	}
+}
+
+void FPriceCandleSeries::SetCapacities(int32 HourCandles, int32 DayCandles, int32 WeekCandles)
+{
+	Rings[static_cast<int32>(EPriceCandleResolution::Hour)].SetCapacity(HourCandles);
+	Rings[static_cast<int32>(EPriceCandleResolution::Day)].SetCapacity(DayCandles);
+	Rings[static_cast<int32>(EPriceCandleResolution::Week)].SetCapacity(WeekCandles);
+}
+
+void FPriceCandleSeries::AddTrade(float GameTimeHours, float Price, int32 Quantity)
+{
+	for (int32 Index = 0; Index < NumResolutions; ++Index)
+	{
+		const float BucketHours = GetBucketHours(static_cast<EPriceCandleResolution>(Index));
+		const float BucketStart = FMath::FloorToFloat(GameTimeHours / BucketHours) * BucketHours;
+		Rings[Index].AddTrade(BucketStart, Price, Quantity);
+	}
+}
+
+void FPriceCandleSeries::GetCandles(EPriceCandleResolution Resolution, int32 MaxCount, TArray<FPriceCandle>& OutCandles) const
+{
+	const FPriceCandleRing& Ring = GetRing(Resolution);
+	const int32 NumToCopy = MaxCount > 0 ? FMath::Min(MaxCount, Ring.Num()) : Ring.Num();
+
+	OutCandles.Reset(NumToCopy);
+	for (int32 Index = Ring.Num() - NumToCopy; Index < Ring.Num(); ++Index)
+	{
+		OutCandles.Add(Ring.Get(Index));
+	}
+}
+
+float FPriceCandleSeries::GetVolumeWeightedPrice(EPriceCandleResolution Resolution, int32 Buckets) const
+{
+	const FPriceCandleRing& Ring = GetRing(Resolution);
+	const int32 First = Buckets > 0 ? FMath::Max(0, Ring.Num() - Buckets) : 0;
+
+	double TotalValue = 0.0;
+	int64 TotalVolume = 0;
+	for (int32 Index = First; Index < Ring.Num(); ++Index)
+	{
+		TotalValue += Ring.Get(Index).TradedValue;
+		TotalVolume += Ring.Get(Index).Volume;
+	}
+
+	return TotalVolume > 0 ? static_cast<float>(TotalValue / TotalVolume) : 0.0f;
+}
+
+float FPriceCandleSeries::GetPriceTrend(EPriceCandleResolution Resolution, int32 Buckets) const
+{
+	const FPriceCandleRing& Ring = GetRing(Resolution);
+	if (Ring.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	const int32 First = Buckets > 0 ? FMath::Max(0, Ring.Num() - Buckets) : 0;
+	const float OpenPrice = Ring.Get(First).Open;
+	const float ClosePrice = Ring.Last().Close;
+
+	return OpenPrice > 0.0f ? (ClosePrice - OpenPrice) / OpenPrice : 0.0f;
+}
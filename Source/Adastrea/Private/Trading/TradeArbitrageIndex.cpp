@@ -0,0 +1,587 @@
+#include "Trading/TradeArbitrageIndex.h"
+#include "Trading/MarketDataAsset.h"
+#include "Trading/MarketStateTable.h"
+#include "Trading/TradeItemDataAsset.h"
+
+// ====================
+// FArbitragePriceHeap
+// ====================
+
+bool FArbitragePriceHeap::Set(int32 Key, float Value)
+{
+	check(Key >= 0);
+
+	if (Key >= KeyPositions.Num())
+	{
+		const int32 OldNum = KeyPositions.Num();
+		KeyPositions.SetNumUninitialized(Key + 1);
+		for (int32 i = OldNum; i <= Key; ++i)
+		{
+			KeyPositions[i] = INDEX_NONE;
+		}
+	}
+
+	int32 Position = KeyPositions[Key];
+	if (Position == INDEX_NONE)
+	{
+		Position = HeapKeys.Add(Key);
+		HeapValues.Add(Value);
+		KeyPositions[Key] = Position;
+		SiftUp(Position);
+		return true;
+	}
+
+	const float OldValue = HeapValues[Position];
+	if (OldValue == Value)
+	{
+		return false;
+	}
+
+	HeapValues[Position] = Value;
+	if (Before(Value, OldValue))
+	{
+		SiftUp(Position);
+	}
+	else
+	{
+		SiftDown(Position);
+	}
+	return true;
+}
+
+bool FArbitragePriceHeap::Remove(int32 Key)
+{
+	if (!Contains(Key))
+	{
+		return false;
+	}
+
+	const int32 Position = KeyPositions[Key];
+	const int32 LastPosition = HeapKeys.Num() - 1;
+	if (Position != LastPosition)
+	{
+		SwapPositions(Position, LastPosition);
+	}
+
+	HeapKeys.Pop(EAllowShrinking::No);
+	HeapValues.Pop(EAllowShrinking::No);
+	KeyPositions[Key] = INDEX_NONE;
+
+	// Restore heap order for the element moved into the vacated slot
+	if (Position < HeapKeys.Num())
+	{
+		const int32 Parent = (Position - 1) / 2;
+		if (Position > 0 && Before(HeapValues[Position], HeapValues[Parent]))
+		{
+			SiftUp(Position);
+		}
+		else
+		{
+			SiftDown(Position);
+		}
+	}
+	return true;
+}
+
+void FArbitragePriceHeap::Reset()
+{
+	HeapKeys.Reset();
+	HeapValues.Reset();
+	KeyPositions.Reset();
+}
+
+void FArbitragePriceHeap::ForEachOrdered(TFunctionRef<bool(int32 Key, float Value)> Visitor) const
+{
+	if (IsEmpty())
+	{
+		return;
+	}
+
+	// Frontier of heap positions whose parents have been visited, ordered like the heap itself
+	const auto FrontierPredicate = [this](int32 A, int32 B) { return Before(HeapValues[A], HeapValues[B]); };
+	TArray<int32, TInlineAllocator<32>> Frontier;
+	Frontier.HeapPush(0, FrontierPredicate);
+
+	while (Frontier.Num() > 0)
+	{
+		int32 Position;
+		Frontier.HeapPop(Position, FrontierPredicate, EAllowShrinking::No);
+
+		if (!Visitor(HeapKeys[Position], HeapValues[Position]))
+		{
+			return;
+		}
+
+		const int32 Left = Position * 2 + 1;
+		if (Left < HeapKeys.Num())
+		{
+			Frontier.HeapPush(Left, FrontierPredicate);
+		}
+		if (Left + 1 < HeapKeys.Num())
+		{
+			Frontier.HeapPush(Left + 1, FrontierPredicate);
+		}
+	}
+}
+
+void FArbitragePriceHeap::SiftUp(int32 Position)
+{
+	while (Position > 0)
+	{
+		const int32 Parent = (Position - 1) / 2;
+		if (!Before(HeapValues[Position], HeapValues[Parent]))
+		{
+			break;
+		}
+		SwapPositions(Position, Parent);
+		Position = Parent;
+	}
+}
+
+void FArbitragePriceHeap::SiftDown(int32 Position)
+{
+	const int32 Count = HeapKeys.Num();
+	for (;;)
+	{
+		const int32 Left = Position * 2 + 1;
+		if (Left >= Count)
+		{
+			break;
+		}
+
+		const int32 Right = Left + 1;
+		const int32 Best = (Right < Count && Before(HeapValues[Right], HeapValues[Left])) ? Right : Left;
+		if (!Before(HeapValues[Best], HeapValues[Position]))
+		{
+			break;
+		}
+		SwapPositions(Position, Best);
+		Position = Best;
+	}
+}
+
+void FArbitragePriceHeap::SwapPositions(int32 A, int32 B)
+{
+	Swap(HeapKeys[A], HeapKeys[B]);
+	Swap(HeapValues[A], HeapValues[B]);
+	KeyPositions[HeapKeys[A]] = A;
+	KeyPositions[HeapKeys[B]] = B;
+}
+
+// ====================
+// FTradeArbitrageIndex
+// ====================
+
+void FTradeArbitrageIndex::Reset()
+{
+	MarketSlots.Reset();
+	FreeMarketSlots.Reset();
+	MarketToSlot.Reset();
+	ItemSlots.Reset();
+	ItemToSlot.Reset();
+	Books.Reset();
+	ItemSpreads.Reset();
+}
+
+void FTradeArbitrageIndex::Rebuild(const TArray<UMarketDataAsset*>& Markets)
+{
+	Reset();
+
+	for (UMarketDataAsset* Market : Markets)
+	{
+		AddMarket(Market);
+	}
+}
+
+void FTradeArbitrageIndex::AddMarket(UMarketDataAsset* Market)
+{
+	if (!Market || MarketToSlot.Contains(Market))
+	{
+		return;
+	}
+
+	const int32 MarketSlot = FreeMarketSlots.Num() > 0 ? FreeMarketSlots.Pop(EAllowShrinking::No) : MarketSlots.Add(nullptr);
+	MarketSlots[MarketSlot] = Market;
+	MarketToSlot.Add(Market, MarketSlot);
+
+	for (const FMarketInventoryEntry& Entry : Market->Inventory)
+	{
+		if (!Entry.TradeItem)
+		{
+			continue;
+		}
+
+		const int32 ItemSlot = FindOrAddItemSlot(Entry.TradeItem);
+		if (UpdatePrices(MarketSlot, ItemSlot))
+		{
+			UpdateItemSpread(ItemSlot);
+		}
+	}
+}
+
+void FTradeArbitrageIndex::RemoveMarket(UMarketDataAsset* Market)
+{
+	int32 MarketSlot;
+	if (!MarketToSlot.RemoveAndCopyValue(Market, MarketSlot))
+	{
+		return;
+	}
+
+	for (int32 ItemSlot = 0; ItemSlot < Books.Num(); ++ItemSlot)
+	{
+		const bool bRemovedBuy = Books[ItemSlot].BuyPrices.Remove(MarketSlot);
+		const bool bRemovedSell = Books[ItemSlot].SellPrices.Remove(MarketSlot);
+		if (bRemovedBuy || bRemovedSell)
+		{
+			UpdateItemSpread(ItemSlot);
+		}
+	}
+
+	MarketSlots[MarketSlot] = nullptr;
+	FreeMarketSlots.Add(MarketSlot);
+}
+
+void FTradeArbitrageIndex::RefreshMarketItem(UMarketDataAsset* Market, UTradeItemDataAsset* Item)
+{
+	const int32* MarketSlot = MarketToSlot.Find(Market);
+	if (!MarketSlot || !Item)
+	{
+		return;
+	}
+
+	const int32 ItemSlot = FindOrAddItemSlot(Item);
+	if (UpdatePrices(*MarketSlot, ItemSlot))
+	{
+		UpdateItemSpread(ItemSlot);
+	}
+}
+
+int32 FTradeArbitrageIndex::RefreshAll()
+{
+	return RefreshMarkets([](const UMarketDataAsset*) { return true; });
+}
+
+int32 FTradeArbitrageIndex::RefreshMarkets(TFunctionRef<bool(const UMarketDataAsset*)> ShouldRefresh)
+{
+	int32 ChangedPrices = 0;
+	TBitArray<> DirtyItems(false, ItemSlots.Num());
+
+	for (int32 MarketSlot = 0; MarketSlot < MarketSlots.Num(); ++MarketSlot)
+	{
+		const UMarketDataAsset* Market = MarketSlots[MarketSlot];
+		if (!Market || !ShouldRefresh(Market))
+		{
+			continue;
+		}
+
+		for (const FMarketInventoryEntry& Entry : Market->Inventory)
+		{
+			if (!Entry.TradeItem)
+			{
+				continue;
+			}
+
+			const int32 ItemSlot = FindOrAddItemSlot(Entry.TradeItem);
+			if (ItemSlot >= DirtyItems.Num())
+			{
+				DirtyItems.Add(false, ItemSlot + 1 - DirtyItems.Num());
+			}
+
+			if (UpdatePrices(MarketSlot, ItemSlot))
+			{
+				++ChangedPrices;
+				DirtyItems[ItemSlot] = true;
+			}
+		}
+	}
+
+	// Re-rank each touched item once, however many of its prices moved
+	for (TConstSetBitIterator<> It(DirtyItems); It; ++It)
+	{
+		UpdateItemSpread(It.GetIndex());
+	}
+
+	return ChangedPrices;
+}
+
+void FTradeArbitrageIndex::FindTopRoutes(int32 MaxRoutes, const FArbitrageRouteFilter& Filter, TArray<FTradeRoute>& OutRoutes) const
+{
+	OutRoutes.Reset();
+	if (MaxRoutes <= 0)
+	{
+		return;
+	}
+
+	TBitArray<> AllowedSlots;
+	const TBitArray<>* AllowedSlotsPtr = nullptr;
+	if (Filter.bRestrictToAllowedMarkets)
+	{
+		// A trader that knows no markets has nowhere to trade
+		if (Filter.AllowedMarkets.Num() == 0)
+		{
+			return;
+		}
+
+		AllowedSlots.Init(false, MarketSlots.Num());
+		for (UMarketDataAsset* Market : Filter.AllowedMarkets)
+		{
+			if (const int32* Slot = MarketToSlot.Find(Market))
+			{
+				AllowedSlots[*Slot] = true;
+			}
+		}
+		AllowedSlotsPtr = &AllowedSlots;
+	}
+
+	struct FScoredRoute
+	{
+		FRouteCandidate Candidate;
+		int32 ItemSlot;
+		float Profit;
+	};
+
+	// Min-heap of the best K routes found so far
+	const auto WorstFirst = [](const FScoredRoute& A, const FScoredRoute& B) { return A.Profit < B.Profit; };
+	TArray<FScoredRoute> Best;
+	Best.Reserve(MaxRoutes + 1);
+
+	// Items arrive in descending order of unconstrained spread, which bounds any filtered route
+	ItemSpreads.ForEachOrdered([&](int32 ItemSlot, float UpperBound)
+	{
+		if (Best.Num() >= MaxRoutes && UpperBound <= Best.HeapTop().Profit)
+		{
+			return false;
+		}
+
+		FScoredRoute Scored;
+		if (!FindBestRouteForItem(ItemSlot, AllowedSlotsPtr, &Filter, Scored.Candidate))
+		{
+			return true;
+		}
+		Scored.ItemSlot = ItemSlot;
+		Scored.Profit = Scored.Candidate.SellPrice - Scored.Candidate.BuyPrice;
+
+		if (Best.Num() < MaxRoutes)
+		{
+			Best.HeapPush(Scored, WorstFirst);
+		}
+		else if (Scored.Profit > Best.HeapTop().Profit)
+		{
+			Best.HeapPopDiscard(WorstFirst, EAllowShrinking::No);
+			Best.HeapPush(Scored, WorstFirst);
+		}
+		return true;
+	});
+
+	Best.Sort([](const FScoredRoute& A, const FScoredRoute& B) { return A.Profit > B.Profit; });
+
+	OutRoutes.Reserve(Best.Num());
+	for (const FScoredRoute& Scored : Best)
+	{
+		FTradeRoute Route;
+		Route.OriginMarket = MarketSlots[Scored.Candidate.OriginSlot];
+		Route.DestinationMarket = MarketSlots[Scored.Candidate.DestinationSlot];
+		Route.TradeItem = ItemSlots[Scored.ItemSlot];
+		Route.ProfitPerUnit = Scored.Profit;
+		Route.ProfitabilityScore = Scored.Profit;
+		OutRoutes.Add(Route);
+	}
+}
+
+void FTradeArbitrageIndex::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(MarketSlots);
+	Collector.AddReferencedObjects(ItemSlots);
+}
+
+int32 FTradeArbitrageIndex::FindOrAddItemSlot(UTradeItemDataAsset* Item)
+{
+	if (const int32* Existing = ItemToSlot.Find(Item))
+	{
+		return *Existing;
+	}
+
+	const int32 ItemSlot = ItemSlots.Add(Item);
+	Books.AddDefaulted();
+	ItemToSlot.Add(Item, ItemSlot);
+	return ItemSlot;
+}
+
+bool FTradeArbitrageIndex::UpdatePrices(int32 MarketSlot, int32 ItemSlot)
+{
+	UMarketDataAsset* Market = MarketSlots[MarketSlot];
+	UTradeItemDataAsset* Item = ItemSlots[ItemSlot];
+	FItemBook& Book = Books[ItemSlot];
+
+	const FMarketInventoryEntry* Entry = Market->FindInventoryEntry(Item);
+	const FMarketItemState* State = MarketStates ? MarketStates->FindItem(Market, Item) : nullptr;
+	if (!Entry)
+	{
+		const bool bRemovedBuy = Book.BuyPrices.Remove(MarketSlot);
+		const bool bRemovedSell = Book.SellPrices.Remove(MarketSlot);
+		return bRemovedBuy || bRemovedSell;
+	}
+
+	// Markets buy anything they list; they only sell what is in stock
+	const bool bInStock = State ? State->bInStock : Entry->CurrentStock > 0;
+	const bool bSellChanged = Book.SellPrices.Set(MarketSlot, State ? Market->CalculateItemPrice(Item, false, *State) : Market->GetItemPrice(Item, false));
+	const bool bBuyChanged = bInStock
+		? Book.BuyPrices.Set(MarketSlot, State ? Market->CalculateItemPrice(Item, true, *State) : Market->GetItemPrice(Item, true))
+		: Book.BuyPrices.Remove(MarketSlot);
+
+	return bSellChanged || bBuyChanged;
+}
+
+void FTradeArbitrageIndex::UpdateItemSpread(int32 ItemSlot)
+{
+	FRouteCandidate Candidate;
+	if (FindBestRouteForItem(ItemSlot, nullptr, nullptr, Candidate))
+	{
+		ItemSpreads.Set(ItemSlot, Candidate.SellPrice - Candidate.BuyPrice);
+	}
+	else
+	{
+		ItemSpreads.Remove(ItemSlot);
+	}
+}
+
+bool FTradeArbitrageIndex::FindBestRouteForItem(int32 ItemSlot, const TBitArray<>* AllowedSlots, const FArbitrageRouteFilter* Filter, FRouteCandidate& OutCandidate) const
+{
+	const FItemBook& Book = Books[ItemSlot];
+	const float MaxBuyPrice = Filter ? Filter->MaxBuyPrice : TNumericLimits<float>::Max();
+	const auto IsAllowed = [AllowedSlots](int32 Slot) { return !AllowedSlots || (*AllowedSlots)[Slot]; };
+
+	if (Filter && Filter->IsRouteReachable)
+	{
+		return FindBestReachableRouteForItem(Book, IsAllowed, MaxBuyPrice, *Filter, OutCandidate);
+	}
+
+	// The two cheapest eligible origins and two best-paying destinations are enough:
+	// if the best of each is the same market, the runner-up on either side wins
+	int32 BuySlots[2];
+	float BuyPrices[2];
+	int32 NumBuy = 0;
+	Book.BuyPrices.ForEachOrdered([&](int32 Slot, float Price)
+	{
+		if (Price > MaxBuyPrice)
+		{
+			return false;
+		}
+		if (!IsAllowed(Slot))
+		{
+			return true;
+		}
+		BuySlots[NumBuy] = Slot;
+		BuyPrices[NumBuy] = Price;
+		return ++NumBuy < 2;
+	});
+
+	if (NumBuy == 0)
+	{
+		return false;
+	}
+
+	int32 SellSlots[2];
+	float SellPrices[2];
+	int32 NumSell = 0;
+	Book.SellPrices.ForEachOrdered([&](int32 Slot, float Price)
+	{
+		if (!IsAllowed(Slot))
+		{
+			return true;
+		}
+		SellSlots[NumSell] = Slot;
+		SellPrices[NumSell] = Price;
+		return ++NumSell < 2;
+	});
+
+	bool bFound = false;
+	float BestProfit = 0.0f;
+	for (int32 b = 0; b < NumBuy; ++b)
+	{
+		for (int32 s = 0; s < NumSell; ++s)
+		{
+			if (BuySlots[b] == SellSlots[s])
+			{
+				continue;
+			}
+
+			const float Profit = SellPrices[s] - BuyPrices[b];
+			if (Profit <= BestProfit)
+			{
+				continue;
+			}
+
+			const float ProfitMargin = BuyPrices[b] > 0.0f ? Profit / BuyPrices[b] : 0.0f;
+			if (Filter && ProfitMargin < Filter->MinProfitMargin)
+			{
+				continue;
+			}
+
+			bFound = true;
+			BestProfit = Profit;
+			OutCandidate.OriginSlot = BuySlots[b];
+			OutCandidate.DestinationSlot = SellSlots[s];
+			OutCandidate.BuyPrice = BuyPrices[b];
+			OutCandidate.SellPrice = SellPrices[s];
+		}
+	}
+
+	return bFound;
+}
+
+bool FTradeArbitrageIndex::FindBestReachableRouteForItem(const FItemBook& Book, TFunctionRef<bool(int32)> IsAllowed, float MaxBuyPrice, const FArbitrageRouteFilter& Filter, FRouteCandidate& OutCandidate) const
+{
+	if (Book.SellPrices.IsEmpty())
+	{
+		return false;
+	}
+
+	const float TopSellPrice = Book.SellPrices.TopValue();
+	bool bFound = false;
+	float BestProfit = 0.0f;
+
+	Book.BuyPrices.ForEachOrdered([&](int32 BuySlot, float BuyPrice)
+	{
+		// Origins only get more expensive from here
+		if (BuyPrice > MaxBuyPrice || TopSellPrice - BuyPrice <= BestProfit)
+		{
+			return false;
+		}
+		if (!IsAllowed(BuySlot))
+		{
+			return true;
+		}
+
+		// First reachable destination is the best one for this origin
+		Book.SellPrices.ForEachOrdered([&](int32 SellSlot, float SellPrice)
+		{
+			const float Profit = SellPrice - BuyPrice;
+			if (Profit <= BestProfit)
+			{
+				return false;
+			}
+			if (SellSlot == BuySlot || !IsAllowed(SellSlot)
+				|| !Filter.IsRouteReachable(MarketSlots[BuySlot], MarketSlots[SellSlot]))
+			{
+				return true;
+			}
+
+			// Margin only shrinks further down the sell heap
+			const float ProfitMargin = BuyPrice > 0.0f ? Profit / BuyPrice : 0.0f;
+			if (ProfitMargin >= Filter.MinProfitMargin)
+			{
+				bFound = true;
+				BestProfit = Profit;
+				OutCandidate.OriginSlot = BuySlot;
+				OutCandidate.DestinationSlot = SellSlot;
+				OutCandidate.BuyPrice = BuyPrice;
+				OutCandidate.SellPrice = SellPrice;
+			}
+			return false;
+		});
+		return true;
+	});
+
+	return bFound;
+}
@@ -0,0 +1,207 @@
+#include "Trading/TradeArbitrageSubsystem.h"
+#include "Trading/EconomyManager.h"
+#include "Trading/MarketDataAsset.h"
+#include "Stations/MarketplaceModule.h"
+#include "Navigation/SectorGraphSubsystem.h"
+#include "SpaceSectorMap.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "AdastreaLog.h"
+
+bool UTradeArbitrageSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTradeArbitrageSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (USectorGraphSubsystem* SectorGraph = InWorld.GetSubsystem<USectorGraphSubsystem>())
+	{
+		TravelMatrix.SetSectorGraph(&SectorGraph->GetGraph());
+	}
+
+	UGameInstance* GameInstance = InWorld.GetGameInstance();
+	EconomyManager = GameInstance ? GameInstance->GetSubsystem<UEconomyManager>() : nullptr;
+	if (!EconomyManager)
+	{
+		UE_LOG(LogAdastreaTrading, Warning, TEXT("TradeArbitrageSubsystem: No EconomyManager available, arbitrage index disabled"));
+		return;
+	}
+
+	EconomyManager->OnMarketRegistered.AddDynamic(this, &UTradeArbitrageSubsystem::HandleMarketRegistered);
+	EconomyManager->OnMarketUnregistered.AddDynamic(this, &UTradeArbitrageSubsystem::HandleMarketUnregistered);
+	EconomyManager->OnMarketItemUpdated.AddDynamic(this, &UTradeArbitrageSubsystem::HandleMarketItemUpdated);
+	EconomyManager->OnEconomyUpdated.AddDynamic(this, &UTradeArbitrageSubsystem::HandleEconomyUpdated);
+
+	Index.SetMarketStates(&EconomyManager->GetMarketStates());
+	RebuildIndex();
+}
+
+void UTradeArbitrageSubsystem::Deinitialize()
+{
+	if (EconomyManager)
+	{
+		EconomyManager->OnMarketRegistered.RemoveAll(this);
+		EconomyManager->OnMarketUnregistered.RemoveAll(this);
+		EconomyManager->OnMarketItemUpdated.RemoveAll(this);
+		EconomyManager->OnEconomyUpdated.RemoveAll(this);
+		EconomyManager = nullptr;
+	}
+
+	Index.Reset();
+	Index.SetMarketStates(nullptr);
+	LastSeenSnapshotVersion = 0;
+	Marketplaces.Reset();
+	TravelMatrix.Reset();
+
+	Super::Deinitialize();
+}
+
+void UTradeArbitrageSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UTradeArbitrageSubsystem* This = CastChecked<UTradeArbitrageSubsystem>(InThis);
+	This->Index.AddReferencedObjects(Collector);
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+TArray<FTradeRoute> UTradeArbitrageSubsystem::GetTopTradeRoutes(int32 MaxRoutes) const
+{
+	TArray<FTradeRoute> Routes;
+	FindTopRoutes(MaxRoutes, FArbitrageRouteFilter(), Routes);
+	return Routes;
+}
+
+void UTradeArbitrageSubsystem::FindTopRoutes(int32 MaxRoutes, const FArbitrageRouteFilter& Filter, TArray<FTradeRoute>& OutRoutes) const
+{
+	Index.FindTopRoutes(MaxRoutes, Filter, OutRoutes);
+}
+
+void UTradeArbitrageSubsystem::RebuildIndex()
+{
+	if (!EconomyManager)
+	{
+		Index.Reset();
+		return;
+	}
+
+	Index.Rebuild(EconomyManager->GetActiveMarkets());
+	LastSeenSnapshotVersion = static_cast<uint64>(EconomyManager->GetSnapshotVersion());
+
+	UE_LOG(LogAdastreaTrading, Log, TEXT("TradeArbitrageSubsystem: Indexed %d markets, %d items"),
+		Index.GetMarketCount(), Index.GetItemCount());
+}
+
+void UTradeArbitrageSubsystem::RegisterMarketplace(AMarketplaceModule* Marketplace)
+{
+	if (!Marketplace || Marketplaces.Contains(Marketplace))
+	{
+		return;
+	}
+
+	Marketplaces.Add(Marketplace);
+
+	UMarketDataAsset* Market = Marketplace->GetMarketData();
+	if (!Market)
+	{
+		return;
+	}
+
+	if (TravelMatrix.HasMarket(Market))
+	{
+		UE_LOG(LogAdastreaTrading, Verbose, TEXT("TradeArbitrageSubsystem: Market %s is shared by several marketplaces, keeping first position"),
+			*Market->GetName());
+		return;
+	}
+
+	TravelMatrix.SetMarketLocation(Market, Marketplace->GetActorLocation());
+}
+
+void UTradeArbitrageSubsystem::UnregisterMarketplace(AMarketplaceModule* Marketplace)
+{
+	if (!Marketplace || Marketplaces.Remove(Marketplace) == 0)
+	{
+		return;
+	}
+
+	UMarketDataAsset* Market = Marketplace->GetMarketData();
+	if (!Market)
+	{
+		return;
+	}
+
+	// Hand the market over to another marketplace that still hosts it
+	for (AMarketplaceModule* Other : Marketplaces)
+	{
+		if (Other && Other->GetMarketData() == Market)
+		{
+			TravelMatrix.SetMarketLocation(Market, Other->GetActorLocation());
+			return;
+		}
+	}
+
+	TravelMatrix.RemoveMarket(Market);
+}
+
+void UTradeArbitrageSubsystem::RegisterSector(ASpaceSectorMap* Sector)
+{
+	if (Sector)
+	{
+		TravelMatrix.MarkSectorsDirty();
+	}
+}
+
+void UTradeArbitrageSubsystem::UnregisterSector(ASpaceSectorMap* Sector)
+{
+	if (Sector)
+	{
+		TravelMatrix.MarkSectorsDirty();
+	}
+}
+
+float UTradeArbitrageSubsystem::GetMarketDistance(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination) const
+{
+	return TravelMatrix.GetDistance(Origin, Destination);
+}
+
+bool UTradeArbitrageSubsystem::IsMarketInRange(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination, float MaxDistance) const
+{
+	return TravelMatrix.IsWithinRange(Origin, Destination, MaxDistance);
+}
+
+void UTradeArbitrageSubsystem::HandleMarketRegistered(UMarketDataAsset* Market)
+{
+	Index.AddMarket(Market);
+}
+
+void UTradeArbitrageSubsystem::HandleMarketUnregistered(UMarketDataAsset* Market)
+{
+	Index.RemoveMarket(Market);
+}
+
+void UTradeArbitrageSubsystem::HandleMarketItemUpdated(UMarketDataAsset* Market, UTradeItemDataAsset* Item)
+{
+	Index.RefreshMarketItem(Market, Item);
+}
+
+void UTradeArbitrageSubsystem::HandleEconomyUpdated(float GameTime)
+{
+	// Ticks that published nothing new leave every row as it was
+	const FEconomySnapshotHandle Snapshot = EconomyManager ? EconomyManager->AcquireSnapshot() : FEconomySnapshotHandle();
+	if (!Snapshot.IsValid() || !Snapshot->HasChangedSince(LastSeenSnapshotVersion))
+	{
+		return;
+	}
+
+	// Transactions between ticks already arrived through HandleMarketItemUpdated, so only re-read rows the tick changed
+	const uint64 SinceVersion = LastSeenSnapshotVersion;
+	const int32 ChangedPrices = Index.RefreshMarkets([&Snapshot, SinceVersion](const UMarketDataAsset* Market)
+	{
+		return Snapshot->HasMarketChangedSince(FMarketStateTable::GetMarketKey(Market), SinceVersion);
+	});
+	LastSeenSnapshotVersion = Snapshot->Version;
+
+	UE_LOG(LogAdastreaTrading, Verbose, TEXT("TradeArbitrageSubsystem: %d prices changed at game time %.2f"), ChangedPrices, GameTime);
+}
@@ -22,9 +22,51 @@ UTradeItemDataAsset::UTradeItemDataAsset()
 	, AITradePriority(5)
 	, bAIHoardable(false)
 	, bAIArbitrageEnabled(true)
+	, bHasCustomPriceOverride(true)
 {
 }
 
+bool TradePricing::IsPriceEventOverridden(const UClass* Class, const UClass* NativeBase, FName EventName)
+{
+    if (!Class)
+    {
+        return false;
+    }
+
+    if (Class->IsFunctionImplementedInScript(EventName))
+    {
+        return true;
+    }
+
+    // A native subclass can override the _Implementation without any script; keep calling the event for it
+    const UClass* NativeClass = Class;
+    while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+    {
+        NativeClass = NativeClass->GetSuperClass();
+    }
+    return NativeClass != NativeBase;
+}
+
+void UTradeItemDataAsset::PostInitProperties()
+{
+    Super::PostInitProperties();
+    DetectPriceOverride();
+}
+
+void UTradeItemDataAsset::PostLoad()
+{
+    Super::PostLoad();
+
+    // Blueprint classes are fully linked by now
+    DetectPriceOverride();
+}
+
+void UTradeItemDataAsset::DetectPriceOverride()
+{
+    bHasCustomPriceOverride = TradePricing::IsPriceEventOverridden(
+        GetClass(), UTradeItemDataAsset::StaticClass(), GET_FUNCTION_NAME_CHECKED(UTradeItemDataAsset, OnCalculateCustomPrice));
+}
+
 bool UTradeItemDataAsset::HasBehaviorTag(FName Tag) const
 {
     return BehaviorTags.Contains(Tag);
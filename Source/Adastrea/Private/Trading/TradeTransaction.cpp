@@ -1,18 +1,141 @@
 #include "Trading/TradeTransaction.h"
+#include "Trading/TradeTransactionArchive.h"
 #include "Trading/TradeItemDataAsset.h"
 #include "Trading/MarketDataAsset.h"
 #include "Misc/DateTime.h"
+#include "AdastreaLog.h"
+
+namespace TradeTransactionIndex
+{
+	/** Prefix sum of everything before entry Index */
+	double SumBefore(const TArray<double>& Cumulative, int32 Index)
+	{
+		return Index > 0 ? Cumulative[Index - 1] : 0.0;
+	}
+
+	/** First entry in [Begin, End) whose timestamp satisfies !Pred (timestamps ascending) */
+	template<typename PredicateType>
+	int32 PartitionPoint(const TArray<float>& Timestamps, int32 Begin, int32 End, PredicateType Pred)
+	{
+		while (Begin < End)
+		{
+			const int32 Mid = Begin + (End - Begin) / 2;
+			if (Pred(Timestamps[Mid]))
+			{
+				Begin = Mid + 1;
+			}
+			else
+			{
+				End = Mid;
+			}
+		}
+		return Begin;
+	}
+
+	void Append(FTradeTransactionIndexList& List, const FTradeTransaction& Transaction, int64 Sequence)
+	{
+		const int32 Last = List.Sequences.Num() - 1;
+		List.Sequences.Add(Sequence);
+		List.Timestamps.Add(Transaction.Timestamp);
+		List.CumQuantity.Add((Last >= 0 ? List.CumQuantity[Last] : 0.0) + Transaction.Quantity);
+		List.CumValue.Add((Last >= 0 ? List.CumValue[Last] : 0.0) + static_cast<double>(Transaction.PricePerUnit) * Transaction.Quantity);
+		List.CumPrice.Add((Last >= 0 ? List.CumPrice[Last] : 0.0) + Transaction.PricePerUnit);
+	}
+
+	/** Drop evicted entries once they make up half the list, rebasing prefix sums */
+	void Compact(FTradeTransactionIndexList& List)
+	{
+		const int32 Removed = List.First;
+		const double BaseQuantity = SumBefore(List.CumQuantity, Removed);
+		const double BaseValue = SumBefore(List.CumValue, Removed);
+		const double BasePrice = SumBefore(List.CumPrice, Removed);
+
+		List.Sequences.RemoveAt(0, Removed, EAllowShrinking::No);
+		List.Timestamps.RemoveAt(0, Removed, EAllowShrinking::No);
+		List.CumQuantity.RemoveAt(0, Removed, EAllowShrinking::No);
+		List.CumValue.RemoveAt(0, Removed, EAllowShrinking::No);
+		List.CumPrice.RemoveAt(0, Removed, EAllowShrinking::No);
+
+		for (int32 i = 0; i < List.Sequences.Num(); ++i)
+		{
+			List.CumQuantity[i] -= BaseQuantity;
+			List.CumValue[i] -= BaseValue;
+			List.CumPrice[i] -= BasePrice;
+		}
+		List.First = 0;
+	}
+
+	/** Evict the front entry of a key's list; the evicted transaction is always the oldest */
+	template<typename KeyType>
+	void PopFront(TMap<KeyType, FTradeTransactionIndexList>& Index, const KeyType& Key)
+	{
+		FTradeTransactionIndexList* List = Index.Find(Key);
+		if (!List)
+		{
+			return;
+		}
+
+		++List->First;
+		if (List->Num() == 0)
+		{
+			Index.Remove(Key);
+		}
+		else if (List->First >= 64 && List->First * 2 >= List->Sequences.Num())
+		{
+			Compact(*List);
+		}
+	}
+}
 
 UTradeTransactionManager::UTradeTransactionManager()
 	: MaxHistorySize(10000)
+	, HistoryCapacity(0)
+	, NextSequence(0)
+	, NumTransactions(0)
 	, CachedLatestTimestamp(0.0f)
 	, bCacheValid(false)
+	, bTimestampsOrdered(true)
+{
+}
+
+void UTradeTransactionManager::PostLoad()
 {
+	Super::PostLoad();
+
+	RebuildIndexes();
 }
 
 void UTradeTransactionManager::RecordTransaction(const FTradeTransaction& Transaction)
 {
-	TransactionHistory.Add(Transaction);
+	if (HistoryCapacity != FMath::Max(1, MaxHistorySize))
+	{
+		ResizeHistory();
+	}
+
+	// Full ring: overwrite the oldest entry instead of sorting and shifting
+	if (NumTransactions == HistoryCapacity)
+	{
+		EvictOldest();
+	}
+
+	if (NumTransactions > 0 && Transaction.Timestamp < GetBySequence(NextSequence - 1).Timestamp)
+	{
+		bTimestampsOrdered = false;
+	}
+
+	const int64 Sequence = NextSequence++;
+	const int32 Slot = static_cast<int32>(Sequence % HistoryCapacity);
+	if (Slot == TransactionHistory.Num())
+	{
+		TransactionHistory.Add(Transaction);
+	}
+	else
+	{
+		TransactionHistory[Slot] = Transaction;
+	}
+	++NumTransactions;
+
+	IndexTransaction(TransactionHistory[Slot], Sequence);
 	
 	// Update cached latest timestamp for performance optimization
 	if (Transaction.Timestamp > CachedLatestTimestamp)
@@ -20,117 +143,151 @@ void UTradeTransactionManager::RecordTransaction(const FTradeTransaction& Transa
 		CachedLatestTimestamp = Transaction.Timestamp;
 		bCacheValid = true;
 	}
-	
-	// Prune if necessary
-	PruneOldTransactions();
 }
 
-TArray<FTradeTransaction> UTradeTransactionManager::GetTransactionsByItem(FName ItemID) const
+TArray<FTradeTransaction> UTradeTransactionManager::GetTransactionHistory() const
 {
 	TArray<FTradeTransaction> Result;
-	
-	// Reserve space based on estimate (assume 10% might match)
-	Result.Reserve(TransactionHistory.Num() / 10);
-	
-	for (const FTradeTransaction& Transaction : TransactionHistory)
+	Result.Reserve(NumTransactions);
+
+	for (int64 Sequence = GetOldestSequence(); Sequence < NextSequence; ++Sequence)
 	{
-		if (Transaction.TradeItem && Transaction.TradeItem->ItemID == ItemID)
-		{
-			Result.Add(Transaction);
-		}
+		Result.Add(GetBySequence(Sequence));
 	}
-	
+
 	return Result;
 }
 
+TArray<FTradeTransaction> UTradeTransactionManager::GetTransactionsByItem(FName ItemID) const
+{
+	return CollectTransactions(ItemIndex.Find(ItemID));
+}
+
 TArray<FTradeTransaction> UTradeTransactionManager::GetTransactionsByMarket(UMarketDataAsset* Market) const
+{
+	return CollectTransactions(MarketIndex.Find(Market));
+}
+
+TArray<FTradeTransaction> UTradeTransactionManager::GetTransactionsByTrader(FName TraderID) const
+{
+	return CollectTransactions(TraderIndex.Find(TraderID));
+}
+
+TArray<FTradeTransaction> UTradeTransactionManager::GetTransactionsByTimeRange(float StartTime, float EndTime) const
 {
 	TArray<FTradeTransaction> Result;
-	
-	// Reserve space to avoid reallocation
-	Result.Reserve(TransactionHistory.Num() / 10);
-	
-	for (const FTradeTransaction& Transaction : TransactionHistory)
+
+	if (!bTimestampsOrdered)
 	{
-		if (Transaction.Market == Market)
+		for (int64 Sequence = GetOldestSequence(); Sequence < NextSequence; ++Sequence)
 		{
-			Result.Add(Transaction);
+			const FTradeTransaction& Transaction = GetBySequence(Sequence);
+			if (Transaction.Timestamp >= StartTime && Transaction.Timestamp <= EndTime)
+			{
+				Result.Add(Transaction);
+			}
 		}
+		return Result;
 	}
-	
-	return Result;
-}
 
-TArray<FTradeTransaction> UTradeTransactionManager::GetTransactionsByTrader(FName TraderID) const
-{
-	TArray<FTradeTransaction> Result;
-	
-	// Reserve space to avoid reallocation
-	Result.Reserve(TransactionHistory.Num() / 10);
-	
-	for (const FTradeTransaction& Transaction : TransactionHistory)
+	// Ring is in timestamp order: binary search for the first match, then copy until past EndTime
+	int64 Begin = GetOldestSequence();
+	int64 End = NextSequence;
+	while (Begin < End)
 	{
-		if (Transaction.BuyerID == TraderID || Transaction.SellerID == TraderID)
+		const int64 Mid = Begin + (End - Begin) / 2;
+		if (GetBySequence(Mid).Timestamp < StartTime)
 		{
-			Result.Add(Transaction);
+			Begin = Mid + 1;
+		}
+		else
+		{
+			End = Mid;
 		}
 	}
-	
-	return Result;
-}
 
-TArray<FTradeTransaction> UTradeTransactionManager::GetTransactionsByTimeRange(float StartTime, float EndTime) const
-{
-	TArray<FTradeTransaction> Result;
-	
-	for (const FTradeTransaction& Transaction : TransactionHistory)
+	for (int64 Sequence = Begin; Sequence < NextSequence; ++Sequence)
 	{
-		if (Transaction.Timestamp >= StartTime && Transaction.Timestamp <= EndTime)
+		const FTradeTransaction& Transaction = GetBySequence(Sequence);
+		if (Transaction.Timestamp > EndTime)
 		{
-			Result.Add(Transaction);
+			break;
 		}
+		Result.Add(Transaction);
 	}
-	
+
 	return Result;
 }
 
 int32 UTradeTransactionManager::GetTotalTradeVolume(FName ItemID, float StartTime, float EndTime) const
 {
-	int32 TotalVolume = 0;
-	
-	for (const FTradeTransaction& Transaction : TransactionHistory)
+	const FTradeTransactionIndexList* List = ItemIndex.Find(ItemID);
+	if (!List)
 	{
-		if (Transaction.TradeItem && Transaction.TradeItem->ItemID == ItemID &&
-			Transaction.Timestamp >= StartTime && Transaction.Timestamp <= EndTime)
-		{
-			TotalVolume += Transaction.Quantity;
-		}
+		return 0;
 	}
-	
-	return TotalVolume;
+
+	double Quantity, Value, Price;
+	int32 Count;
+	SumTimeRange(*List, StartTime, EndTime, Quantity, Value, Price, Count);
+	return static_cast<int32>(Quantity);
 }
 
 float UTradeTransactionManager::GetAveragePrice(FName ItemID, float StartTime, float EndTime) const
 {
-	float TotalPrice = 0.0f;
-	int32 Count = 0;
-	
-	for (const FTradeTransaction& Transaction : TransactionHistory)
+	const FTradeTransactionIndexList* List = ItemIndex.Find(ItemID);
+	if (!List)
 	{
-		if (Transaction.TradeItem && Transaction.TradeItem->ItemID == ItemID &&
-			Transaction.Timestamp >= StartTime && Transaction.Timestamp <= EndTime)
-		{
-			TotalPrice += Transaction.PricePerUnit;
-			Count++;
-		}
+		return 0.0f;
 	}
-	
-	return Count > 0 ? TotalPrice / Count : 0.0f;
+
+	double Quantity, Value, Price;
+	int32 Count;
+	SumTimeRange(*List, StartTime, EndTime, Quantity, Value, Price, Count);
+	return Count > 0 ? static_cast<float>(Price / Count) : 0.0f;
+}
+
+float UTradeTransactionManager::GetVolumeWeightedAveragePrice(FName ItemID, float StartTime, float EndTime) const
+{
+	const FTradeTransactionIndexList* List = ItemIndex.Find(ItemID);
+	if (!List)
+	{
+		return 0.0f;
+	}
+
+	double Quantity, Value, Price;
+	int32 Count;
+	SumTimeRange(*List, StartTime, EndTime, Quantity, Value, Price, Count);
+	return Quantity > 0.0 ? static_cast<float>(Value / Quantity) : 0.0f;
+}
+
+int32 UTradeTransactionManager::GetItemTradeVolume(FName ItemID) const
+{
+	const FTradeTransactionIndexList* List = ItemIndex.Find(ItemID);
+	if (!List)
+	{
+		return 0;
+	}
+
+	return static_cast<int32>(List->CumQuantity.Last() - TradeTransactionIndex::SumBefore(List->CumQuantity, List->First));
+}
+
+float UTradeTransactionManager::GetItemVolumeWeightedPrice(FName ItemID) const
+{
+	const FTradeTransactionIndexList* List = ItemIndex.Find(ItemID);
+	if (!List)
+	{
+		return 0.0f;
+	}
+
+	const double Quantity = List->CumQuantity.Last() - TradeTransactionIndex::SumBefore(List->CumQuantity, List->First);
+	const double Value = List->CumValue.Last() - TradeTransactionIndex::SumBefore(List->CumValue, List->First);
+	return Quantity > 0.0 ? static_cast<float>(Value / Quantity) : 0.0f;
 }
 
 float UTradeTransactionManager::GetPriceTrend(FName ItemID, float TimeWindow) const
 {
-	if (TransactionHistory.Num() == 0)
+	if (NumTransactions == 0)
 	{
 		return 0.0f;
 	}
@@ -139,11 +296,15 @@ float UTradeTransactionManager::GetPriceTrend(FName ItemID, float TimeWindow) co
 	float LatestTime = bCacheValid ? CachedLatestTimestamp : 0.0f;
 	if (!bCacheValid)
 	{
-		for (const FTradeTransaction& Transaction : TransactionHistory)
+		if (bTimestampsOrdered)
+		{
+			LatestTime = GetBySequence(NextSequence - 1).Timestamp;
+		}
+		else
 		{
-			if (Transaction.Timestamp > LatestTime)
+			for (int64 Sequence = GetOldestSequence(); Sequence < NextSequence; ++Sequence)
 			{
-				LatestTime = Transaction.Timestamp;
+				LatestTime = FMath::Max(LatestTime, GetBySequence(Sequence).Timestamp);
 			}
 		}
 	}
@@ -167,31 +328,29 @@ float UTradeTransactionManager::GetPriceTrend(FName ItemID, float TimeWindow) co
 
 TArray<FName> UTradeTransactionManager::GetMostTradedItems(int32 Count, float StartTime, float EndTime) const
 {
-	// Map item IDs to trade volumes
-	TMap<FName, int32> ItemVolumes;
-	
-	for (const FTradeTransaction& Transaction : TransactionHistory)
+	// Per-item volume over the range from each item's prefix sums
+	TArray<TPair<FName, double>> ItemVolumes;
+	ItemVolumes.Reserve(ItemIndex.Num());
+
+	for (const TPair<FName, FTradeTransactionIndexList>& Pair : ItemIndex)
 	{
-		if (Transaction.TradeItem &&
-			Transaction.Timestamp >= StartTime && Transaction.Timestamp <= EndTime)
+		double Quantity, Value, Price;
+		int32 TransactionCount;
+		SumTimeRange(Pair.Value, StartTime, EndTime, Quantity, Value, Price, TransactionCount);
+		if (TransactionCount > 0)
 		{
-			FName ItemID = Transaction.TradeItem->ItemID;
-			if (!ItemVolumes.Contains(ItemID))
-			{
-				ItemVolumes.Add(ItemID, 0);
-			}
-			ItemVolumes[ItemID] += Transaction.Quantity;
+			ItemVolumes.Emplace(Pair.Key, Quantity);
 		}
 	}
 	
 	// Sort by volume
-	ItemVolumes.ValueSort([](int32 A, int32 B) {
-		return A > B;
+	ItemVolumes.Sort([](const TPair<FName, double>& A, const TPair<FName, double>& B) {
+		return A.Value > B.Value;
 	});
 	
 	// Get top items
 	TArray<FName> Result;
-	for (const auto& Pair : ItemVolumes)
+	for (const TPair<FName, double>& Pair : ItemVolumes)
 	{
 		Result.Add(Pair.Key);
 		if (Result.Num() >= Count)
@@ -205,113 +364,273 @@ TArray<FName> UTradeTransactionManager::GetMostTradedItems(int32 Count, float St
 
 int32 UTradeTransactionManager::GetPlayerProfitLoss(FName PlayerID) const
 {
-	int32 TotalProfit = 0;
-	
-	for (const FTradeTransaction& Transaction : TransactionHistory)
-	{
-		if (Transaction.BuyerID == PlayerID)
-		{
-			// Player bought - negative to profit
-			TotalProfit -= Transaction.TotalValue;
-		}
-		else if (Transaction.SellerID == PlayerID)
-		{
-			// Player sold - positive to profit
-			TotalProfit += Transaction.TotalValue;
-		}
-	}
-	
-	return TotalProfit;
+	const FTradeTraderAggregate* Aggregate = TraderAggregates.Find(PlayerID);
+	return Aggregate ? static_cast<int32>(Aggregate->NetValue) : 0;
 }
 
 void UTradeTransactionManager::ClearHistory()
 {
 	TransactionHistory.Empty();
+	HistoryCapacity = 0;
+	NextSequence = 0;
+	NumTransactions = 0;
+	ItemIndex.Empty();
+	MarketIndex.Empty();
+	TraderIndex.Empty();
+	TraderAggregates.Empty();
 	CachedLatestTimestamp = 0.0f;
 	bCacheValid = false;
+	bTimestampsOrdered = true;
 }
 
-FString UTradeTransactionManager::ExportToString() const
+bool UTradeTransactionManager::ExportToFile(const FString& FilePath) const
 {
-	// Performance optimization: Pre-allocate string capacity
-	// Estimate ~200 characters per transaction line
-	const int32 EstimatedSize = TransactionHistory.Num() * 200 + 100;
-	
-	TArray<FString> Lines;
-	Lines.Reserve(TransactionHistory.Num() + 1);
-	
-	// Add header
-	Lines.Add(TEXT("TransactionID,Type,ItemID,Quantity,PricePerUnit,TotalValue,BuyerID,SellerID,Timestamp"));
-	
-	// Build lines array first (more efficient than repeated string concatenation)
-	for (const FTradeTransaction& Transaction : TransactionHistory)
-	{
-		FString ItemID = Transaction.TradeItem ? Transaction.TradeItem->ItemID.ToString() : TEXT("None");
-		Lines.Add(FString::Printf(TEXT("%s,%d,%s,%d,%.2f,%d,%s,%s,%.2f"),
-			*Transaction.TransactionID.ToString(),
-			(int32)Transaction.TransactionType,
-			*ItemID,
-			Transaction.Quantity,
-			Transaction.PricePerUnit,
-			Transaction.TotalValue,
-			*Transaction.BuyerID.ToString(),
-			*Transaction.SellerID.ToString(),
-			Transaction.Timestamp
-		));
+	FTradeTransactionArchiveWriter Writer;
+	if (!Writer.Open(FilePath))
+	{
+		return false;
 	}
-	
-	// Join all lines efficiently with newline delimiter
-	return FString::Join(Lines, TEXT("\n"));
+
+	for (int64 Sequence = GetOldestSequence(); Sequence < NextSequence; ++Sequence)
+	{
+		Writer.Write(GetBySequence(Sequence));
+	}
+
+	return Writer.Close();
 }
 
-bool UTradeTransactionManager::ImportFromString(const FString& Data)
+bool UTradeTransactionManager::ImportFromFile(const FString& FilePath)
 {
-	// Simple CSV import
-	// This is a basic implementation - production code would need more robust parsing
-	TArray<FString> Lines;
-	Data.ParseIntoArrayLines(Lines);
-	
-	if (Lines.Num() < 2)
+	FTradeTransactionArchiveReader Reader;
+	if (!Reader.Open(FilePath))
 	{
 		return false;
 	}
-	
-	// Skip header line
-	for (int32 i = 1; i < Lines.Num(); i++)
+
+	// Rows older than the retained window would be evicted immediately, so skip recording them
+	int64 RowsToSkip = FMath::Max<int64>(0, Reader.GetNumRows() - FMath::Max(1, MaxHistorySize));
+
+	TArray<FTradeTransaction> Rows;
+	while (Reader.ReadNextBlock(Rows))
 	{
-		TArray<FString> Fields;
-		Lines[i].ParseIntoArray(Fields, TEXT(","));
-		
-		if (Fields.Num() < 9)
+		const int32 FirstRow = static_cast<int32>(FMath::Min<int64>(RowsToSkip, Rows.Num()));
+		RowsToSkip -= FirstRow;
+
+		for (int32 RowIndex = FirstRow; RowIndex < Rows.Num(); ++RowIndex)
 		{
-			continue;
+			RecordTransaction(Rows[RowIndex]);
 		}
-		
-		// Parse fields and create transaction
-		// This would need proper implementation with asset lookup
 	}
-	
-	return true;
+
+	UE_LOG(LogAdastreaTrading, Log, TEXT("TradeTransactionManager: Imported %lld transactions from %s"), Reader.GetNumRows(), *FilePath);
+	return !Reader.HasError();
 }
 
-void UTradeTransactionManager::PruneOldTransactions()
+// ====================
+// RING BUFFER
+// ====================
+
+void UTradeTransactionManager::ResizeHistory()
 {
-	if (TransactionHistory.Num() <= MaxHistorySize)
+	const int32 NewCapacity = FMath::Max(1, MaxHistorySize);
+	const int32 NumToKeep = FMath::Min(NumTransactions, NewCapacity);
+
+	// Lay the newest transactions out linearly from slot 0
+	TArray<FTradeTransaction> Retained;
+	Retained.Reserve(NewCapacity);
+	for (int64 Sequence = NextSequence - NumToKeep; Sequence < NextSequence; ++Sequence)
 	{
-		return;
+		Retained.Add(GetBySequence(Sequence));
 	}
-	
-	// Remove oldest transactions
-	int32 NumToRemove = TransactionHistory.Num() - MaxHistorySize;
-	
-	// Sort by timestamp
-	TransactionHistory.Sort([](const FTradeTransaction& A, const FTradeTransaction& B) {
-		return A.Timestamp < B.Timestamp;
-	});
-	
-	// Remove oldest
-	TransactionHistory.RemoveAt(0, NumToRemove);
-	
-	// Invalidate cache after pruning since we might have removed the latest timestamp
+
+	TransactionHistory = MoveTemp(Retained);
+	HistoryCapacity = NewCapacity;
+	NumTransactions = NumToKeep;
+	NextSequence = NumToKeep;
+
+	RebuildIndexes();
+}
+
+void UTradeTransactionManager::EvictOldest()
+{
+	const FTradeTransaction& Oldest = GetBySequence(GetOldestSequence());
+	UnindexTransaction(Oldest);
+
+	// Might have removed the latest timestamp if history was recorded out of order
+	if (!bTimestampsOrdered && Oldest.Timestamp >= CachedLatestTimestamp)
+	{
+		bCacheValid = false;
+	}
+
+	--NumTransactions;
+}
+
+void UTradeTransactionManager::IndexTransaction(const FTradeTransaction& Transaction, int64 Sequence)
+{
+	const FName ItemKey = GetItemKey(Transaction);
+	if (!ItemKey.IsNone())
+	{
+		TradeTransactionIndex::Append(ItemIndex.FindOrAdd(ItemKey), Transaction, Sequence);
+	}
+
+	if (Transaction.Market)
+	{
+		TradeTransactionIndex::Append(MarketIndex.FindOrAdd(Transaction.Market), Transaction, Sequence);
+	}
+
+	// Buyer pays, seller receives (a self-trade counts as a buy, as before)
+	if (!Transaction.BuyerID.IsNone())
+	{
+		TradeTransactionIndex::Append(TraderIndex.FindOrAdd(Transaction.BuyerID), Transaction, Sequence);
+		FTradeTraderAggregate& Aggregate = TraderAggregates.FindOrAdd(Transaction.BuyerID);
+		Aggregate.NetValue -= Transaction.TotalValue;
+		++Aggregate.TransactionCount;
+	}
+
+	if (!Transaction.SellerID.IsNone() && Transaction.SellerID != Transaction.BuyerID)
+	{
+		TradeTransactionIndex::Append(TraderIndex.FindOrAdd(Transaction.SellerID), Transaction, Sequence);
+		FTradeTraderAggregate& Aggregate = TraderAggregates.FindOrAdd(Transaction.SellerID);
+		Aggregate.NetValue += Transaction.TotalValue;
+		++Aggregate.TransactionCount;
+	}
+}
+
+void UTradeTransactionManager::UnindexTransaction(const FTradeTransaction& Transaction)
+{
+	const FName ItemKey = GetItemKey(Transaction);
+	if (!ItemKey.IsNone())
+	{
+		TradeTransactionIndex::PopFront(ItemIndex, ItemKey);
+	}
+
+	if (Transaction.Market)
+	{
+		TradeTransactionIndex::PopFront(MarketIndex, Transaction.Market);
+	}
+
+	const auto RemoveFromTrader = [this](FName TraderID, int64 ValueChange)
+	{
+		TradeTransactionIndex::PopFront(TraderIndex, TraderID);
+		if (FTradeTraderAggregate* Aggregate = TraderAggregates.Find(TraderID))
+		{
+			Aggregate->NetValue -= ValueChange;
+			if (--Aggregate->TransactionCount <= 0)
+			{
+				TraderAggregates.Remove(TraderID);
+			}
+		}
+	};
+
+	if (!Transaction.BuyerID.IsNone())
+	{
+		RemoveFromTrader(Transaction.BuyerID, -static_cast<int64>(Transaction.TotalValue));
+	}
+
+	if (!Transaction.SellerID.IsNone() && Transaction.SellerID != Transaction.BuyerID)
+	{
+		RemoveFromTrader(Transaction.SellerID, Transaction.TotalValue);
+	}
+}
+
+void UTradeTransactionManager::RebuildIndexes()
+{
+	ItemIndex.Reset();
+	MarketIndex.Reset();
+	TraderIndex.Reset();
+	TraderAggregates.Reset();
+	CachedLatestTimestamp = 0.0f;
 	bCacheValid = false;
+	bTimestampsOrdered = true;
+
+	// Serialized state from before the ring buffer: treat the array as linear history
+	if (HistoryCapacity <= 0 || NumTransactions > TransactionHistory.Num())
+	{
+		HistoryCapacity = FMath::Max(1, TransactionHistory.Num());
+		NumTransactions = TransactionHistory.Num();
+		NextSequence = NumTransactions;
+	}
+
+	for (int64 Sequence = GetOldestSequence(); Sequence < NextSequence; ++Sequence)
+	{
+		const FTradeTransaction& Transaction = GetBySequence(Sequence);
+		if (Sequence > GetOldestSequence() && Transaction.Timestamp < GetBySequence(Sequence - 1).Timestamp)
+		{
+			bTimestampsOrdered = false;
+		}
+
+		IndexTransaction(Transaction, Sequence);
+
+		if (Transaction.Timestamp > CachedLatestTimestamp)
+		{
+			CachedLatestTimestamp = Transaction.Timestamp;
+			bCacheValid = true;
+		}
+	}
+}
+
+TArray<FTradeTransaction> UTradeTransactionManager::CollectTransactions(const FTradeTransactionIndexList* List) const
+{
+	TArray<FTradeTransaction> Result;
+	if (!List)
+	{
+		return Result;
+	}
+
+	Result.Reserve(List->Num());
+	for (int32 i = List->First; i < List->Sequences.Num(); ++i)
+	{
+		Result.Add(GetBySequence(List->Sequences[i]));
+	}
+
+	return Result;
+}
+
+void UTradeTransactionManager::FindTimeRange(const FTradeTransactionIndexList& List, float StartTime, float EndTime, int32& OutBegin, int32& OutEnd) const
+{
+	const int32 Num = List.Sequences.Num();
+	OutBegin = TradeTransactionIndex::PartitionPoint(List.Timestamps, List.First, Num, [StartTime](float Timestamp) { return Timestamp < StartTime; });
+	OutEnd = TradeTransactionIndex::PartitionPoint(List.Timestamps, OutBegin, Num, [EndTime](float Timestamp) { return Timestamp <= EndTime; });
+}
+
+void UTradeTransactionManager::SumTimeRange(const FTradeTransactionIndexList& List, float StartTime, float EndTime, double& OutQuantity, double& OutValue, double& OutPrice, int32& OutCount) const
+{
+	using TradeTransactionIndex::SumBefore;
+
+	if (bTimestampsOrdered)
+	{
+		int32 Begin, End;
+		FindTimeRange(List, StartTime, EndTime, Begin, End);
+
+		OutCount = FMath::Max(0, End - Begin);
+		if (OutCount == 0)
+		{
+			OutQuantity = OutValue = OutPrice = 0.0;
+			return;
+		}
+
+		OutQuantity = List.CumQuantity[End - 1] - SumBefore(List.CumQuantity, Begin);
+		OutValue = List.CumValue[End - 1] - SumBefore(List.CumValue, Begin);
+		OutPrice = List.CumPrice[End - 1] - SumBefore(List.CumPrice, Begin);
+		return;
+	}
+
+	// Out-of-order history: scan this index only
+	OutQuantity = OutValue = OutPrice = 0.0;
+	OutCount = 0;
+	for (int32 i = List.First; i < List.Sequences.Num(); ++i)
+	{
+		if (List.Timestamps[i] >= StartTime && List.Timestamps[i] <= EndTime)
+		{
+			OutQuantity += List.CumQuantity[i] - SumBefore(List.CumQuantity, i);
+			OutValue += List.CumValue[i] - SumBefore(List.CumValue, i);
+			OutPrice += List.CumPrice[i] - SumBefore(List.CumPrice, i);
+			++OutCount;
+		}
+	}
+}
+
+FName UTradeTransactionManager::GetItemKey(const FTradeTransaction& Transaction)
+{
+	return Transaction.TradeItem ? Transaction.TradeItem->ItemID : NAME_None;
 }
@@ -0,0 +1,835 @@
+#include "Trading/TradeTransactionArchive.h"
+#include "Trading/TradeItemDataAsset.h"
+#include "Trading/MarketDataAsset.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "UObject/SoftObjectPath.h"
+#include "AdastreaLog.h"
+
+namespace TradeTransactionArchive
+{
+	/** Columns stored in every block, in file order */
+	enum EColumn : int32
+	{
+		Column_Dictionary,		// New names, items and markets introduced by the block
+		Column_TransactionID,	// 4 x uint32
+		Column_Type,			// uint8
+		Column_Item,			// Item dictionary index + 1
+		Column_Quantity,		// Zigzag varint
+		Column_PricePerUnit,	// float
+		Column_TotalValue,		// Zigzag varint
+		Column_TaxPaid,			// Zigzag varint
+		Column_Parties,			// Buyer, seller, buyer faction, seller faction name indices + 1
+		Column_Market,			// Market dictionary index + 1
+		Column_Location,		// 3 x double
+		Column_Timestamp,		// Zigzag varint delta of float bits
+		Column_RealTimestamp,	// Zigzag varint delta of ticks
+		Column_Conditions,		// Supply and demand floats
+		Column_Events,			// Count, then name indices + 1
+		Column_Flags,			// Bitfield
+		Column_Count
+	};
+
+	enum EFlags : uint8
+	{
+		Flag_Suspicious = 1 << 0,
+		Flag_Contraband = 1 << 1,
+		Flag_CaughtWithContraband = 1 << 2
+	};
+
+	/** Magic, version, compression, reserved, row count, rows per block, block count */
+	constexpr int64 HeaderSize = 4 + 2 + 1 + 1 + 8 + 4 + 4;
+
+	FName GetFormatName(ECompression Compression)
+	{
+		switch (Compression)
+		{
+		case ECompression::Zlib:
+			return NAME_Zlib;
+		case ECompression::Oodle:
+			return NAME_Oodle;
+		default:
+			return NAME_None;
+		}
+	}
+
+	// ====================
+	// ENCODING
+	// ====================
+
+	void WriteVarUInt(TArray<uint8>& Out, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add(static_cast<uint8>((Value & 0x7F) | 0x80));
+			Value >>= 7;
+		}
+		Out.Add(static_cast<uint8>(Value));
+	}
+
+	void WriteVarInt(TArray<uint8>& Out, int64 Value)
+	{
+		WriteVarUInt(Out, (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63));
+	}
+
+	template<typename T>
+	void WriteRaw(TArray<uint8>& Out, const T& Value)
+	{
+		Out.Append(reinterpret_cast<const uint8*>(&Value), static_cast<int32>(sizeof(T)));
+	}
+
+	void WriteString(TArray<uint8>& Out, const FString& Value)
+	{
+		const FTCHARToUTF8 Converter(*Value);
+		WriteVarUInt(Out, static_cast<uint64>(Converter.Length()));
+		Out.Append(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+	}
+
+	uint32 GetFloatBits(float Value)
+	{
+		uint32 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	float FromFloatBits(uint32 Bits)
+	{
+		float Value;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	// ====================
+	// DECODING
+	// ====================
+
+	/** Bounds-checked cursor over a decoded buffer; any overrun sets bError */
+	struct FByteReader
+	{
+		const uint8* Cursor;
+		const uint8* End;
+		bool bError = false;
+
+		FByteReader(const uint8* Data, int64 Size)
+			: Cursor(Data)
+			, End(Data + Size)
+		{}
+
+		bool CanRead(int64 Size)
+		{
+			if (End - Cursor < Size)
+			{
+				bError = true;
+				return false;
+			}
+			return true;
+		}
+
+		uint64 ReadVarUInt()
+		{
+			uint64 Value = 0;
+			for (int32 Shift = 0; Shift < 64; Shift += 7)
+			{
+				if (Cursor >= End)
+				{
+					break;
+				}
+
+				const uint8 Byte = *Cursor++;
+				Value |= static_cast<uint64>(Byte & 0x7F) << Shift;
+				if (!(Byte & 0x80))
+				{
+					return Value;
+				}
+			}
+
+			bError = true;
+			return 0;
+		}
+
+		int64 ReadVarInt()
+		{
+			const uint64 Value = ReadVarUInt();
+			return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+		}
+
+		template<typename T>
+		T ReadRaw()
+		{
+			T Value{};
+			if (CanRead(sizeof(T)))
+			{
+				FMemory::Memcpy(&Value, Cursor, sizeof(T));
+				Cursor += sizeof(T);
+			}
+			return Value;
+		}
+
+		FString ReadString()
+		{
+			const uint64 Length = ReadVarUInt();
+			if (!CanRead(static_cast<int64>(Length)))
+			{
+				return FString();
+			}
+
+			const FUTF8ToTCHAR Converter(reinterpret_cast<const UTF8CHAR*>(Cursor), static_cast<int32>(Length));
+			Cursor += Length;
+			return FString(Converter.Length(), Converter.Get());
+		}
+
+		/** Read a dictionary reference (index + 1, 0 for none) */
+		template<typename T>
+		T ReadReference(const TArray<T>& Dictionary, T NoneValue)
+		{
+			const uint64 Reference = ReadVarUInt();
+			if (Reference == 0)
+			{
+				return NoneValue;
+			}
+			if (Reference > static_cast<uint64>(Dictionary.Num()))
+			{
+				bError = true;
+				return NoneValue;
+			}
+			return Dictionary[static_cast<int32>(Reference - 1)];
+		}
+	};
+}
+
+// ====================
+// ASSET RESOLVER
+// ====================
+
+UTradeItemDataAsset* FTradeTransactionAssetResolver::ResolveItem(FName ItemID, const FString& ObjectPath)
+{
+	if (UTradeItemDataAsset* Item = Cast<UTradeItemDataAsset>(ResolvePath(ObjectPath)))
+	{
+		return Item;
+	}
+
+	// Asset was moved or renamed; fall back to its ItemID
+	if (ItemID.IsNone())
+	{
+		return nullptr;
+	}
+
+	if (!bItemsScanned)
+	{
+		ScanItems();
+	}
+
+	UTradeItemDataAsset** Item = ItemsByID.Find(ItemID);
+	return Item ? *Item : nullptr;
+}
+
+UMarketDataAsset* FTradeTransactionAssetResolver::ResolveMarket(const FString& ObjectPath)
+{
+	return Cast<UMarketDataAsset>(ResolvePath(ObjectPath));
+}
+
+UObject* FTradeTransactionAssetResolver::ResolvePath(const FString& ObjectPath)
+{
+	if (ObjectPath.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const FSoftObjectPath SoftPath(ObjectPath);
+	if (UObject* Loaded = SoftPath.ResolveObject())
+	{
+		return Loaded;
+	}
+
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		const FAssetData AssetData = AssetRegistry->GetAssetByObjectPath(SoftPath);
+		if (AssetData.IsValid())
+		{
+			return AssetData.GetAsset();
+		}
+	}
+
+	return nullptr;
+}
+
+void FTradeTransactionAssetResolver::ScanItems()
+{
+	bItemsScanned = true;
+
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (!AssetRegistry)
+	{
+		return;
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry->GetAssetsByClass(UTradeItemDataAsset::StaticClass()->GetClassPathName(), Assets, true);
+
+	for (const FAssetData& AssetData : Assets)
+	{
+		UTradeItemDataAsset* Item = Cast<UTradeItemDataAsset>(AssetData.GetAsset());
+		if (Item && !Item->ItemID.IsNone() && !ItemsByID.Contains(Item->ItemID))
+		{
+			ItemsByID.Add(Item->ItemID, Item);
+		}
+	}
+}
+
+// ====================
+// WRITER
+// ====================
+
+struct FTradeTransactionArchiveWriter::FBlockColumns
+{
+	TArray<uint8> Buffers[TradeTransactionArchive::Column_Count];
+
+	// Dictionary entries added since the last flush
+	TArray<FName> NewNames;
+	TArray<TPair<uint32, FString>> NewItems;
+	TArray<FString> NewMarkets;
+
+	/** Compression scratch */
+	TArray<uint8> Compressed;
+
+	void Reset()
+	{
+		for (TArray<uint8>& Buffer : Buffers)
+		{
+			Buffer.Reset();
+		}
+		NewNames.Reset();
+		NewItems.Reset();
+		NewMarkets.Reset();
+	}
+};
+
+FTradeTransactionArchiveWriter::FTradeTransactionArchiveWriter(int32 InRowsPerBlock, TradeTransactionArchive::ECompression InCompression)
+	: Columns(MakeUnique<FBlockColumns>())
+	, RowsPerBlock(FMath::Max(1, InRowsPerBlock))
+	, Compression(InCompression)
+{
+}
+
+FTradeTransactionArchiveWriter::~FTradeTransactionArchiveWriter()
+{
+	Close();
+}
+
+bool FTradeTransactionArchiveWriter::Open(const FString& FilePath)
+{
+	Close();
+
+	FileWriter.Reset(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!FileWriter)
+	{
+		UE_LOG(LogAdastreaTrading, Warning, TEXT("TradeTransactionArchive: Cannot create %s"), *FilePath);
+		return false;
+	}
+
+	NumRows = 0;
+	NumBlocks = 0;
+	RowsInBlock = 0;
+	bError = false;
+	NameIndices.Reset();
+	ItemIndices.Reset();
+	MarketIndices.Reset();
+	Columns->Reset();
+	PreviousTimestampBits = 0;
+	PreviousRealTicks = 0;
+
+	// Row and block counts are patched on Close
+	WriteHeader();
+	return true;
+}
+
+void FTradeTransactionArchiveWriter::Write(const FTradeTransaction& Transaction)
+{
+	using namespace TradeTransactionArchive;
+
+	if (!FileWriter)
+	{
+		return;
+	}
+
+	TArray<uint8>* Buffers = Columns->Buffers;
+
+	WriteRaw(Buffers[Column_TransactionID], Transaction.TransactionID.A);
+	WriteRaw(Buffers[Column_TransactionID], Transaction.TransactionID.B);
+	WriteRaw(Buffers[Column_TransactionID], Transaction.TransactionID.C);
+	WriteRaw(Buffers[Column_TransactionID], Transaction.TransactionID.D);
+	Buffers[Column_Type].Add(static_cast<uint8>(Transaction.TransactionType));
+
+	// Items are keyed by asset; the entry stores the ItemID for lookup if the path moves
+	uint32 ItemReference = 0;
+	if (const UTradeItemDataAsset* Item = Transaction.TradeItem)
+	{
+		if (const uint32* Existing = ItemIndices.Find(Item))
+		{
+			ItemReference = *Existing;
+		}
+		else
+		{
+			ItemReference = static_cast<uint32>(ItemIndices.Num() + 1);
+			ItemIndices.Add(Item, ItemReference);
+			Columns->NewItems.Emplace(FindOrAddName(Item->ItemID), Item->GetPathName());
+		}
+	}
+	WriteVarUInt(Buffers[Column_Item], ItemReference);
+
+	WriteVarInt(Buffers[Column_Quantity], Transaction.Quantity);
+	WriteRaw(Buffers[Column_PricePerUnit], Transaction.PricePerUnit);
+	WriteVarInt(Buffers[Column_TotalValue], Transaction.TotalValue);
+	WriteVarInt(Buffers[Column_TaxPaid], Transaction.TaxPaid);
+
+	WriteVarUInt(Buffers[Column_Parties], FindOrAddName(Transaction.BuyerID));
+	WriteVarUInt(Buffers[Column_Parties], FindOrAddName(Transaction.SellerID));
+	WriteVarUInt(Buffers[Column_Parties], FindOrAddName(Transaction.BuyerFactionID));
+	WriteVarUInt(Buffers[Column_Parties], FindOrAddName(Transaction.SellerFactionID));
+
+	uint32 MarketReference = 0;
+	if (const UMarketDataAsset* Market = Transaction.Market)
+	{
+		if (const uint32* Existing = MarketIndices.Find(Market))
+		{
+			MarketReference = *Existing;
+		}
+		else
+		{
+			MarketReference = static_cast<uint32>(MarketIndices.Num() + 1);
+			MarketIndices.Add(Market, MarketReference);
+			Columns->NewMarkets.Add(Market->GetPathName());
+		}
+	}
+	WriteVarUInt(Buffers[Column_Market], MarketReference);
+
+	WriteRaw(Buffers[Column_Location], Transaction.Location.X);
+	WriteRaw(Buffers[Column_Location], Transaction.Location.Y);
+	WriteRaw(Buffers[Column_Location], Transaction.Location.Z);
+
+	// Ascending positive floats have ascending bit patterns, so deltas stay small
+	const uint32 TimestampBits = GetFloatBits(Transaction.Timestamp);
+	WriteVarInt(Buffers[Column_Timestamp], static_cast<int64>(TimestampBits) - static_cast<int64>(PreviousTimestampBits));
+	PreviousTimestampBits = TimestampBits;
+
+	const int64 RealTicks = Transaction.RealTimestamp.GetTicks();
+	WriteVarInt(Buffers[Column_RealTimestamp], RealTicks - PreviousRealTicks);
+	PreviousRealTicks = RealTicks;
+
+	WriteRaw(Buffers[Column_Conditions], Transaction.SupplyLevel);
+	WriteRaw(Buffers[Column_Conditions], Transaction.DemandLevel);
+
+	WriteVarUInt(Buffers[Column_Events], Transaction.ActiveEventIDs.Num());
+	for (const FName& EventID : Transaction.ActiveEventIDs)
+	{
+		WriteVarUInt(Buffers[Column_Events], FindOrAddName(EventID));
+	}
+
+	Buffers[Column_Flags].Add(static_cast<uint8>(
+		(Transaction.bFlaggedAsSuspicious ? Flag_Suspicious : 0)
+		| (Transaction.bInvolvedContraband ? Flag_Contraband : 0)
+		| (Transaction.bCaughtWithContraband ? Flag_CaughtWithContraband : 0)));
+
+	++NumRows;
+	if (++RowsInBlock >= RowsPerBlock)
+	{
+		FlushBlock();
+	}
+}
+
+bool FTradeTransactionArchiveWriter::Close()
+{
+	if (!FileWriter)
+	{
+		return false;
+	}
+
+	if (RowsInBlock > 0)
+	{
+		FlushBlock();
+	}
+
+	FileWriter->Seek(0);
+	WriteHeader();
+
+	const bool bSuccess = FileWriter->Close() && !bError;
+	FileWriter.Reset();
+	Columns->Reset();
+
+	if (!bSuccess)
+	{
+		UE_LOG(LogAdastreaTrading, Warning, TEXT("TradeTransactionArchive: Failed to write archive"));
+	}
+	return bSuccess;
+}
+
+void FTradeTransactionArchiveWriter::FlushBlock()
+{
+	using namespace TradeTransactionArchive;
+
+	// Dictionary entries first, so the reader can resolve this block's references
+	TArray<uint8>& Dictionary = Columns->Buffers[Column_Dictionary];
+	WriteVarUInt(Dictionary, Columns->NewNames.Num());
+	for (const FName& Name : Columns->NewNames)
+	{
+		WriteString(Dictionary, Name.ToString());
+	}
+	WriteVarUInt(Dictionary, Columns->NewItems.Num());
+	for (const TPair<uint32, FString>& Item : Columns->NewItems)
+	{
+		WriteVarUInt(Dictionary, Item.Key);
+		WriteString(Dictionary, Item.Value);
+	}
+	WriteVarUInt(Dictionary, Columns->NewMarkets.Num());
+	for (const FString& MarketPath : Columns->NewMarkets)
+	{
+		WriteString(Dictionary, MarketPath);
+	}
+
+	int32 BlockRows = RowsInBlock;
+	*FileWriter << BlockRows;
+
+	// Each column is compressed on its own; stored size == raw size means stored uncompressed
+	const FName FormatName = GetFormatName(Compression);
+	for (TArray<uint8>& Buffer : Columns->Buffers)
+	{
+		int32 RawSize = Buffer.Num();
+		int32 StoredSize = RawSize;
+		const uint8* StoredData = Buffer.GetData();
+
+		if (!FormatName.IsNone() && RawSize > 0)
+		{
+			int32 CompressedSize = FCompression::CompressMemoryBound(FormatName, RawSize);
+			Columns->Compressed.SetNumUninitialized(CompressedSize, EAllowShrinking::No);
+			if (FCompression::CompressMemory(FormatName, Columns->Compressed.GetData(), CompressedSize, Buffer.GetData(), RawSize)
+				&& CompressedSize < RawSize)
+			{
+				StoredSize = CompressedSize;
+				StoredData = Columns->Compressed.GetData();
+			}
+		}
+
+		*FileWriter << RawSize;
+		*FileWriter << StoredSize;
+		FileWriter->Serialize(const_cast<uint8*>(StoredData), StoredSize);
+	}
+
+	bError |= FileWriter->IsError();
+
+	Columns->Reset();
+	RowsInBlock = 0;
+	++NumBlocks;
+	PreviousTimestampBits = 0;
+	PreviousRealTicks = 0;
+}
+
+void FTradeTransactionArchiveWriter::WriteHeader()
+{
+	uint32 FileMagic = TradeTransactionArchive::Magic;
+	uint16 FileVersion = TradeTransactionArchive::Version;
+	uint8 CompressionFormat = static_cast<uint8>(Compression);
+	uint8 Reserved = 0;
+	int64 TotalRows = NumRows;
+	int32 BlockSize = RowsPerBlock;
+	int32 TotalBlocks = NumBlocks;
+
+	*FileWriter << FileMagic << FileVersion << CompressionFormat << Reserved << TotalRows << BlockSize << TotalBlocks;
+}
+
+uint32 FTradeTransactionArchiveWriter::FindOrAddName(FName Name)
+{
+	if (Name.IsNone())
+	{
+		return 0;
+	}
+
+	if (const uint32* Existing = NameIndices.Find(Name))
+	{
+		return *Existing;
+	}
+
+	const uint32 Reference = static_cast<uint32>(NameIndices.Num() + 1);
+	NameIndices.Add(Name, Reference);
+	Columns->NewNames.Add(Name);
+	return Reference;
+}
+
+// ====================
+// READER
+// ====================
+
+FTradeTransactionArchiveReader::FTradeTransactionArchiveReader()
+{
+	ColumnBuffers.SetNum(TradeTransactionArchive::Column_Count);
+}
+
+FTradeTransactionArchiveReader::~FTradeTransactionArchiveReader()
+{
+	Close();
+}
+
+bool FTradeTransactionArchiveReader::Open(const FString& FilePath)
+{
+	using namespace TradeTransactionArchive;
+
+	Close();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*FilePath);
+	if (MappedResult.HasValue())
+	{
+		MappedFile = MappedResult.StealValue();
+		if (MappedFile->GetFileSize() > 0)
+		{
+			MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+		}
+	}
+
+	if (MappedRegion)
+	{
+		FileData = MappedRegion->GetMappedPtr();
+		FileSize = MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		// Platforms without mapping support read the whole file instead
+		MappedFile.Reset();
+		if (!FFileHelper::LoadFileToArray(FallbackData, *FilePath, FILEREAD_Silent))
+		{
+			UE_LOG(LogAdastreaTrading, Warning, TEXT("TradeTransactionArchive: Cannot open %s"), *FilePath);
+			return false;
+		}
+		FileData = FallbackData.GetData();
+		FileSize = FallbackData.Num();
+	}
+
+	FByteReader Header(FileData, FileSize);
+	const uint32 FileMagic = Header.ReadRaw<uint32>();
+	const uint16 FileVersion = Header.ReadRaw<uint16>();
+	const uint8 CompressionFormat = Header.ReadRaw<uint8>();
+	Header.ReadRaw<uint8>();
+	NumRows = Header.ReadRaw<int64>();
+	RowsPerBlock = Header.ReadRaw<int32>();
+	NumBlocks = Header.ReadRaw<int32>();
+
+	if (Header.bError || FileMagic != Magic || FileVersion > Version
+		|| CompressionFormat > static_cast<uint8>(ECompression::Oodle) || NumRows < 0 || RowsPerBlock <= 0 || NumBlocks < 0)
+	{
+		UE_LOG(LogAdastreaTrading, Warning, TEXT("TradeTransactionArchive: %s is not a supported trade archive"), *FilePath);
+		Close();
+		bError = true;
+		return false;
+	}
+
+	Compression = static_cast<ECompression>(CompressionFormat);
+	Offset = HeaderSize;
+	return true;
+}
+
+void FTradeTransactionArchiveReader::Close()
+{
+	// Region must be released before its file handle
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	FallbackData.Empty();
+	FileData = nullptr;
+	FileSize = 0;
+	Offset = 0;
+	NumRows = 0;
+	RowsPerBlock = 0;
+	NumBlocks = 0;
+	BlocksRead = 0;
+	RowsRead = 0;
+	bError = false;
+	Names.Reset();
+	Items.Reset();
+	Markets.Reset();
+}
+
+bool FTradeTransactionArchiveReader::ReadNextBlock(TArray<FTradeTransaction>& OutRows)
+{
+	using namespace TradeTransactionArchive;
+
+	if (!FileData || bError || BlocksRead >= NumBlocks)
+	{
+		return false;
+	}
+
+	FByteReader Block(FileData + Offset, FileSize - Offset);
+	const int32 BlockRows = Block.ReadRaw<int32>();
+
+	// The row count sizes OutRows, so check it against the header before trusting it
+	if (BlockRows < 0 || BlockRows > RowsPerBlock || BlockRows > NumRows - RowsRead)
+	{
+		Block.bError = true;
+	}
+
+	// Uncompressed columns are read straight from the mapping
+	const uint8* ColumnData[Column_Count] = {};
+	int32 ColumnSizes[Column_Count] = {};
+	const FName FormatName = GetFormatName(Compression);
+
+	for (int32 Column = 0; Column < Column_Count && !Block.bError; ++Column)
+	{
+		const int32 RawSize = Block.ReadRaw<int32>();
+		const int32 StoredSize = Block.ReadRaw<int32>();
+		if (RawSize < 0 || StoredSize < 0 || StoredSize > RawSize || !Block.CanRead(StoredSize))
+		{
+			Block.bError = true;
+			break;
+		}
+
+		if (StoredSize == RawSize)
+		{
+			ColumnData[Column] = Block.Cursor;
+		}
+		else
+		{
+			TArray<uint8>& Buffer = ColumnBuffers[Column];
+			Buffer.SetNumUninitialized(RawSize, EAllowShrinking::No);
+			if (FormatName.IsNone() || !FCompression::UncompressMemory(FormatName, Buffer.GetData(), RawSize, Block.Cursor, StoredSize))
+			{
+				Block.bError = true;
+				break;
+			}
+			ColumnData[Column] = Buffer.GetData();
+		}
+
+		ColumnSizes[Column] = RawSize;
+		Block.Cursor += StoredSize;
+	}
+
+	if (Block.bError || !ReadDictionary(ColumnData[Column_Dictionary], ColumnSizes[Column_Dictionary]))
+	{
+		UE_LOG(LogAdastreaTrading, Warning, TEXT("TradeTransactionArchive: Corrupt block %d"), BlocksRead);
+		bError = true;
+		return false;
+	}
+
+	Offset = Block.Cursor - FileData;
+	++BlocksRead;
+	RowsRead += BlockRows;
+
+	// Decode column by column; every field of every row is overwritten, so storage can be reused
+	OutRows.SetNum(BlockRows, EAllowShrinking::No);
+
+	FByteReader IDs(ColumnData[Column_TransactionID], ColumnSizes[Column_TransactionID]);
+	FByteReader Types(ColumnData[Column_Type], ColumnSizes[Column_Type]);
+	FByteReader ItemRefs(ColumnData[Column_Item], ColumnSizes[Column_Item]);
+	FByteReader Quantities(ColumnData[Column_Quantity], ColumnSizes[Column_Quantity]);
+	FByteReader Prices(ColumnData[Column_PricePerUnit], ColumnSizes[Column_PricePerUnit]);
+	FByteReader TotalValues(ColumnData[Column_TotalValue], ColumnSizes[Column_TotalValue]);
+	FByteReader Taxes(ColumnData[Column_TaxPaid], ColumnSizes[Column_TaxPaid]);
+	FByteReader Parties(ColumnData[Column_Parties], ColumnSizes[Column_Parties]);
+	FByteReader MarketRefs(ColumnData[Column_Market], ColumnSizes[Column_Market]);
+	FByteReader Locations(ColumnData[Column_Location], ColumnSizes[Column_Location]);
+	FByteReader Timestamps(ColumnData[Column_Timestamp], ColumnSizes[Column_Timestamp]);
+	FByteReader RealTimestamps(ColumnData[Column_RealTimestamp], ColumnSizes[Column_RealTimestamp]);
+	FByteReader Conditions(ColumnData[Column_Conditions], ColumnSizes[Column_Conditions]);
+	FByteReader Events(ColumnData[Column_Events], ColumnSizes[Column_Events]);
+	FByteReader Flags(ColumnData[Column_Flags], ColumnSizes[Column_Flags]);
+
+	int64 TimestampBits = 0;
+	int64 RealTicks = 0;
+
+	for (FTradeTransaction& Row : OutRows)
+	{
+		Row.TransactionID.A = IDs.ReadRaw<uint32>();
+		Row.TransactionID.B = IDs.ReadRaw<uint32>();
+		Row.TransactionID.C = IDs.ReadRaw<uint32>();
+		Row.TransactionID.D = IDs.ReadRaw<uint32>();
+		Row.TransactionType = static_cast<ETransactionType>(Types.ReadRaw<uint8>());
+		Row.TradeItem = ItemRefs.ReadReference<UTradeItemDataAsset*>(Items, nullptr);
+		Row.Quantity = static_cast<int32>(Quantities.ReadVarInt());
+		Row.PricePerUnit = Prices.ReadRaw<float>();
+		Row.TotalValue = static_cast<int32>(TotalValues.ReadVarInt());
+		Row.TaxPaid = static_cast<int32>(Taxes.ReadVarInt());
+		Row.BuyerID = Parties.ReadReference<FName>(Names, NAME_None);
+		Row.SellerID = Parties.ReadReference<FName>(Names, NAME_None);
+		Row.BuyerFactionID = Parties.ReadReference<FName>(Names, NAME_None);
+		Row.SellerFactionID = Parties.ReadReference<FName>(Names, NAME_None);
+		Row.Market = MarketRefs.ReadReference<UMarketDataAsset*>(Markets, nullptr);
+		Row.Location.X = Locations.ReadRaw<double>();
+		Row.Location.Y = Locations.ReadRaw<double>();
+		Row.Location.Z = Locations.ReadRaw<double>();
+
+		TimestampBits += Timestamps.ReadVarInt();
+		Row.Timestamp = FromFloatBits(static_cast<uint32>(TimestampBits));
+		RealTicks += RealTimestamps.ReadVarInt();
+		Row.RealTimestamp = FDateTime(RealTicks);
+
+		Row.SupplyLevel = Conditions.ReadRaw<float>();
+		Row.DemandLevel = Conditions.ReadRaw<float>();
+
+		const uint64 NumEvents = Events.ReadVarUInt();
+		Row.ActiveEventIDs.Reset();
+		if (Events.CanRead(static_cast<int64>(NumEvents)))
+		{
+			for (uint64 EventIndex = 0; EventIndex < NumEvents; ++EventIndex)
+			{
+				Row.ActiveEventIDs.Add(Events.ReadReference<FName>(Names, NAME_None));
+			}
+		}
+
+		const uint8 RowFlags = Flags.ReadRaw<uint8>();
+		Row.bFlaggedAsSuspicious = (RowFlags & Flag_Suspicious) != 0;
+		Row.bInvolvedContraband = (RowFlags & Flag_Contraband) != 0;
+		Row.bCaughtWithContraband = (RowFlags & Flag_CaughtWithContraband) != 0;
+	}
+
+	if (IDs.bError || Types.bError || ItemRefs.bError || Quantities.bError || Prices.bError
+		|| TotalValues.bError || Taxes.bError || Parties.bError || MarketRefs.bError || Locations.bError
+		|| Timestamps.bError || RealTimestamps.bError || Conditions.bError || Events.bError || Flags.bError)
+	{
+		UE_LOG(LogAdastreaTrading, Warning, TEXT("TradeTransactionArchive: Corrupt rows in block %d"), BlocksRead - 1);
+		OutRows.Reset();
+		bError = true;
+		return false;
+	}
+
+	return true;
+}
+
+bool FTradeTransactionArchiveReader::ReadDictionary(const uint8* Data, int32 Size)
+{
+	TradeTransactionArchive::FByteReader Reader(Data, Size);
+
+	const uint64 NumNewNames = Reader.ReadVarUInt();
+	for (uint64 Index = 0; Index < NumNewNames && !Reader.bError; ++Index)
+	{
+		Names.Add(FName(*Reader.ReadString()));
+	}
+
+	const uint64 NumNewItems = Reader.ReadVarUInt();
+	for (uint64 Index = 0; Index < NumNewItems && !Reader.bError; ++Index)
+	{
+		const FName ItemID = Reader.ReadReference<FName>(Names, NAME_None);
+		const FString ObjectPath = Reader.ReadString();
+
+		UTradeItemDataAsset* Item = Resolver.ResolveItem(ItemID, ObjectPath);
+		if (!Item && !Reader.bError)
+		{
+			UE_LOG(LogAdastreaTrading, Warning, TEXT("TradeTransactionArchive: Item %s (%s) not found"), *ItemID.ToString(), *ObjectPath);
+		}
+		Items.Add(Item);
+	}
+
+	const uint64 NumNewMarkets = Reader.ReadVarUInt();
+	for (uint64 Index = 0; Index < NumNewMarkets && !Reader.bError; ++Index)
+	{
+		const FString ObjectPath = Reader.ReadString();
+
+		UMarketDataAsset* Market = Resolver.ResolveMarket(ObjectPath);
+		if (!Market && !Reader.bError)
+		{
+			UE_LOG(LogAdastreaTrading, Warning, TEXT("TradeTransactionArchive: Market %s not found"), *ObjectPath);
+		}
+		Markets.Add(Market);
+	}
+
+	return !Reader.bError;
+}
@@ -2,6 +2,7 @@
 
 #include "UI/SectorMapWidget.h"
 #include "SpaceSectorMap.h"
+#include "Navigation/SectorGraphSubsystem.h"
 #include "AdastreaLog.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerController.h"
@@ -235,6 +236,13 @@ FSectorDisplayInfo USectorMapWidget::BuildSectorDisplayInfo(ASpaceSectorMap* Sec
 
 TArray<ASpaceSectorMap*> USectorMapWidget::GetAllSectors() const
 {
+	// The sector registry keeps a cached list; only scan actors when it isn't running
+	UWorld* World = GetWorld();
+	if (const USectorGraphSubsystem* SectorGraph = World ? World->GetSubsystem<USectorGraphSubsystem>() : nullptr)
+	{
+		return SectorGraph->GetAllSectors();
+	}
+	
 	TArray<AActor*> FoundActors;
 	UGameplayStatics::GetAllActorsOfClass(this, ASpaceSectorMap::StaticClass(), FoundActors);
 	
@@ -260,9 +268,6 @@ TArray<ASpaceSectorMap*> USectorMapWidget::GetNeighboringSectors() const
 		return Neighbors;
 	}
 	
-	// Get all sectors
-	TArray<ASpaceSectorMap*> AllSectors = GetAllSectors();
-	
 	// Current sector center and size
 	FVector CurrentCenter = CurrentSector->GetSectorCenter();
 	FBox CurrentBounds = CurrentSector->GetSectorBounds();
@@ -271,7 +276,20 @@ TArray<ASpaceSectorMap*> USectorMapWidget::GetNeighboringSectors() const
 	// Check each sector to see if it's adjacent (within 1.5 sector sizes)
 	float MaxDistance = SectorSize * 1.5f;
 	
-	for (ASpaceSectorMap* Sector : AllSectors)
+	// Sectors within 1.5 sector sizes are at most two grid cells away on each axis,
+	// so the registry only probes the surrounding 5x5x5 cells
+	TArray<ASpaceSectorMap*> CandidateSectors;
+	UWorld* World = GetWorld();
+	if (const USectorGraphSubsystem* SectorGraph = World ? World->GetSubsystem<USectorGraphSubsystem>() : nullptr)
+	{
+		SectorGraph->GetSectorsNear(CurrentSector->GetGridCoordinates(), 2, CandidateSectors);
+	}
+	else
+	{
+		CandidateSectors = GetAllSectors();
+	}
+	
+	for (ASpaceSectorMap* Sector : CandidateSectors)
 	{
 		if (Sector == CurrentSector)
 		{
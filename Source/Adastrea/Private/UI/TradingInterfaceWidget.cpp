@@ -6,12 +6,14 @@
 #include "Trading/PlayerTraderComponent.h"
 #include "Trading/CargoComponent.h"
 #include "Trading/EconomyManager.h"
+#include "Trading/MarketPriceHistorySubsystem.h"
 // REMOVED: #include "Factions/FactionDataAsset.h" - faction system removed per Trade Simulator MVP
 #include "AdastreaLog.h"
 #include "TimerManager.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 
 UTradingInterfaceWidget::UTradingInterfaceWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -40,7 +42,7 @@ void UTradingInterfaceWidget::NativeConstruct()
 	if (GetWorld())
 	{
 		GetWorld()->GetTimerManager().SetTimer(UpdateTimer, this,
-			&UTradingInterfaceWidget::RefreshMarketDisplay, 5.0f, true);
+			&UTradingInterfaceWidget::RefreshMarketDisplayIfChanged, 5.0f, true);
 	}
 }
 
@@ -114,24 +116,24 @@ void UTradingInterfaceWidget::CloseMarket()
 
 TArray<FMarketInventoryEntry> UTradingInterfaceWidget::GetAvailableItems() const
 {
-	if (!CurrentMarket)
+	if (!CurrentMarket || !EconomyManager)
 	{
 		return TArray<FMarketInventoryEntry>();
 	}
 
-	return CurrentMarket->Inventory;
+	return EconomyManager->GetMarketInventory(CurrentMarket);
 }
 
 TArray<FMarketInventoryEntry> UTradingInterfaceWidget::GetFilteredItems(ETradeItemCategory Category) const
 {
-	if (!CurrentMarket)
+	if (!CurrentMarket || !EconomyManager)
 	{
 		return TArray<FMarketInventoryEntry>();
 	}
 
 	// Filter by category
 	TArray<FMarketInventoryEntry> FilteredItems;
-	for (const FMarketInventoryEntry& Entry : CurrentMarket->Inventory)
+	for (const FMarketInventoryEntry& Entry : EconomyManager->GetMarketInventory(CurrentMarket))
 	{
 		if (Entry.TradeItem && Entry.TradeItem->Category == Category)
 		{
@@ -159,6 +161,18 @@ int32 UTradingInterfaceWidget::GetItemPrice(UTradeItemDataAsset* Item, int32 Qua
 	}
 }
 
+TArray<FPriceCandle> UTradingInterfaceWidget::GetItemPriceHistory(UTradeItemDataAsset* Item, EPriceCandleResolution Resolution, int32 MaxCandles) const
+{
+	UGameInstance* GameInstance = GetGameInstance();
+	const UMarketPriceHistorySubsystem* PriceHistory = GameInstance ? GameInstance->GetSubsystem<UMarketPriceHistorySubsystem>() : nullptr;
+	if (!PriceHistory || !Item || !CurrentMarket)
+	{
+		return TArray<FPriceCandle>();
+	}
+
+	return PriceHistory->GetCandles(CurrentMarket, Item, Resolution, MaxCandles);
+}
+
 int32 UTradingInterfaceWidget::GetPlayerCredits() const
 {
 	if (!PlayerTrader)
@@ -209,7 +223,7 @@ bool UTradingInterfaceWidget::AddToCart(UTradeItemDataAsset* Item, int32 Quantit
 	if (bShowBuyView)
 	{
 		// Buying: Check market has stock
-		if (!CurrentMarket || !CurrentMarket->IsItemInStock(Item->ItemID, Quantity))
+		if (!CurrentMarket || !EconomyManager || !EconomyManager->IsItemInStock(CurrentMarket, Item, Quantity))
 		{
 			return false;
 		}
@@ -370,17 +384,8 @@ bool UTradingInterfaceWidget::HasCargoSpaceForCart() const
 		return true;
 	}
 
-	// If buying, check cargo space
-	float RequiredSpace = 0.0f;
-	for (const auto& CartItem : ShoppingCart)
-	{
-		if (CartItem.Key)
-		{
-			RequiredSpace += CartItem.Key->GetTotalVolume(CartItem.Value);
-		}
-	}
-
-	return PlayerCargo->GetAvailableCargoSpace() >= RequiredSpace;
+	// If buying, check the whole cart against the hold's running totals
+	return PlayerCargo->HasSpaceForAll(ShoppingCart);
 }
 
 bool UTradingInterfaceWidget::ValidateTransaction(FText& OutErrorMessage) const
@@ -590,10 +595,25 @@ void UTradingInterfaceWidget::RefreshMarketDisplay()
 		return;
 	}
 
+	if (EconomyManager)
+	{
+		DisplayedSnapshotVersion = EconomyManager->GetSnapshotVersion();
+	}
+
 	// Fire update event for Blueprint to rebuild UI
 	OnMarketInventoryUpdated();
 }
 
+void UTradingInterfaceWidget::RefreshMarketDisplayIfChanged()
+{
+	if (!CurrentMarket || (EconomyManager && !EconomyManager->HasMarketChangedSince(CurrentMarket, DisplayedSnapshotVersion)))
+	{
+		return;
+	}
+
+	RefreshMarketDisplay();
+}
+
 void UTradingInterfaceWidget::UpdatePlayerState()
 {
 	if (!PlayerTrader || !PlayerCargo)
@@ -2,6 +2,7 @@
 
 #include "UI/UniverseMapWidget.h"
 #include "SpaceSectorMap.h"
+#include "Navigation/SectorGraphSubsystem.h"
 #include "AdastreaLog.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerController.h"
@@ -384,6 +385,13 @@ FIntVector UUniverseMapWidget::CalculateGridCoordinates(ASpaceSectorMap* Sector)
 
 TArray<ASpaceSectorMap*> UUniverseMapWidget::FindAllSectorsInWorld() const
 {
+	// The sector registry keeps a cached list; only scan actors when it isn't running
+	UWorld* World = GetWorld();
+	if (const USectorGraphSubsystem* SectorGraph = World ? World->GetSubsystem<USectorGraphSubsystem>() : nullptr)
+	{
+		return SectorGraph->GetAllSectors();
+	}
+	
 	TArray<AActor*> FoundActors;
 	UGameplayStatics::GetAllActorsOfClass(this, ASpaceSectorMap::StaticClass(), FoundActors);
 	
@@ -605,86 +613,44 @@ TArray<ASpaceSectorMap*> UUniverseMapWidget::FindPathBetweenSectors(ASpaceSector
 		return Path;
 	}
 	
-	// Simple A* pathfinding through grid
-	TSet<ASpaceSectorMap*> ClosedSet;
-	TSet<ASpaceSectorMap*> OpenSet;
-	TMap<ASpaceSectorMap*, ASpaceSectorMap*> CameFrom;
-	TMap<ASpaceSectorMap*, int32> GScore;
-	TMap<ASpaceSectorMap*, int32> FScore;
-	
-	OpenSet.Add(StartSector);
-	GScore.Add(StartSector, 0);
-	FScore.Add(StartSector, GetGridDistanceBetweenSectors(StartSector, EndSector));
-	
-	while (OpenSet.Num() > 0)
+	// Route through the shared sector graph (CSR adjacency, heap-based A*, cached next hops)
+	UWorld* World = GetWorld();
+	if (const USectorGraphSubsystem* SectorGraph = World ? World->GetSubsystem<USectorGraphSubsystem>() : nullptr)
+	{
+		Path = SectorGraph->FindSectorPath(StartSector, EndSector);
+	}
+	else
 	{
-		// Find sector with lowest FScore in OpenSet
-		ASpaceSectorMap* Current = nullptr;
-		int32 LowestFScore = MAX_int32;
-		for (ASpaceSectorMap* Sector : OpenSet)
+		// No subsystem in this world type: route over the sectors this map knows about
+		FSectorGraph LocalGraph;
+		for (ASpaceSectorMap* Sector : AllSectors)
 		{
-			int32 Score = FScore.FindRef(Sector);
-			if (Score < LowestFScore)
+			if (Sector)
 			{
-				LowestFScore = Score;
-				Current = Sector;
+				LocalGraph.AddSector(Sector, Sector->GetGridCoordinates(), Sector->GetSectorCenter());
 			}
 		}
+		LocalGraph.AddSector(StartSector, StartSector->GetGridCoordinates(), StartSector->GetSectorCenter());
+		LocalGraph.AddSector(EndSector, EndSector->GetGridCoordinates(), EndSector->GetSectorCenter());
 		
-		if (Current == EndSector)
+		TArray<int32> Nodes;
+		if (LocalGraph.FindPath(LocalGraph.FindNode(StartSector), LocalGraph.FindNode(EndSector), Nodes))
 		{
-			// Reconstruct path
-			while (Current != nullptr)
+			for (const int32 Node : Nodes)
 			{
-				Path.Insert(Current, 0);
-				Current = CameFrom.FindRef(Current);
+				Path.Add(LocalGraph.GetSector(Node));
 			}
-			
-			UE_LOG(LogAdastrea, Log, TEXT("UniverseMapWidget: Found path with %d sectors"), Path.Num());
-			return Path;
-		}
-		
-		OpenSet.Remove(Current);
-		ClosedSet.Add(Current);
-		
-		// Check neighbors
-		TArray<ASpaceSectorMap*> Neighbors = Current->GetNeighboringSectors();
-		for (ASpaceSectorMap* Neighbor : Neighbors)
-		{
-			if (ClosedSet.Contains(Neighbor))
-			{
-				continue;
-			}
-			
-			const int32 TentativeGScore = GScore.FindRef(Current) + 1; // Cost of 1 per sector
-			
-			if (!OpenSet.Contains(Neighbor))
-			{
-				OpenSet.Add(Neighbor);
-			}
-			else
-			{
-				// If this path is not better than the existing one, skip updating this neighbor
-				const int32* ExistingNeighborGScore = GScore.Find(Neighbor);
-				if (ExistingNeighborGScore && TentativeGScore >= *ExistingNeighborGScore)
-				{
-					continue;
-				}
-			}
-			
-			// This is the best path to Neighbor found so far; update came-from and scores
-			CameFrom.FindOrAdd(Neighbor) = Current;
-			
-			int32& NeighborGScore = GScore.FindOrAdd(Neighbor);
-			NeighborGScore = TentativeGScore;
-			
-			const int32 Heuristic = GetGridDistanceBetweenSectors(Neighbor, EndSector);
-			int32& NeighborFScore = FScore.FindOrAdd(Neighbor);
-			NeighborFScore = TentativeGScore + Heuristic;
 		}
 	}
 	
-	UE_LOG(LogAdastrea, Warning, TEXT("UniverseMapWidget: No path found between sectors"));
+	if (Path.Num() > 0)
+	{
+		UE_LOG(LogAdastrea, Log, TEXT("UniverseMapWidget: Found path with %d sectors"), Path.Num());
+	}
+	else
+	{
+		UE_LOG(LogAdastrea, Warning, TEXT("UniverseMapWidget: No path found between sectors"));
+	}
 	return Path;
 }
 
@@ -227,6 +227,15 @@ class ADASTREA_API UNavigationComponent : public UActorComponent
     UFUNCTION(BlueprintCallable, Category="Navigation|Pathfinding")
     bool FindPath3D(FVector Start, FVector End, TArray<FNavigationWaypoint>& OutPath);
 
+    /**
+     * Calculate 3D path on a worker thread; OnPathFound3D fires on the game thread when done
+     * @param Start Starting location
+     * @param End Destination location
+     * @return Request ID passed back to OnPathFound3D
+     */
+    UFUNCTION(BlueprintCallable, Category="Navigation|Pathfinding")
+    int32 RequestPath3DAsync(FVector Start, FVector End);
+
     /**
      * Check if line of sight is clear to destination
      * @param Start Starting location
@@ -336,6 +345,15 @@ class ADASTREA_API UNavigationComponent : public UActorComponent
     UFUNCTION(BlueprintNativeEvent, Category="Navigation")
     void OnObstacleDetected(FVector ObstacleLocation);
 
+    /**
+     * Called when an async path request completes
+     * @param RequestId ID returned by RequestPath3DAsync
+     * @param bPathFound Whether a path was found
+     * @param Path Generated waypoint path (excludes the start location)
+     */
+    UFUNCTION(BlueprintNativeEvent, Category="Navigation|Pathfinding")
+    void OnPathFound3D(int32 RequestId, bool bPathFound, const TArray<FNavigationWaypoint>& Path);
+
 private:
     /** Update autopilot navigation */
     void UpdateAutopilot(float DeltaTime);
@@ -357,4 +375,16 @@ class ADASTREA_API UNavigationComponent : public UActorComponent
 
     /** Apply velocity to owner actor */
     void ApplyVelocity(float DeltaTime);
+
+    /** Convert octree path points (Start ... End) into waypoints */
+    void BuildWaypointsFromPath(const TArray<FVector>& Points, TArray<FNavigationWaypoint>& OutPath) const;
+
+    /** Route an async result into the autopilot (if still current) and OnPathFound3D */
+    void HandlePathFound3D(int32 RequestId, bool bPathFound, const TArray<FNavigationWaypoint>& Path);
+
+    /** Last ID handed out by RequestPath3DAsync */
+    int32 LastPathRequestId = 0;
+
+    /** Async request whose result replaces the autopilot's direct waypoint (INDEX_NONE if none) */
+    int32 PendingAutopilotRequestId = INDEX_NONE;
 };
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Navigation Octree
+ *
+ * Sparse voxel octree over static obstacle boxes (stations and their
+ * modules) for 3D pathfinding in open space. Empty space collapses into large free
+ * leaves and only space near obstacles is subdivided down to MinLeafSize,
+ * so node count follows obstacle surface area rather than world volume.
+ * Leaves that still touch an obstacle at the finest level are blocked
+ * (conservative: paths may keep a little extra distance, never less).
+ * If MaxNodes is reached first, the remaining partially covered nodes are
+ * left free rather than blocking whole coarse regions, and Build() warns.
+ *
+ * Path queries run Theta* over free leaves: neighbors are found lazily by
+ * querying the tree, successors inherit their grandparent when it has line
+ * of sight (any-angle paths), and the result is string-pulled. Space
+ * outside the tree's bounds is treated as free.
+ *
+ * Immutable after Build(), so one tree can serve concurrent queries from
+ * worker threads (all search state is local to each query).
+ */
+class ADASTREA_API FNavigationOctree
+{
+public:
+    /** Default finest leaf edge length (20 m) */
+    static constexpr float DefaultMinLeafSize = 2000.0f;
+
+    /** Upper bound on nodes so pathological obstacle sets can't exhaust memory (raise MinLeafSize if hit) */
+    static constexpr int32 MaxNodes = 1 << 20;
+
+    /**
+     * Build the tree
+     * @param Obstacles World-space obstacle boxes, already inflated by any clearance
+     * @param InMinLeafSize Finest leaf edge length
+     */
+    void Build(TConstArrayView<FBox> Obstacles, float InMinLeafSize = DefaultMinLeafSize);
+
+    void Reset();
+
+    bool IsEmpty() const { return Nodes.Num() == 0; }
+    int32 GetNodeCount() const { return Nodes.Num(); }
+    FBox GetBounds() const { return Nodes.Num() > 0 ? Nodes[0].Bounds : FBox(ForceInit); }
+
+    /** Whether a straight segment avoids every blocked leaf */
+    bool IsSegmentClear(const FVector& Start, const FVector& End) const;
+
+    /**
+     * Find an obstacle-free path
+     * @param OutPath Points from Start to End inclusive
+     * @param MaxExpansions Search budget; the query fails once exceeded
+     * @return True if a path was found
+     */
+    bool FindPath(const FVector& Start, const FVector& End, TArray<FVector>& OutPath, int32 MaxExpansions = 20000) const;
+
+    /** Memory used by the tree */
+    SIZE_T GetAllocatedSize() const { return Nodes.GetAllocatedSize(); }
+
+private:
+    enum class ENodeState : uint8
+    {
+        Free,
+        Blocked,
+        Mixed
+    };
+
+    struct FNode
+    {
+        FBox Bounds = FBox(ForceInit);
+
+        /** First of eight consecutive children, INDEX_NONE for leaves */
+        int32 FirstChild = INDEX_NONE;
+
+        ENodeState State = ENodeState::Free;
+    };
+
+    void BuildNode(int32 NodeIndex, TConstArrayView<FBox> Obstacles, const TArray<int32>& Candidates);
+
+    /** Leaf containing a point, INDEX_NONE if outside the tree */
+    int32 FindLeaf(const FVector& Point) const;
+
+    /** Free leaves overlapping a box */
+    void GatherFreeLeaves(const FBox& Box, TArray<int32>& OutLeaves) const;
+
+    /** Free leaf whose center is nearest a point, searching outward */
+    int32 FindNearestFreeLeaf(const FVector& Point) const;
+
+    bool SegmentHitsBlocked(int32 NodeIndex, const FVector& Start, const FVector& End) const;
+
+    /** Theta* between two free leaves; OutPath gets StartPoint ... GoalPoint */
+    bool SearchLeaves(int32 StartLeaf, const FVector& StartPoint, int32 GoalLeaf, const FVector& GoalPoint, TArray<FVector>& OutPath, int32 MaxExpansions) const;
+
+    /** Drop intermediate points that have line of sight past them */
+    void SmoothPath(TArray<FVector>& Path) const;
+
+    TArray<FNode> Nodes;
+    float MinLeafSize = DefaultMinLeafSize;
+
+    /** Partially covered nodes left free during the last Build() because MaxNodes was reached */
+    int32 NumTruncatedNodes = 0;
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ASpaceSectorMap;
+
+/**
+ * Sector Graph
+ *
+ * Compact routing graph over ASpaceSectorMap sectors. Each sector gets a
+ * dense integer node ID and edges join sectors whose grid coordinates differ
+ * by one step along a single axis, weighted by center distance. Adjacency is
+ * stored in CSR form (one offsets array, one targets array) so expanding a
+ * node touches contiguous memory and never allocates.
+ *
+ * Adding or removing a sector only updates the sector tables; the CSR arrays
+ * are rebuilt lazily on the next query in O(sectors) using grid coordinate
+ * lookups, never by comparing every pair of sectors.
+ *
+ * Routing:
+ * - FindPath: A* with a binary heap, straight-line heuristic
+ * - ComputeDistancesFrom: Dijkstra from one sector to all others
+ * - GetNextHop: O(1) lookup in a precomputed next-hop table when enabled
+ *   (opt-in; built on the first GetNextHop after a change), otherwise A*
+ *
+ * Not thread-safe: queries reuse internal scratch buffers.
+ */
+class ADASTREA_API FSectorGraph
+{
+public:
+    /** Largest sector count for which the next-hop table is built (N x N int32 entries) */
+    static constexpr int32 MaxNextHopTableSectors = 2048;
+
+    /** Add a sector, or refresh its coordinates if already present; returns its node ID */
+    int32 AddSector(ASpaceSectorMap* Sector, const FIntVector& GridCoordinates, const FVector& Center);
+
+    /** Remove a sector; the last node takes over its ID. Returns false if not present */
+    bool RemoveSector(const ASpaceSectorMap* Sector);
+
+    void Reset();
+
+    int32 Num() const { return Nodes.Num(); }
+
+    /** Node ID of a sector, INDEX_NONE if not in the graph */
+    int32 FindNode(const ASpaceSectorMap* Sector) const;
+
+    /** Node at a grid coordinate (the first one if several share it), INDEX_NONE if none */
+    int32 FindNodeAt(const FIntVector& GridCoordinates) const;
+
+    ASpaceSectorMap* GetSector(int32 Node) const { return Nodes[Node].Sector; }
+    const FVector& GetCenter(int32 Node) const { return Nodes[Node].Center; }
+
+    /** Neighbor node IDs of a node */
+    TConstArrayView<int32> GetNeighbors(int32 Node) const;
+
+    /**
+     * Shortest path between two nodes
+     * @param OutPath Node IDs from Start to Goal inclusive; empty if unreachable
+     * @return True if a path exists
+     */
+    bool FindPath(int32 Start, int32 Goal, TArray<int32>& OutPath) const;
+
+    /** Shortest path length from a node to every node (TNumericLimits<float>::Max() if unreachable) */
+    void ComputeDistancesFrom(int32 Source, TArray<float>& OutDistances) const;
+
+    /**
+     * Next node on a shortest path from one node toward another
+     * @return Next node ID, To if already there, INDEX_NONE if unreachable
+     */
+    int32 GetNextHop(int32 From, int32 To) const;
+
+    /**
+     * Keep an all-pairs next-hop table for GetNextHop (off by default; ignored above MaxNextHopTableSectors)
+     * The table costs one Dijkstra per sector to build, so only enable it for heavy hop-by-hop routing
+     */
+    void SetNextHopTableEnabled(bool bEnabled);
+    bool IsNextHopTableEnabled() const { return bNextHopTableEnabled; }
+
+    /**
+     * Rebuild adjacency if sectors changed
+     * Queries do this lazily; the next-hop table is rebuilt separately by GetNextHop
+     */
+    void UpdateIfDirty() const;
+
+    /** Memory used by the graph */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    struct FNode
+    {
+        ASpaceSectorMap* Sector = nullptr;
+        FIntVector Coordinates = FIntVector::ZeroValue;
+        FVector Center = FVector::ZeroVector;
+    };
+
+    struct FOpenEntry
+    {
+        float Cost = 0.0f;
+        int32 Node = INDEX_NONE;
+    };
+
+    /** Register a node at a grid coordinate */
+    void ClaimCoordinates(const FIntVector& Coordinates, int32 NodeIndex);
+
+    /** Unregister a node from a grid coordinate, handing it to another node that shares it */
+    void ReleaseCoordinates(const FIntVector& Coordinates, int32 NodeIndex);
+
+    void RebuildEdges() const;
+    void RebuildNextHops() const;
+
+    /** Rebuild the next-hop table if enabled and sectors changed */
+    void UpdateNextHopsIfDirty() const;
+
+    /** Dijkstra from Source; OutParents holds each node's predecessor toward Source */
+    void RunDijkstra(int32 Source, TArray<float>& OutDistances, TArray<int32>& OutParents) const;
+
+    bool UsesNextHopTable() const { return bNextHopTableEnabled && Nodes.Num() <= MaxNextHopTableSectors; }
+
+    TArray<FNode> Nodes;
+    TMap<const ASpaceSectorMap*, int32> NodeBySector;
+
+    /** First node at each grid coordinate (duplicates share the coordinate's edges) */
+    TMap<FIntVector, int32> NodeByCoordinates;
+
+    /** Number of nodes at each grid coordinate, so removals only search when a duplicate remains */
+    TMap<FIntVector, int32> CoordinateCounts;
+
+    // CSR adjacency: node N's edges are [EdgeOffsets[N], EdgeOffsets[N + 1])
+    mutable TArray<int32> EdgeOffsets;
+    mutable TArray<int32> EdgeTargets;
+    mutable TArray<float> EdgeCosts;
+
+    /** Row-major From x To next-hop node IDs */
+    mutable TArray<int32> NextHops;
+
+    // A* scratch, reused between queries
+    mutable TArray<float> ScratchCosts;
+    mutable TArray<int32> ScratchParents;
+    mutable TArray<FOpenEntry> ScratchOpen;
+
+    bool bNextHopTableEnabled = false;
+    mutable bool bEdgesDirty = false;
+    mutable bool bNextHopsDirty = false;
+};
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Navigation/SectorGraph.h"
+#include "SectorGraphSubsystem.generated.h"
+
+class ASpaceSectorMap;
+
+/**
+ * Sector Graph Subsystem
+ *
+ * World-level registry and routing graph of every ASpaceSectorMap, shared by
+ * the sector/universe map UI, sector validation and AI traders.
+ *
+ * Registry:
+ * - Grid coordinate -> sector hash map, so neighbor lookups are a handful of
+ *   hash probes instead of a scan over every sector
+ * - Cached list of all sectors, so listing never iterates world actors
+ * - Sectors register on BeginPlay and PostEditMove, unregister on EndPlay and
+ *   Destroyed; the first query seeds the registry with one actor pass
+ * - GetRegistryVersion() changes whenever a sector is added, moved or removed,
+ *   letting callers invalidate their own caches
+ *
+ * Routing:
+ * - FSectorGraph with adjacency rebuilt lazily after changes; hops use A*
+ * - SetNextHopTableEnabled(true) opts into a precomputed next-hop table (up to
+ *   FSectorGraph::MaxNextHopTableSectors sectors), built on the next hop
+ *   query, after which each hop is an O(1) lookup
+ *
+ * Usage:
+ * - UUniverseMapWidget::FindPathBetweenSectors routes through it
+ * - Call GetNextSector() to step an agent along a route one sector at a time
+ */
+UCLASS()
+class ADASTREA_API USectorGraphSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ====================
+    // SUBSYSTEM LIFECYCLE
+    // ====================
+
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    // ====================
+    // REGISTRATION
+    // ====================
+
+    /** Add a sector, or refresh its grid position after it moved */
+    void RegisterSector(ASpaceSectorMap* Sector);
+
+    /** Remove a sector */
+    void UnregisterSector(ASpaceSectorMap* Sector);
+
+    /** Number of registered sectors */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category="Sector Graph")
+    int32 GetSectorCount() const;
+
+    /** Changes whenever a sector is added, moved or removed */
+    int32 GetRegistryVersion() const { return RegistryVersion; }
+
+    // ====================
+    // REGISTRY QUERIES
+    // ====================
+
+    /** All registered sectors (cached, no actor iteration) */
+    UFUNCTION(BlueprintCallable, Category="Sector Graph")
+    TArray<ASpaceSectorMap*> GetAllSectors() const;
+
+    /** First sector registered at a grid coordinate, or nullptr */
+    UFUNCTION(BlueprintCallable, Category="Sector Graph")
+    ASpaceSectorMap* FindSectorAt(const FIntVector& GridCoordinates) const;
+
+    /** Sectors one grid step away along a single axis (six hash probes) */
+    UFUNCTION(BlueprintCallable, Category="Sector Graph")
+    TArray<ASpaceSectorMap*> GetAdjacentSectors(const ASpaceSectorMap* Sector) const;
+
+    /**
+     * Sectors whose grid coordinates are within CellRange steps on every axis
+     * Probes (2 * CellRange + 1)^3 cells; includes sectors at the coordinate itself
+     */
+    void GetSectorsNear(const FIntVector& GridCoordinates, int32 CellRange, TArray<ASpaceSectorMap*>& OutSectors) const;
+
+    /** Enable or disable the precomputed next-hop table (off by default; worth it for many GetNextSector calls) */
+    UFUNCTION(BlueprintCallable, Category="Sector Graph")
+    void SetNextHopTableEnabled(bool bEnabled) { Graph.SetNextHopTableEnabled(bEnabled); }
+
+    // ====================
+    // ROUTING
+    // ====================
+
+    /**
+     * Shortest route between two sectors
+     * @return Sectors from StartSector to EndSector inclusive, empty if either is unknown or unreachable
+     */
+    UFUNCTION(BlueprintCallable, Category="Sector Graph")
+    TArray<ASpaceSectorMap*> FindSectorPath(ASpaceSectorMap* StartSector, ASpaceSectorMap* EndSector) const;
+
+    /**
+     * Next sector on the shortest route toward a destination
+     * @return The next sector, Destination if already there, nullptr if unreachable
+     */
+    UFUNCTION(BlueprintCallable, Category="Sector Graph")
+    ASpaceSectorMap* GetNextSector(ASpaceSectorMap* FromSector, ASpaceSectorMap* Destination) const;
+
+    /** Underlying graph, for batched native queries */
+    const FSectorGraph& GetGraph() const { return Graph; }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FSectorRecord
+    {
+        FIntVector Coordinates = FIntVector::ZeroValue;
+        FVector Center = FVector::ZeroVector;
+        int32 Index = INDEX_NONE;
+    };
+
+    /** Register every sector already in the world, once (the first query may precede their BeginPlay) */
+    void SeedIfNeeded() const;
+
+    void AddToCell(ASpaceSectorMap* Sector, const FIntVector& Coordinates);
+    void RemoveFromCell(ASpaceSectorMap* Sector, const FIntVector& Coordinates);
+
+    FSectorGraph Graph;
+
+    /** Registered sectors; removal swaps the last one into the gap */
+    UPROPERTY()
+    TArray<TObjectPtr<ASpaceSectorMap>> Sectors;
+
+    TMap<const ASpaceSectorMap*, FSectorRecord> SectorRecords;
+
+    /** Grid coordinate -> sectors at it (more than one only for overlapping sectors) */
+    TMap<FIntVector, TArray<ASpaceSectorMap*, TInlineAllocator<1>>> SectorsByCell;
+
+    int32 RegistryVersion = 0;
+    bool bSeeded = false;
+};
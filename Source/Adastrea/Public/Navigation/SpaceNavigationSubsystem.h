@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "Navigation/NavigationOctree.h"
+#include "SpaceNavigationSubsystem.generated.h"
+
+/**
+ * Space Navigation Subsystem
+ *
+ * Owns the world's FNavigationOctree, built from registered static obstacles
+ * (stations and their modules, or any actor that calls RegisterObstacle).
+ * Each obstacle contributes its bounds and those of its attached actors,
+ * inflated by ObstacleClearance.
+ *
+ * The first query after obstacles changed gathers their boxes on the game
+ * thread and builds the new tree on a worker; queries keep using the
+ * previous tree until a later query finds the build finished and swaps it
+ * in. Only the very first build is waited for, since there is no older tree
+ * to answer with. Built trees are immutable and shared, so async queries
+ * keep using the tree they started with.
+ *
+ * Usage:
+ * - UNavigationComponent::FindPath3D / RequestPath3DAsync route through it
+ * - Call RequestPathAsync() from native code for worker-thread path queries
+ */
+UCLASS()
+class ADASTREA_API USpaceNavigationSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Called on the game thread with the found path (Start ... End), empty if none */
+    using FPathQueryCallback = TFunction<void(bool bPathFound, TArray<FVector>&& Path)>;
+
+    // ====================
+    // SUBSYSTEM LIFECYCLE
+    // ====================
+
+    virtual void Deinitialize() override;
+
+    // ====================
+    // OBSTACLES
+    // ====================
+
+    /** Add a static obstacle (no-op if already registered) */
+    UFUNCTION(BlueprintCallable, Category="Space Navigation")
+    void RegisterObstacle(AActor* Obstacle);
+
+    /** Remove an obstacle */
+    UFUNCTION(BlueprintCallable, Category="Space Navigation")
+    void UnregisterObstacle(AActor* Obstacle);
+
+    /** Start a rebuild on the next query (e.g. after modules were attached to a station) */
+    UFUNCTION(BlueprintCallable, Category="Space Navigation")
+    void MarkObstaclesDirty() { bOctreeDirty = true; }
+
+    /**
+     * Change how the tree is built
+     * @param InMinLeafSize Finest leaf edge length; smaller follows obstacles more closely but uses more memory
+     * @param InObstacleClearance Distance kept from every obstacle's bounds
+     */
+    UFUNCTION(BlueprintCallable, Category="Space Navigation")
+    void SetBuildSettings(float InMinLeafSize, float InObstacleClearance);
+
+    // ====================
+    // QUERIES
+    // ====================
+
+    /** Whether a straight segment stays clear of every obstacle */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category="Space Navigation")
+    bool IsSegmentClear(const FVector& Start, const FVector& End);
+
+    /** Find a path on the calling (game) thread */
+    bool FindPath(const FVector& Start, const FVector& End, TArray<FVector>& OutPath);
+
+    /**
+     * Find a path on a worker thread
+     * @param OnComplete Invoked on the game thread once the search finishes
+     */
+    void RequestPathAsync(const FVector& Start, const FVector& End, FPathQueryCallback&& OnComplete);
+
+    /** Newest built tree; starts a background rebuild if obstacles changed (game thread only) */
+    TSharedRef<const FNavigationOctree, ESPMode::ThreadSafe> GetOctree();
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /** Swap in a finished build, and start a new one if obstacles changed and none is running */
+    void UpdateOctree();
+
+    /** Gather obstacle boxes and build a tree from them on a worker */
+    void StartOctreeBuild();
+
+    /** Registered obstacle actors */
+    UPROPERTY()
+    TArray<TObjectPtr<AActor>> Obstacles;
+
+    TSharedPtr<const FNavigationOctree, ESPMode::ThreadSafe> Octree;
+
+    /** Tree being built by PendingBuild, swapped into Octree once complete */
+    TSharedPtr<FNavigationOctree, ESPMode::ThreadSafe> PendingOctree;
+    UE::Tasks::FTask PendingBuild;
+
+    float MinLeafSize = FNavigationOctree::DefaultMinLeafSize;
+    float ObstacleClearance = 1000.0f;
+    bool bOctreeDirty = true;
+};
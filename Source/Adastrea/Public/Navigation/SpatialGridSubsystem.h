@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Navigation/SpatialHashGrid.h"
+#include "SpatialGridSubsystem.generated.h"
+
+/**
+ * Spatial Grid Subsystem
+ *
+ * Keeps registered movable actors (ships, stations, station modules) in a
+ * sparse spatial hash grid so sector, radius and nearest-actor queries only
+ * touch nearby cells instead of iterating every actor in the world.
+ *
+ * Actors register on BeginPlay and unregister on EndPlay. Positions are
+ * updated from each actor's root component TransformUpdated event, so moving
+ * actors cost O(1) per move and static ones cost nothing.
+ *
+ * Usage:
+ * - ASpaceSectorMap::GetActorsInSector / GetActorCountInSector use it during play
+ *   for tracked classes and fall back to an actor scan for anything else
+ * - Call RegisterActor() from other actor types that should be queryable, and
+ *   AddTrackedClass() once every actor of the type registers
+ */
+UCLASS()
+class ADASTREA_API USpatialGridSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ====================
+    // SUBSYSTEM LIFECYCLE
+    // ====================
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // ====================
+    // REGISTRATION
+    // ====================
+
+    /** Start tracking an actor (no-op if already tracked) */
+    void RegisterActor(AActor* Actor);
+
+    /** Stop tracking an actor */
+    void UnregisterActor(AActor* Actor);
+
+    /**
+     * Declare that every actor of a class registers itself, so queries for it or a subclass can use the grid
+     * Ships, stations and station modules are declared on Initialize
+     */
+    void AddTrackedClass(TSubclassOf<AActor> ActorClass);
+
+    /** Whether the grid holds every actor of a class (false for nullptr, meaning all actors) */
+    bool IsTrackedClass(TSubclassOf<AActor> ActorClass) const;
+
+    /** Number of tracked actors */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category="Spatial Grid")
+    int32 GetTrackedActorCount() const { return Grid.Num(); }
+
+    /**
+     * Set the grid cell size and rehash tracked actors
+     * Cells around the typical query radius work best
+     */
+    UFUNCTION(BlueprintCallable, Category="Spatial Grid")
+    void SetCellSize(float InCellSize) { Grid.SetCellSize(InCellSize); }
+
+    // ====================
+    // QUERIES
+    // ====================
+
+    /**
+     * Get tracked actors inside a box
+     * @param Box World-space box (exclusive bounds, like FBox::IsInside)
+     * @param ActorClass Optional class filter
+     */
+    UFUNCTION(BlueprintCallable, Category="Spatial Grid")
+    TArray<AActor*> GetActorsInBox(const FBox& Box, TSubclassOf<AActor> ActorClass = nullptr) const;
+
+    /** Count tracked actors inside a box without building a list */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category="Spatial Grid")
+    int32 CountActorsInBox(const FBox& Box, TSubclassOf<AActor> ActorClass = nullptr) const;
+
+    /**
+     * Get tracked actors within a radius
+     * @param Center Query center
+     * @param Radius Query radius in Unreal units
+     * @param ActorClass Optional class filter
+     */
+    UFUNCTION(BlueprintCallable, Category="Spatial Grid")
+    TArray<AActor*> GetActorsInRadius(const FVector& Center, float Radius, TSubclassOf<AActor> ActorClass = nullptr) const;
+
+    /**
+     * Get the nearest tracked actors, closest first
+     * @param Location Query point
+     * @param Count Maximum number of actors to return
+     * @param ActorClass Optional class filter
+     * @param MaxDistance Ignore actors further than this (0 = no limit)
+     */
+    UFUNCTION(BlueprintCallable, Category="Spatial Grid")
+    TArray<AActor*> GetNearestActors(const FVector& Location, int32 Count, TSubclassOf<AActor> ActorClass = nullptr, float MaxDistance = 0.0f) const;
+
+    /** Underlying grid, for batched native queries */
+    const FSpatialHashGrid& GetGrid() const { return Grid; }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /** Root component moved: rehash its owner */
+    void HandleTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateFlags, ETeleportType Teleport);
+
+    FSpatialHashGrid Grid;
+
+    /** Classes whose actors all register themselves */
+    UPROPERTY()
+    TArray<TSubclassOf<AActor>> TrackedClasses;
+
+    /** Root component move subscriptions per tracked actor */
+    TMap<TWeakObjectPtr<AActor>, TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>> TransformHandles;
+};
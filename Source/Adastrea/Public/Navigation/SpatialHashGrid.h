@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+/**
+ * Spatial Hash Grid
+ *
+ * Sparse uniform grid of actor positions. Only occupied cells exist (hashed
+ * by integer cell coordinates), so the grid covers unbounded space at a cost
+ * proportional to the number of actors. Moving an actor is O(1) and only
+ * touches the cell lists when it crosses a cell boundary.
+ *
+ * Queries visit only the cells a shape overlaps. Cells fully inside a query
+ * box are taken wholesale without per-actor tests; when a box spans more
+ * cells than are occupied, the occupied cells are walked instead, so even
+ * sector-sized boxes cost at most one pass over occupied cells.
+ *
+ * Plain data structure: the owner keeps actor pointers valid (see
+ * USpatialGridSubsystem, which removes actors on EndPlay).
+ */
+class ADASTREA_API FSpatialHashGrid
+{
+public:
+    /** Default cell edge length (50 km), a 4 x 4 x 4 split of a sector */
+    static constexpr float DefaultCellSize = 5000000.0f;
+
+    explicit FSpatialHashGrid(float InCellSize = DefaultCellSize);
+
+    /** Change the cell size and rehash every actor */
+    void SetCellSize(float InCellSize);
+    float GetCellSize() const { return CellSize; }
+
+    /** Add an actor, or move it if already present */
+    void Update(AActor* Actor, const FVector& Location);
+
+    /** Remove an actor; returns false if it was not in the grid */
+    bool Remove(const AActor* Actor);
+
+    void Reset();
+
+    bool Contains(const AActor* Actor) const { return EntryByActor.Contains(Actor); }
+    int32 Num() const { return Entries.Num(); }
+    int32 GetOccupiedCellCount() const { return Cells.Num(); }
+
+    /** Cell coordinates containing a location */
+    FIntVector GetCell(const FVector& Location) const;
+
+    /**
+     * Actors whose location is inside a box
+     * @param Class Optional class filter (nullptr for every actor)
+     */
+    void QueryBox(const FBox& Box, UClass* Class, TArray<AActor*>& OutActors) const;
+
+    /** Number of actors inside a box, without building a list */
+    int32 CountInBox(const FBox& Box, UClass* Class) const;
+
+    /** Actors within a radius of a point */
+    void QueryRadius(const FVector& Center, float Radius, UClass* Class, TArray<AActor*>& OutActors) const;
+
+    /**
+     * K nearest actors to a point, closest first
+     * Searches outward one ring of cells at a time and stops once no closer actor can remain
+     * @param MaxDistance Ignore actors further than this (<= 0 for no limit)
+     */
+    void QueryNearest(const FVector& Location, int32 Count, UClass* Class, TArray<AActor*>& OutActors, float MaxDistance = 0.0f) const;
+
+    /** Memory used by the grid */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    struct FEntry
+    {
+        AActor* Actor = nullptr;
+        FVector Location = FVector::ZeroVector;
+        FIntVector Cell = FIntVector::ZeroValue;
+
+        /** Index of this entry in its cell's list */
+        int32 IndexInCell = INDEX_NONE;
+    };
+
+    /** Link an entry into the cell at its current Cell coordinates */
+    void AddToCell(int32 EntryIndex);
+
+    /** Unlink an entry from its cell, dropping the cell when it empties */
+    void RemoveFromCell(int32 EntryIndex);
+
+    /** World-space bounds of a cell */
+    FBox GetCellBounds(const FIntVector& Cell) const;
+
+    static bool PassesFilter(const AActor* Actor, UClass* Class);
+
+    /**
+     * Call Visit(CellEntries, bFullyInside) for every occupied cell overlapping a box
+     * bFullyInside means every entry of the cell is inside the box
+     */
+    template<typename VisitorType>
+    void ForEachCellInBox(const FBox& Box, VisitorType&& Visit) const;
+
+    float CellSize;
+    float InvCellSize;
+
+    /** Dense entries; removal swaps the last entry into the gap */
+    TArray<FEntry> Entries;
+    TMap<const AActor*, int32> EntryByActor;
+
+    /** Occupied cells -> entry indices */
+    TMap<FIntVector, TArray<int32>> Cells;
+};
@@ -145,6 +145,91 @@ class ADASTREA_API UPerformanceBenchmarkLibrary : public UBlueprintFunctionLibra
         int32 ModulesPerStation = 10
     );
 
+    //================================================================================
+    // TRADING SYSTEM BENCHMARKS
+    //================================================================================
+
+    /**
+     * Benchmark the economy tick
+     * Compares the per-entry market update loop against the batched
+     * structure-of-arrays kernel at 10k, 100k and 1M inventory entries
+     *
+     * @param WorldContextObject World context
+     * @param ItemsPerMarket Inventory entries per generated market
+     * @param Iterations Economy ticks measured per entry count
+     * @return Comparison results
+     */
+    UFUNCTION(BlueprintCallable, Category="Performance|Benchmarks|Trading",
+        meta=(WorldContext="WorldContextObject"))
+    static FString BenchmarkEconomySimulation(
+        UObject* WorldContextObject,
+        int32 ItemsPerMarket = 500,
+        int32 Iterations = 10
+    );
+
+    /**
+     * Benchmark economy catch-up (time skip / offline progression)
+     * Simulates the given number of game days with fixed 5-minute steps, once
+     * stepping one timer update at a time and once as a single catch-up
+     * batch, and checks both produce bit-identical market state
+     *
+     * @param WorldContextObject World context
+     * @param NumMarkets Number of generated markets
+     * @param ItemsPerMarket Inventory entries per generated market
+     * @param Days Game days to simulate
+     * @param Seed Seed for the generated market state
+     * @return Comparison results
+     */
+    UFUNCTION(BlueprintCallable, Category="Performance|Benchmarks|Trading",
+        meta=(WorldContext="WorldContextObject"))
+    static FString BenchmarkEconomyCatchUp(
+        UObject* WorldContextObject,
+        int32 NumMarkets = 200,
+        int32 ItemsPerMarket = 50,
+        int32 Days = 30,
+        int32 Seed = 1337
+    );
+
+    /**
+     * Benchmark AI trade route search
+     * Compares each trader running its own markets x markets x items search
+     * against shared top-K queries on the incremental arbitrage index
+     *
+     * @param WorldContextObject World context
+     * @param NumMarkets Number of generated markets
+     * @param NumItems Items stocked by every market
+     * @param NumTraders Number of traders searching for routes
+     * @return Comparison results
+     */
+    UFUNCTION(BlueprintCallable, Category="Performance|Benchmarks|Trading",
+        meta=(WorldContext="WorldContextObject"))
+    static FString BenchmarkTradeRouteSearch(
+        UObject* WorldContextObject,
+        int32 NumMarkets = 200,
+        int32 NumItems = 50,
+        int32 NumTraders = 10
+    );
+
+    /**
+     * Benchmark multi-stop contract tour planning
+     * Plans exclusive pickup/delivery tours for every trader over one contract
+     * board and compares tour time against serving the same contracts one at a time
+     *
+     * @param WorldContextObject World context
+     * @param NumContracts Number of generated open contracts
+     * @param NumTraders Number of traders splitting the board
+     * @param Seed Random seed for contracts and traders
+     * @return Timing and tour quality results
+     */
+    UFUNCTION(BlueprintCallable, Category="Performance|Benchmarks|Trading",
+        meta=(WorldContext="WorldContextObject"))
+    static FString BenchmarkContractRoutePlanning(
+        UObject* WorldContextObject,
+        int32 NumContracts = 100,
+        int32 NumTraders = 50,
+        int32 Seed = 1337
+    );
+
     //================================================================================
     // LOD SYSTEM BENCHMARKS
     //================================================================================
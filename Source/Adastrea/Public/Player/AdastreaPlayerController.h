@@ -106,17 +106,11 @@ class ADASTREA_API AAdastreaPlayerController : public APlayerController
 	/**
 	 * Maximum distance to interact with stations for trading (in world units)
 	 * When the player is within this range of a station, "Press F to Trade" prompt appears
+	 * Runtime changes apply the next time a spaceship is possessed
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Player|Trading", meta=(ClampMin=100.0f))
 	float TradingInteractionRadius = 2000.0f;
 
-	/**
-	 * How often to check for nearby stations (in seconds)
-	 * Lower values = more responsive but higher CPU cost
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Player|Trading", meta=(ClampMin=0.1f, ClampMax=5.0f))
-	float StationCheckInterval = 0.5f;
-
 	// ====================
 	// HUD Configuration
 	// ====================
@@ -555,11 +549,20 @@ class ADASTREA_API AAdastreaPlayerController : public APlayerController
 	void HideStationManagement();
 
 	/**
-	 * Timer callback to check for nearby tradable stations
-	 * Called periodically based on StationCheckInterval
+	 * Sync the nearby tradable station with the station registry and notify on change
+	 * Called when the registry reports a station entering/leaving range or the pawn changes
 	 */
 	void CheckForNearbyTradableStations();
 
+	/** Watch the controlled spaceship for stations within TradingInteractionRadius */
+	void WatchControlledPawnForStations();
+
+	UFUNCTION()
+	void HandlePossessedPawnChanged(APawn* OldPawn, APawn* NewPawn);
+
+	UFUNCTION()
+	void HandleStationRangeChanged(AActor* Watcher, ASpaceStation* Station);
+
 private:
 	/** The currently active station editor widget instance */
 	UPROPERTY()
@@ -590,6 +593,6 @@ class ADASTREA_API AAdastreaPlayerController : public APlayerController
 	/** Whether we were near a tradable station on the last check */
 	bool bWasNearTradableStation;
 
-	/** Timer handle for periodic station proximity checks */
-	FTimerHandle StationCheckTimerHandle;
+	/** Pawn currently watched by the station registry */
+	TWeakObjectPtr<APawn> StationWatchedPawn;
 };
@@ -115,8 +115,17 @@ class ADASTREA_API ASpaceSectorMap : public AActor
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Sector")
 	FIntVector GetGridCoordinates() const;
 
+	/**
+	 * Get the grid coordinates of the cell containing a world position
+	 * @param WorldLocation Position in world space
+	 * @return Grid coordinates based on sector size
+	 */
+	static FIntVector WorldToGridCoordinates(const FVector& WorldLocation);
+
 	/**
 	 * Get all actors within this sector
+	 * During play, classes tracked by USpatialGridSubsystem (ships, stations, modules) are
+	 * answered from its grid; other classes, nullptr, and editor worlds scan the world's actors
 	 * @param ActorClass Optional class filter (nullptr for all actors)
 	 * @return Array of actors within sector bounds
 	 */
@@ -125,7 +134,7 @@ class ADASTREA_API ASpaceSectorMap : public AActor
 
 	/**
 	 * Get count of actors in sector
-	 * Optimized version that doesn't return actor array
+	 * Optimized version that doesn't return actor array; same actor set as GetActorsInSector
 	 * @param ActorClass Optional class filter
 	 * @return Number of actors in sector
 	 */
@@ -134,6 +143,7 @@ class ADASTREA_API ASpaceSectorMap : public AActor
 
 	/**
 	 * Find neighboring sectors (adjacent grid positions)
+	 * Cached; refreshed when USectorGraphSubsystem reports any sector added, moved or removed
 	 * @return Array of sectors adjacent to this one
 	 */
 	UFUNCTION(BlueprintCallable, Category="Sector")
@@ -164,6 +174,8 @@ class ADASTREA_API ASpaceSectorMap : public AActor
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Destroyed() override;
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -179,6 +191,9 @@ class ADASTREA_API ASpaceSectorMap : public AActor
 	UPROPERTY()
 	bool bNeighborCacheDirty;
 
+	/** Sector registry version the neighbor cache was built against */
+	int32 CachedRegistryVersion = INDEX_NONE;
+
 	/** Refresh the neighbor cache */
 	void RefreshNeighborCache();
 };
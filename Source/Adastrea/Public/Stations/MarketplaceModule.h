@@ -17,6 +17,7 @@
  * - Configurable market data asset for inventory and pricing
  * - Can be opened/closed for trading
  * - Supports multiple marketplace types per station
+ * - Registers its world position with UTradeArbitrageSubsystem for route distances
  * 
  * Power Consumption: 40 units
  * Module Group: Public
@@ -68,4 +69,9 @@ class ADASTREA_API AMarketplaceModule : public ASpaceStationModule
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Marketplace")
 	bool IsAvailableForTrading() const { return bIsOpen && MarketDataAsset != nullptr; }
+
+protected:
+	// Bind the market to this module's world position for trade route distances
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 };
@@ -346,6 +346,10 @@ class ADASTREA_API ASpaceStation : public AActor, public IDamageable, public ITa
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /** Rebuild navigation around this station after its module layout changed */
+    void MarkNavigationObstacleDirty() const;
 
     // REMOVED: OwningFaction - faction system removed per Trade Simulator MVP
 
@@ -115,6 +115,9 @@ class ADASTREA_API ASpaceStationModule : public AActor, public IDamageable, publ
     virtual bool IsHostileToActor_Implementation(AActor* Observer) const override;
 
 protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /** Static mesh component for visual representation */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components")
     TObjectPtr<UStaticMeshComponent> MeshComponent;
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Station KD-Tree
+ *
+ * Static 3D KD-tree over a set of points (station locations). Stations do not
+ * move, so the tree is built once from a snapshot of positions and rebuilt
+ * only when the set changes. Nearest and radius queries are O(log N) for
+ * well-spread points instead of a scan over every station.
+ *
+ * The tree is stored implicitly in one array: each node is the median of its
+ * range and its children are the halves on either side, so there are no
+ * per-node allocations. Results are indices into the array passed to Build().
+ */
+class ADASTREA_API FStationKDTree
+{
+public:
+    /** Build the tree from point locations (replaces any previous tree) */
+    void Build(TConstArrayView<FVector> Points);
+
+    void Reset();
+
+    int32 Num() const { return Nodes.Num(); }
+    bool IsEmpty() const { return Nodes.Num() == 0; }
+
+    /**
+     * Index of the point nearest to a location
+     * @param MaxRadius Ignore points at or beyond this distance (<= 0 for no limit)
+     * @param OutDistanceSquared Squared distance to the point found
+     * @return Point index, or INDEX_NONE if none qualifies
+     */
+    int32 FindNearest(const FVector& Location, float MaxRadius, double* OutDistanceSquared = nullptr) const;
+
+    /** Indices of every point strictly within a radius of a location (unordered) */
+    void FindInRadius(const FVector& Location, float Radius, TArray<int32>& OutIndices) const;
+
+private:
+    struct FNode
+    {
+        FVector Location = FVector::ZeroVector;
+        int32 PointIndex = INDEX_NONE;
+
+        /** Split axis (0 = X, 1 = Y, 2 = Z) */
+        uint8 Axis = 0;
+    };
+
+    /** Arrange Nodes[Begin, End) so its median splits along the widest axis, then recurse */
+    void BuildRange(int32 Begin, int32 End);
+
+    void FindNearestInRange(int32 Begin, int32 End, const FVector& Location, double& BestDistanceSquared, int32& BestIndex) const;
+
+    void FindInRadiusRange(int32 Begin, int32 End, const FVector& Location, double RadiusSquared, TArray<int32>& OutIndices) const;
+
+    TArray<FNode> Nodes;
+};
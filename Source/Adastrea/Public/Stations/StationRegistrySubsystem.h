@@ -0,0 +1,135 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Stations/StationKDTree.h"
+#include "StationRegistrySubsystem.generated.h"
+
+class ASpaceStation;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStationRangeEvent, AActor*, Watcher, ASpaceStation*, Station);
+
+/**
+ * Station Registry Subsystem
+ *
+ * Tracks every space station in the world in a static KD-tree for fast
+ * nearest-station and radius lookups. Stations register on BeginPlay and
+ * unregister on EndPlay; the tree is rebuilt lazily on the next query after
+ * a station spawns or is destroyed, never per frame.
+ *
+ * Proximity is push-based: actors (e.g. the player's ship) can be watched
+ * with a radius, and the registry re-checks them only when they move or the
+ * station set changes, firing OnStationEnteredRange / OnStationExitedRange
+ * when the nearest station within that radius changes.
+ *
+ * Stations are assumed static once registered.
+ */
+UCLASS()
+class ADASTREA_API UStationRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ====================
+    // SUBSYSTEM LIFECYCLE
+    // ====================
+
+    virtual void Deinitialize() override;
+
+    // ====================
+    // REGISTRATION
+    // ====================
+
+    /** Add a station to the registry (no-op if already registered) */
+    void RegisterStation(ASpaceStation* Station);
+
+    /** Remove a station; watchers currently in its range get an exit event */
+    void UnregisterStation(ASpaceStation* Station);
+
+    /** Number of registered stations */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Registry")
+    int32 GetStationCount() const { return Stations.Num(); }
+
+    // ====================
+    // QUERIES
+    // ====================
+
+    /**
+     * Nearest registered station to a location
+     * @param Location Query point
+     * @param MaxRadius Ignore stations at or beyond this distance (0 = no limit)
+     * @return The nearest station, or nullptr if none qualifies
+     */
+    UFUNCTION(BlueprintCallable, Category="Station Registry")
+    ASpaceStation* FindNearestStation(const FVector& Location, float MaxRadius = 0.0f) const;
+
+    /** Registered stations within a radius (unordered) */
+    UFUNCTION(BlueprintCallable, Category="Station Registry")
+    TArray<ASpaceStation*> GetStationsInRadius(const FVector& Location, float Radius) const;
+
+    // ====================
+    // PROXIMITY EVENTS
+    // ====================
+
+    /**
+     * Start watching an actor for stations coming within a radius
+     * Re-watching an actor updates its radius
+     */
+    UFUNCTION(BlueprintCallable, Category="Station Registry")
+    void WatchProximity(AActor* Watcher, float Radius);
+
+    /** Stop watching an actor (no exit event is fired) */
+    UFUNCTION(BlueprintCallable, Category="Station Registry")
+    void StopWatchingProximity(AActor* Watcher);
+
+    /** Nearest station currently within a watched actor's radius, or nullptr */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Registry")
+    ASpaceStation* GetStationInRange(AActor* Watcher) const;
+
+    /** A station became the nearest one within a watcher's radius */
+    UPROPERTY(BlueprintAssignable, Category="Station Registry")
+    FOnStationRangeEvent OnStationEnteredRange;
+
+    /** A watcher's in-range station left its radius or was replaced by a closer one */
+    UPROPERTY(BlueprintAssignable, Category="Station Registry")
+    FOnStationRangeEvent OnStationExitedRange;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FProximityWatch
+    {
+        TWeakObjectPtr<AActor> Watcher;
+        TWeakObjectPtr<USceneComponent> Root;
+        FDelegateHandle TransformHandle;
+        float Radius = 0.0f;
+        TWeakObjectPtr<ASpaceStation> StationInRange;
+    };
+
+    /** Rebuild the KD-tree if the station set changed since the last build */
+    void RebuildTreeIfDirty() const;
+
+    /** Re-query a watch and fire enter/exit events if its station changed */
+    void RefreshWatch(int32 WatchIndex);
+
+    /** Re-check every watch once the current frame's spawns/destroys are done */
+    void ScheduleRefreshAllWatches();
+    void RefreshAllWatches();
+
+    int32 FindWatchIndex(const AActor* Watcher) const;
+
+    /** Watched root component moved */
+    void HandleWatcherMoved(USceneComponent* Component, EUpdateTransformFlags UpdateFlags, ETeleportType Teleport);
+
+    UPROPERTY()
+    TArray<TObjectPtr<ASpaceStation>> Stations;
+
+    /** Tree over station locations; results index into Stations */
+    mutable FStationKDTree Tree;
+    mutable bool bTreeDirty = false;
+
+    TArray<FProximityWatch> Watches;
+    bool bRefreshScheduled = false;
+};
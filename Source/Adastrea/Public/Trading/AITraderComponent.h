@@ -2,12 +2,17 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Trading/CargoHold.h"
+#include "Trading/ContractRoutePlanner.h"
 #include "AITraderComponent.generated.h"
 
 // Forward declarations
 class UMarketDataAsset;
 class UTradeItemDataAsset;
 class UTradeContractDataAsset;
+class UTradeArbitrageSubsystem;
+class UEconomyManager;
+struct FMarketStateTable;
 // REMOVED: UFactionDataAsset - faction system removed per Trade Simulator MVP
 
 /**
@@ -119,6 +124,80 @@ struct FAITraderInventory
 	{}
 };
 
+/**
+ * Buy/sell quote for one item at one market
+ */
+struct FAITraderItemQuote
+{
+	float BuyPrice = 0.0f;
+	float SellPrice = 0.0f;
+	bool bInStock = false;
+};
+
+/**
+ * Read-only inputs for AI trader decisions
+ *
+ * Market quotes are captured on the game thread before decisions run, so
+ * EvaluateDecisions never touches market caches or Blueprint price events
+ * and can be called for many traders in parallel.
+ */
+struct ADASTREA_API FAITraderDecisionContext
+{
+	/** Shared route index and travel distances (nullptr if unavailable) */
+	const UTradeArbitrageSubsystem* Arbitrage = nullptr;
+
+	/** Live market state to capture quotes from (nullptr prices from market templates) */
+	const FMarketStateTable* MarketStates = nullptr;
+
+	/**
+	 * Whether decisions may read live market prices (local route search fallback)
+	 * Must be false when decisions run off the game thread
+	 */
+	bool bAllowGameThreadReads = true;
+
+	/** Capture quotes for every listed item of a market (game thread only, no-op if already captured) */
+	void CaptureMarket(const UMarketDataAsset* Market);
+
+	/** Captured quote, or nullptr if the market or item was not captured */
+	const FAITraderItemQuote* FindQuote(const UMarketDataAsset* Market, const UTradeItemDataAsset* Item) const;
+
+	/** Drop all captured quotes */
+	void Reset();
+
+private:
+	TMap<const UMarketDataAsset*, TMap<const UTradeItemDataAsset*, FAITraderItemQuote>> Quotes;
+};
+
+/**
+ * A trade an AI trader wants to execute at its current market
+ */
+struct FAITradeIntent
+{
+	UTradeItemDataAsset* TradeItem = nullptr;
+	int32 Quantity = 0;
+	bool bIsBuying = false;
+};
+
+/**
+ * Result of one AI trader decision pass, applied on the game thread
+ */
+struct FAITraderDecision
+{
+	/** Whether ActiveRoutes should be replaced with Routes */
+	bool bUpdateRoutes = false;
+	TArray<FTradeRoute> Routes;
+
+	/** Trades in execution order (sells before buys) */
+	TArray<FAITradeIntent> Intents;
+
+	void Reset()
+	{
+		bUpdateRoutes = false;
+		Routes.Reset();
+		Intents.Reset();
+	}
+};
+
 /**
  * AI Trader Component
  * Handles automated trading, arbitrage, market manipulation, and route planning
@@ -150,10 +229,18 @@ class ADASTREA_API UAITraderComponent : public UActorComponent
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AI Trader|Config", meta=(ClampMin="0"))
 	float CargoCapacity;
 
-	// Average travel speed for route planning
+	// Maximum cargo mass (0 = no mass limit)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AI Trader|Config", meta=(ClampMin="0"))
+	float CargoMassCapacity;
+
+	// Average travel speed for route planning (Unreal units per second)
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AI Trader|Config", meta=(ClampMin="0"))
 	float TravelSpeed;
 
+	// Maximum travel distance for a single trade route (0 = unlimited; unreachable markets are always skipped)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AI Trader|Config", meta=(ClampMin="0"))
+	float MaxRouteDistance;
+
 	// Trading skill level (1-10, affects decisions)
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AI Trader|Config", meta=(ClampMin="1", ClampMax="10"))
 	int32 TradingSkill;
@@ -190,14 +277,22 @@ class ADASTREA_API UAITraderComponent : public UActorComponent
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AI Trader|Behavior", meta=(ClampMin="1"))
 	int32 TradeFrequency;
 
+	// Whether decisions are batched by UAITraderSchedulerSubsystem instead of this component's own tick
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AI Trader|Behavior")
+	bool bUseTraderScheduler;
+
 	// ====================
 	// TRADER STATE
 	// ====================
 
-	// Current inventory
-	UPROPERTY(BlueprintReadWrite, Category="AI Trader|State")
+	// Current inventory (one lot per purchase; read-only so changes go through ExecuteTrade and keep CargoHold in sync)
+	UPROPERTY(BlueprintReadOnly, Category="AI Trader|State")
 	TArray<FAITraderInventory> Inventory;
 
+	// Per-item totals of Inventory for O(1) cargo space queries, rebuilt after load
+	UPROPERTY(Transient)
+	FCargoHold CargoHold;
+
 	// Known markets
 	UPROPERTY(BlueprintReadWrite, Category="AI Trader|State")
 	TArray<UMarketDataAsset*> KnownMarkets;
@@ -253,8 +348,29 @@ class ADASTREA_API UAITraderComponent : public UActorComponent
 	UFUNCTION(BlueprintCallable, Category="AI Trader")
 	void UpdateTrader(float DeltaTime);
 
+	/**
+	 * Seconds between decision passes, derived from TradeFrequency
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="AI Trader")
+	float GetUpdateInterval() const;
+
+	/**
+	 * Decision phase: pick routes and trade intents without changing any state
+	 * Safe to call from worker threads when Context.bAllowGameThreadReads is false
+	 * @param Context Captured quotes for this trader's current market
+	 * @param OutDecision Routes and intents to apply
+	 */
+	void EvaluateDecisions(const FAITraderDecisionContext& Context, FAITraderDecision& OutDecision) const;
+
+	/**
+	 * Apply phase: store routes and execute intents in order (game thread only)
+	 */
+	void ApplyDecision(const FAITraderDecision& Decision);
+
 	/**
 	 * Execute a trade at current location
+	 * At a registered market the trade is recorded with the economy manager and
+	 * the quantity is capped by the market's stock (buying) or free capacity (selling).
 	 * @param TradeItem Item to trade
 	 * @param Quantity Quantity to trade
 	 * @param bIsBuying True if buying, false if selling
@@ -266,11 +382,22 @@ class ADASTREA_API UAITraderComponent : public UActorComponent
 	/**
 	 * Travel to another market
 	 * @param DestinationMarket Market to travel to
-	 * @return Estimated travel time
+	 * @return Estimated travel time, or -1 if no sector path leads there
 	 */
 	UFUNCTION(BlueprintCallable, Category="AI Trader|Movement")
 	float TravelToMarket(UMarketDataAsset* DestinationMarket);
 
+	/**
+	 * Plan a multi-stop pickup/delivery tour over open contracts and accept its contracts
+	 * Uses the current location, speed and free cargo volume and mass; travel follows the market
+	 * travel matrix. The trader then visits one tour stop per update and completes each contract
+	 * at its delivery stop. Does nothing while a previous tour still has stops left.
+	 * @param OpenContracts Contracts on offer
+	 * @return Number of contracts accepted
+	 */
+	UFUNCTION(BlueprintCallable, Category="AI Trader|Contracts")
+	int32 AcceptContractTour(const TArray<UTradeContractDataAsset*>& OpenContracts);
+
 	/**
 	 * Get current cargo space usage
 	 * @return Percentage of cargo space used (0.0 to 1.0)
@@ -304,15 +431,45 @@ class ADASTREA_API UAITraderComponent : public UActorComponent
 private:
 	/**
 	 * Find best trade routes between known markets
+	 * Queries the shared UTradeArbitrageSubsystem when available,
+	 * otherwise falls back to a local search over known markets
+	 * Internal AI logic - not exposed to Blueprints
+	 */
+	TArray<FTradeRoute> FindBestTradeRoutes(const FAITraderDecisionContext& Context, int32 MaxRoutes = 5) const;
+
+	/**
+	 * Exhaustive search over every pair of known markets (O(markets^2 x items))
+	 * Internal AI logic - not exposed to Blueprints
+	 */
+	TArray<FTradeRoute> FindBestTradeRoutesLocal(int32 MaxRoutes) const;
+
+	/**
+	 * Distance between two markets used for travel time estimates
+	 * Reads the shared travel matrix; 0 when market positions are unknown
+	 * Internal AI logic - not exposed to Blueprints
+	 */
+	float GetMarketDistance(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination) const;
+
+	/**
+	 * Whether a route is reachable and within MaxRouteDistance
 	 * Internal AI logic - not exposed to Blueprints
 	 */
-	TArray<FTradeRoute> FindBestTradeRoutes(int32 MaxRoutes = 5);
+	bool IsRouteInRange(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination) const;
+
+	/** Shared arbitrage/travel service for this world, if any */
+	UTradeArbitrageSubsystem* GetArbitrageSubsystem() const;
+
+	/** Economy manager of this game instance, if any */
+	UEconomyManager* GetEconomyManager() const;
+
+	/** Live market state owned by the economy manager, if any */
+	const FMarketStateTable* GetMarketStates() const;
 
 	/**
 	 * Calculate arbitrage opportunities
 	 * Internal AI logic - not exposed to Blueprints
 	 */
-	FTradeRoute CalculateArbitrageOpportunity(UTradeItemDataAsset* TradeItem);
+	FTradeRoute CalculateArbitrageOpportunity(UTradeItemDataAsset* TradeItem) const;
 
 	/**
 	 * Evaluate whether to accept a contract
@@ -326,6 +483,21 @@ class ADASTREA_API UAITraderComponent : public UActorComponent
 	 */
 	bool AcceptContract(UTradeContractDataAsset* Contract);
 
+	/**
+	 * Accept a contract without re-evaluating it, starting its time limit at the economy's game time
+	 * Internal AI logic - not exposed to Blueprints
+	 */
+	bool ClaimContract(UTradeContractDataAsset* Contract);
+
+	/**
+	 * Travel to the next stop of the contract tour and serve it
+	 * Internal AI logic - not exposed to Blueprints
+	 */
+	void AdvanceContractTour();
+
+	/** Economy game time in hours, 0 without an economy manager */
+	float GetGameTime() const;
+
 	/**
 	 * Attempt market manipulation (buy/sell to influence prices)
 	 * Internal AI logic - not exposed to Blueprints
@@ -384,20 +556,33 @@ class ADASTREA_API UAITraderComponent : public UActorComponent
 	UFUNCTION(BlueprintNativeEvent, Category="AI Trader|Events")
 	void OnContractCompleted(UTradeContractDataAsset* Contract, int32 Profit);
 
+	virtual void PostLoad() override;
+	virtual void PostDuplicate(bool bDuplicateForPIE) override;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
-	// Internal trade decision making
-	void MakeTradeDecisions();
+	// Rebuild CargoHold's per-item totals from the Inventory lots
+	void RebuildCargoHold();
+
+	// Internal trade decision making (buy intents for routes from the current market)
+	void MakeTradeDecisions(const FAITraderDecisionContext& Context, FAITraderDecision& OutDecision) const;
 
 	// Internal route optimization
-	void OptimizeTradeRoutes();
+	void OptimizeTradeRoutes(const FAITraderDecisionContext& Context, FAITraderDecision& OutDecision) const;
 
-	// Internal inventory management
-	void ManageInventory();
+	// Internal inventory management (sell intents for cargo that is profitable here)
+	void ManageInventory(const FAITraderDecisionContext& Context, FAITraderDecision& OutDecision) const;
 
 	// Update interval timer
 	float UpdateTimer;
+
+	// Contract tour being followed; its contracts are kept alive by ActiveContracts
+	FContractTour ContractTour;
+
+	// Index of the next tour stop to visit
+	int32 NextTourStop;
 };
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Trading/AITraderComponent.h"
+#include "AITraderSchedulerSubsystem.generated.h"
+
+/**
+ * AI Trader Scheduler Subsystem
+ *
+ * Batches decision updates for every registered AI trader under a per-frame
+ * time budget, instead of each UAITraderComponent ticking on its own.
+ *
+ * Each frame the scheduler walks traders round-robin from where the previous
+ * frame stopped and collects those whose update interval has elapsed into
+ * batches. For each batch it:
+ * 1. Captures quotes for the traders' current markets (game thread)
+ * 2. Runs UAITraderComponent::EvaluateDecisions for all traders with ParallelFor
+ *    (read-only: captured quotes, the arbitrage index and the travel matrix)
+ * 3. Applies the resulting routes and ExecuteTrade intents serially, in the
+ *    round-robin order they were collected (starting at the frame's cursor),
+ *    so results do not depend on thread timing
+ *
+ * Once the frame budget is spent, the remaining due traders roll over to
+ * the next frame.
+ *
+ * Usage:
+ * - Traders register themselves on BeginPlay when bUseTraderScheduler is set
+ * - Tune with SetFrameBudgetMs() / SetBatchSize()
+ *
+ * Integration:
+ * - Parallel evaluation needs UTradeArbitrageSubsystem to be tracking markets;
+ *   otherwise batches are evaluated on the game thread with the local route search
+ */
+UCLASS()
+class ADASTREA_API UAITraderSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UAITraderSchedulerSubsystem();
+
+	// ====================
+	// SUBSYSTEM LIFECYCLE
+	// ====================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ====================
+	// REGISTRATION
+	// ====================
+
+	/** Start scheduling a trader (no-op if already registered) */
+	void RegisterTrader(UAITraderComponent* Trader);
+
+	/** Stop scheduling a trader (safe to call while a frame is being processed) */
+	void UnregisterTrader(UAITraderComponent* Trader);
+
+	/** Number of registered traders */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Trading|AI Scheduler")
+	int32 GetTraderCount() const { return Traders.Num(); }
+
+	// ====================
+	// BUDGET
+	// ====================
+
+	/**
+	 * Set the per-frame time budget
+	 * @param InFrameBudgetMs Milliseconds per frame; at least one batch always runs
+	 */
+	UFUNCTION(BlueprintCallable, Category="Trading|AI Scheduler")
+	void SetFrameBudgetMs(float InFrameBudgetMs) { FrameBudgetMs = FMath::Max(0.0f, InFrameBudgetMs); }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Trading|AI Scheduler")
+	float GetFrameBudgetMs() const { return FrameBudgetMs; }
+
+	/**
+	 * Set the number of traders evaluated per parallel batch
+	 * Smaller batches follow the budget more closely, larger ones parallelize better
+	 */
+	UFUNCTION(BlueprintCallable, Category="Trading|AI Scheduler")
+	void SetBatchSize(int32 InBatchSize) { BatchSize = FMath::Max(1, InBatchSize); }
+
+	/** Evaluate decisions on worker threads (disable to debug on the game thread) */
+	UFUNCTION(BlueprintCallable, Category="Trading|AI Scheduler")
+	void SetParallelEvaluation(bool bEnabled) { bParallelEvaluation = bEnabled; }
+
+	// ====================
+	// STATISTICS
+	// ====================
+
+	/** Traders updated last frame */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Trading|AI Scheduler")
+	int32 GetLastFrameUpdateCount() const { return LastFrameUpdateCount; }
+
+	/** Time spent last frame in milliseconds */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Trading|AI Scheduler")
+	float GetLastFrameTimeMs() const { return LastFrameTimeMs; }
+
+	/** Whether last frame stopped on the budget with traders left to scan */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Trading|AI Scheduler")
+	bool DidLastFrameRollOver() const { return bLastFrameRolledOver; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Evaluate and apply one batch of trader indices */
+	void ProcessBatch(double Now, bool bParallel);
+
+	/** Remove traders unregistered during processing */
+	void CompactTraders();
+
+	/** Registered traders in registration order (nullptr while pending removal) */
+	UPROPERTY()
+	TArray<UAITraderComponent*> Traders;
+
+	/** World time at which each trader is next due (parallel to Traders) */
+	TArray<double> NextUpdateTimes;
+
+	/** Round-robin position where the next frame resumes */
+	int32 Cursor;
+
+	float FrameBudgetMs;
+	int32 BatchSize;
+	bool bParallelEvaluation;
+
+	/** Set while Tick is running; unregistration is deferred until it ends */
+	bool bProcessing;
+	bool bNeedsCompaction;
+
+	// Per-frame scratch (kept to avoid reallocations)
+	FAITraderDecisionContext Context;
+	TArray<int32> Batch;
+	TArray<FAITraderDecision> Decisions;
+
+	// Statistics
+	int32 LastFrameUpdateCount;
+	float LastFrameTimeMs;
+	bool bLastFrameRolledOver;
+};
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Trading/CargoHold.h"
 #include "CargoComponent.generated.h"
 
 // Forward declarations
@@ -59,16 +60,23 @@ class ADASTREA_API UCargoComponent : public UActorComponent
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cargo", meta=(ClampMin="1"))
 	float CargoCapacity;
 
-	// Current cargo inventory
+	// Current cargo inventory (one entry per item, in the same order as CargoHold's slots)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Cargo")
 	TArray<FCargoEntry> CargoInventory;
 
+	// Index and running volume/mass totals of CargoInventory, rebuilt after load
+	UPROPERTY(Transient)
+	FCargoHold CargoHold;
+
 	// ====================
 	// CONSTRUCTOR
 	// ====================
 
 	UCargoComponent();
 
+	virtual void PostLoad() override;
+	virtual void PostDuplicate(bool bDuplicateForPIE) override;
+
 	// ====================
 	// CARGO OPERATIONS
 	// ====================
@@ -117,6 +125,28 @@ class ADASTREA_API UCargoComponent : public UActorComponent
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Cargo|Queries")
 	bool HasSpaceFor(UTradeItemDataAsset* Item, int32 Quantity) const;
 
+	/**
+	 * Check if cargo has space for several items at once
+	 * @param Items Items and quantities to add together (e.g. a trade cart)
+	 * @return True if all of them fit
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Cargo|Queries")
+	bool HasSpaceForAll(const TMap<UTradeItemDataAsset*, int32>& Items) const;
+
+	/**
+	 * Get used cargo volume
+	 * @return Volume taken by cargo
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Cargo|Queries")
+	float GetUsedCargoSpace() const { return CargoHold.GetUsedVolume(); }
+
+	/**
+	 * Get total cargo mass
+	 * @return Mass of all cargo
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Cargo|Queries")
+	float GetCargoMass() const { return CargoHold.GetUsedMass(); }
+
 	/**
 	 * Get quantity of specific item in cargo
 	 * @param Item The item to check
@@ -152,6 +182,6 @@ class ADASTREA_API UCargoComponent : public UActorComponent
 	FOnCargoSpaceChanged OnCargoSpaceChanged;
 
 private:
-	// Find cargo entry index for item
-	int32 FindCargoEntryIndex(UTradeItemDataAsset* Item) const;
+	/** Merge and compact CargoInventory and rebuild CargoHold from it */
+	void RebuildCargoHold();
 };
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CargoHold.generated.h"
+
+// Forward declarations
+class UTradeItemDataAsset;
+
+/**
+ * Cargo Hold
+ *
+ * Item quantities stored as parallel arrays (one slot per distinct item)
+ * with an item -> slot hash and running volume/mass totals. Per-unit volume
+ * and mass are cached when a slot is created, so Add/Remove/GetQuantity and
+ * every capacity query are O(1) and never walk the hold or dereference item
+ * assets. Shared by UCargoComponent and UAITraderComponent.
+ *
+ * Slot order is not stable: removing an item's last unit moves the last
+ * slot into its place.
+ */
+USTRUCT(BlueprintType)
+struct ADASTREA_API FCargoHold
+{
+	GENERATED_BODY()
+
+	/**
+	 * Add units of an item
+	 * @return Slot holding the item, or INDEX_NONE for a null item or non-positive quantity
+	 */
+	int32 Add(UTradeItemDataAsset* Item, int32 Quantity);
+
+	/**
+	 * Remove units of an item
+	 * @return False (and nothing removed) if the hold has fewer than Quantity units
+	 */
+	bool Remove(const UTradeItemDataAsset* Item, int32 Quantity);
+
+	/** Empty the hold */
+	void Reset();
+
+	int32 FindSlot(const UTradeItemDataAsset* Item) const;
+	int32 GetQuantity(const UTradeItemDataAsset* Item) const;
+
+	int32 Num() const { return Items.Num(); }
+	bool IsEmpty() const { return Items.Num() == 0; }
+	UTradeItemDataAsset* GetItem(int32 Slot) const { return Items[Slot]; }
+	int32 GetSlotQuantity(int32 Slot) const { return Quantities[Slot]; }
+
+	float GetUsedVolume() const { return static_cast<float>(UsedVolume); }
+	float GetUsedMass() const { return static_cast<float>(UsedMass); }
+
+	/** Free volume for a given capacity (never negative) */
+	float GetAvailableVolume(float VolumeCapacity) const { return FMath::Max(0.0f, VolumeCapacity - GetUsedVolume()); }
+
+	/** Whether extra volume fits within a capacity */
+	bool CanFit(float Volume, float VolumeCapacity) const { return Volume <= GetAvailableVolume(VolumeCapacity); }
+
+	/**
+	 * Whether a whole batch of items fits at once (e.g. a trade cart)
+	 * One pass over the batch, no hold lookups or allocations
+	 */
+	bool CanFitAll(const TMap<UTradeItemDataAsset*, int32>& Batch, float VolumeCapacity) const;
+
+	/** Total volume of a batch of items */
+	static float GetBatchVolume(const TMap<UTradeItemDataAsset*, int32>& Batch);
+
+private:
+	/** Item per slot; also keeps the assets referenced */
+	UPROPERTY(VisibleAnywhere, Category="Cargo")
+	TArray<TObjectPtr<UTradeItemDataAsset>> Items;
+
+	/** Units per slot */
+	UPROPERTY(VisibleAnywhere, Category="Cargo")
+	TArray<int32> Quantities;
+
+	/** Per-unit volume and mass per slot, cached from the item */
+	TArray<float> UnitVolumes;
+	TArray<float> UnitMasses;
+
+	/** Item -> slot */
+	TMap<const UTradeItemDataAsset*, int32> SlotByItem;
+
+	/** Running totals; double so long add/remove sequences do not drift */
+	double UsedVolume = 0.0;
+	double UsedMass = 0.0;
+};
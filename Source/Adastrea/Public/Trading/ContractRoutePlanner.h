@@ -0,0 +1,177 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trading/TradeContractDataAsset.h"
+
+/**
+ * Kind of stop in a contract tour
+ */
+enum class EContractStopType : uint8
+{
+	Pickup,
+	Delivery
+};
+
+/**
+ * One stop of a planned contract tour
+ */
+struct FContractTourStop
+{
+	UTradeContractDataAsset* Contract = nullptr;
+	EContractStopType Type = EContractStopType::Pickup;
+
+	/** Estimated arrival time (game hours) */
+	float ArrivalTime = 0.0f;
+};
+
+/**
+ * Pickup/delivery tour planned for one trader
+ */
+struct ADASTREA_API FContractTour
+{
+	/** Stops in travel order; every contract's pickup comes before its delivery */
+	TArray<FContractTourStop> Stops;
+
+	/** Contracts served by the tour, in the order they were inserted */
+	TArray<UTradeContractDataAsset*> Contracts;
+
+	/** Travel time from the trader's start to the last stop (game hours) */
+	float TravelHours = 0.0f;
+
+	/** Sum of the served contracts' credit rewards */
+	int32 TotalReward = 0;
+
+	void Reset();
+};
+
+/**
+ * Trader constraints for contract tour planning
+ */
+struct FContractPlannerTrader
+{
+	/** Where the trader starts (MarketID and/or coordinates) */
+	FContractLocation StartLocation;
+
+	/** Game time the tour starts at (hours) */
+	float StartTime = 0.0f;
+
+	/** Travel speed in distance units per game hour */
+	float Speed = 100.0f;
+
+	/** Free cargo volume for contract cargo */
+	float VolumeCapacity = 0.0f;
+
+	/** Free cargo mass for contract cargo (<= 0 for no mass limit) */
+	float MassCapacity = 0.0f;
+
+	/** Most contracts one tour may carry (clamped to FContractRoutePlanner::MaxTourContracts) */
+	int32 MaxContracts = 8;
+};
+
+/**
+ * Contract Route Planner
+ *
+ * Plans multi-stop pickup/delivery tours over a set of open contracts.
+ * SetContracts() deduplicates contract locations and caches a travel
+ * distance matrix between them once; every PlanTour() call then reuses it,
+ * so planning for many traders only pays for per-trader start distances.
+ *
+ * Planning per trader:
+ * - Contracts are tried in order of naive reward rate (reward over deadhead
+ *   plus direct leg time) and each is inserted at its cheapest feasible
+ *   pickup/delivery positions. Feasibility is checked in O(1) per position
+ *   pair from cached arrival times, load and deadline slack.
+ * - A 2-opt pass then reverses tour segments while that shortens the tour
+ *   and keeps pickups before deliveries, cargo within capacity and
+ *   deliveries before their deadlines.
+ *
+ * Deadlines: active contracts use their ExpirationTime; available contracts
+ * with a TimeLimit are assumed to be accepted at the tour's start time.
+ *
+ * Distances come from the caller (e.g. the market travel matrix), so tours
+ * follow the sector graph where markets are positioned.
+ */
+class ADASTREA_API FContractRoutePlanner
+{
+public:
+	/** Returned by distance functions for locations with no path between them */
+	static constexpr float Unreachable = TNumericLimits<float>::Max();
+
+	/** Hard cap on contracts per tour (keeps precedence checks to one bitmask) */
+	static constexpr int32 MaxTourContracts = 32;
+
+	/** Distance between two contract locations, in the units of the trader's speed */
+	using FDistanceFunction = TFunction<float(const FContractLocation& From, const FContractLocation& To)>;
+
+	/** Straight-line distance between two locations' coordinates */
+	static float GetStraightLineDistance(const FContractLocation& From, const FContractLocation& To);
+
+	/**
+	 * Cache the contract set and the distances between its locations
+	 * Contracts that are neither available nor active are ignored
+	 * @param Distance Distance function, kept for per-trader start distances
+	 */
+	void SetContracts(const TArray<UTradeContractDataAsset*>& Contracts, FDistanceFunction Distance);
+
+	/** Drop the contract set */
+	void Reset();
+
+	/**
+	 * Plan a tour for one trader
+	 * @param InOutClaimed Optional claim flags indexed like GetContract(); claimed
+	 *        contracts are skipped and the planned ones are claimed, so several
+	 *        traders can split one contract board
+	 */
+	void PlanTour(const FContractPlannerTrader& Trader, FContractTour& OutTour, TBitArray<>* InOutClaimed = nullptr) const;
+
+	/**
+	 * Baseline for comparison: serve a tour's contracts one at a time in insertion order
+	 * (travel to the pickup, then straight to the delivery)
+	 * @param OutLateDeliveries Optional count of deliveries that would miss their deadline
+	 * @return Travel time in game hours
+	 */
+	float EstimateSequentialHours(const FContractPlannerTrader& Trader, const FContractTour& Tour, int32* OutLateDeliveries = nullptr) const;
+
+	/** Contracts considered for planning, in claim-flag order */
+	int32 GetContractCount() const { return Planned.Num(); }
+	UTradeContractDataAsset* GetContract(int32 Index) const { return Planned[Index].Contract; }
+
+	int32 GetLocationCount() const { return NumNodes; }
+
+private:
+	/** A contract with its cargo and locations resolved */
+	struct FPlannedContract
+	{
+		UTradeContractDataAsset* Contract = nullptr;
+		int32 PickupNode = INDEX_NONE;
+		int32 DeliveryNode = INDEX_NONE;
+		float Volume = 0.0f;
+		float Mass = 0.0f;
+		int32 Reward = 0;
+	};
+
+	/** Per-call planning state for one trader */
+	struct FTourState;
+
+	/** Node index of a location, adding it if new */
+	int32 FindOrAddNode(const FContractLocation& Location);
+
+	/** Absolute delivery deadline of a contract for a tour starting at StartTime (Max if none) */
+	static float GetDeadline(const UTradeContractDataAsset* Contract, float StartTime);
+
+	float GetNodeDistance(int32 From, int32 To) const { return NodeDistances[From * NumNodes + To]; }
+
+	TArray<FPlannedContract> Planned;
+	TMap<const UTradeContractDataAsset*, int32> ContractToIndex;
+
+	/** Unique contract locations; nodes are matched by MarketID, else by coordinates */
+	TArray<FContractLocation> Nodes;
+	TMap<FName, int32> NodeByMarket;
+	TMap<FVector, int32> NodeByCoordinates;
+	int32 NumNodes = 0;
+
+	/** Node x node distances (row-major) */
+	TArray<float> NodeDistances;
+
+	FDistanceFunction DistanceFunction;
+};
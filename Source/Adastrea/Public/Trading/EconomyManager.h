@@ -2,6 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Trading/EconomySimulationBatch.h"
+#include "Trading/EconomySnapshot.h"
+#include "Trading/MarketDataAsset.h"
+#include "Trading/MarketStateTable.h"
 #include "EconomyManager.generated.h"
 
 // Forward declarations
@@ -28,11 +32,24 @@ class UTradeItemDataAsset;
  * - Record transactions with RecordTransaction()
  * - Query prices with GetItemPrice()
  * 
+ * Market State:
+ * - UMarketDataAsset is a read-only template; each registered market instance
+ *   gets a row in the FMarketStateTable (keyed by instance ID) holding its
+ *   live stock, supply/demand and event state
+ * - One template can back several instances (e.g. one per station); the first
+ *   is keyed by the template's MarketID and is what asset-keyed calls use,
+ *   the Instance* calls address any instance by ID
+ * - Query live state with GetItemState(), GetMarketInventory() and IsItemInStock()
+ * - After each tick that changed anything, an immutable versioned copy is
+ *   published; AcquireSnapshot() pins it for lock-free reads from any thread
+ *   and HasMarketChangedSince() lets readers skip redundant rebuilds
+ * 
  * Integration:
  * - PlayerTraderComponent uses this for all trading operations
  * - AITraderComponent uses this for NPC trading
  * - MarketDataAsset provides market configuration
  * - TradeItemDataAsset defines tradeable items
+ * - Transactions feed UMarketPriceHistorySubsystem price candles
  * 
  * Economy Simulation:
  * - Player purchases decrease supply, increase demand
@@ -113,24 +130,66 @@ class ADASTREA_API UEconomyManager : public UGameInstanceSubsystem
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Economy|Config", meta=(ClampMin="1.0", ClampMax="60.0"))
 	float UpdateInterval;
 
+	/**
+	 * Length of one economy simulation step in game hours
+	 * Game time advances in whole steps, so market state depends only on the
+	 * number of steps simulated, never on timer or frame timing.
+	 * Default: 1/12 (5 game minutes, one update at 1x time scale)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Economy|Config", meta=(ClampMin="0.001", ClampMax="24.0"))
+	float FixedStepHours;
+
+	/**
+	 * Whether the economy tick uses the batched structure-of-arrays kernel
+	 * When false, markets are updated entry by entry (legacy path)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Economy|Config")
+	bool bUseBatchedSimulation;
+
 	// ====================
 	// MARKET MANAGEMENT
 	// ====================
 
 	/**
-	 * Register a market for economy simulation
-	 * @param Market The market to register
+	 * Register a market instance for economy simulation
+	 * Registering a template that already has an instance adds another instance with its own state
+	 * @param Market The market template
+	 * @param InstanceID Key of the instance's state (None = the template's MarketID, numbered if already in use)
+	 * @return The new instance's ID, or None if registration failed
 	 */
 	UFUNCTION(BlueprintCallable, Category="Economy|Markets")
-	void RegisterMarket(UMarketDataAsset* Market);
+	FName RegisterMarket(UMarketDataAsset* Market, FName InstanceID = NAME_None);
 
 	/**
-	 * Unregister a market from economy simulation
-	 * @param Market The market to unregister
+	 * Unregister every instance of a market from economy simulation
+	 * @param Market The market template to unregister
 	 */
 	UFUNCTION(BlueprintCallable, Category="Economy|Markets")
 	void UnregisterMarket(UMarketDataAsset* Market);
 
+	/**
+	 * Unregister one market instance
+	 * @param InstanceID The instance to remove
+	 */
+	UFUNCTION(BlueprintCallable, Category="Economy|Markets")
+	void UnregisterMarketInstance(FName InstanceID);
+
+	/**
+	 * Get the template a market instance was registered with
+	 * @param InstanceID The instance to look up
+	 * @return The template, or nullptr if no such instance is registered
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Markets")
+	UMarketDataAsset* GetMarketInstanceTemplate(FName InstanceID) const;
+
+	/**
+	 * Get the registered instances of a market template
+	 * @param Market The market template
+	 * @return Instance IDs in registration order
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Markets")
+	TArray<FName> GetMarketInstanceIDs(UMarketDataAsset* Market) const;
+
 	/**
 	 * Check if a market is registered
 	 * @param Market The market to check
@@ -140,8 +199,8 @@ class ADASTREA_API UEconomyManager : public UGameInstanceSubsystem
 	bool IsMarketRegistered(UMarketDataAsset* Market) const;
 
 	/**
-	 * Get all registered markets
-	 * @return Array of all active markets
+	 * Get all registered market templates
+	 * @return Every template with at least one registered instance
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Markets")
 	TArray<UMarketDataAsset*> GetActiveMarkets() const;
@@ -167,6 +226,16 @@ class ADASTREA_API UEconomyManager : public UGameInstanceSubsystem
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Trading")
 	float GetItemPrice(UMarketDataAsset* Market, UTradeItemDataAsset* Item, bool bIsBuying) const;
 
+	/**
+	 * Get the current prices of many items at a market in one call
+	 * @param Market The market to query
+	 * @param Items Items to price (null entries price at 0)
+	 * @param bIsBuying True if player is buying, false if selling
+	 * @param OutPrices Price per unit for each item, same order as Items
+	 */
+	UFUNCTION(BlueprintCallable, Category="Economy|Trading")
+	void GetItemPrices(UMarketDataAsset* Market, const TArray<UTradeItemDataAsset*>& Items, bool bIsBuying, TArray<float>& OutPrices) const;
+
 	/**
 	 * Record a transaction and update market state
 	 * Updates supply/demand based on transaction
@@ -178,6 +247,132 @@ class ADASTREA_API UEconomyManager : public UGameInstanceSubsystem
 	UFUNCTION(BlueprintCallable, Category="Economy|Trading")
 	void RecordTransaction(UMarketDataAsset* Market, UTradeItemDataAsset* Item, int32 Quantity, bool bPlayerBought);
 
+	/**
+	 * Get the current price of an item at a market instance
+	 * @param InstanceID The instance to query
+	 * @param Item The item to price
+	 * @param bIsBuying True if player is buying, false if selling
+	 * @return The price in credits, 0 if the instance is not registered
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Trading")
+	float GetInstanceItemPrice(FName InstanceID, UTradeItemDataAsset* Item, bool bIsBuying) const;
+
+	/**
+	 * Record a transaction at a market instance and update its state
+	 * @param InstanceID The instance where the transaction occurred
+	 * @param Item The item that was traded
+	 * @param Quantity Number of units traded
+	 * @param bPlayerBought True if player bought, false if player sold
+	 */
+	UFUNCTION(BlueprintCallable, Category="Economy|Trading")
+	void RecordInstanceTransaction(FName InstanceID, UTradeItemDataAsset* Item, int32 Quantity, bool bPlayerBought);
+
+	// ====================
+	// MARKET STATE
+	// ====================
+
+	/**
+	 * Get the live state of an item at a registered market
+	 * @param Market The market to query
+	 * @param Item The item to look up
+	 * @param OutState Current stock, supply/demand and event multiplier
+	 * @return False if the market is not registered or does not list the item
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Market State")
+	bool GetItemState(UMarketDataAsset* Market, UTradeItemDataAsset* Item, FMarketItemState& OutState) const;
+
+	/**
+	 * Check if a registered market has enough stock of an item
+	 * @param Market The market to query
+	 * @param Item The item to check
+	 * @param Quantity The quantity needed
+	 * @return True if sufficient stock is available
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Market State")
+	bool IsItemInStock(UMarketDataAsset* Market, UTradeItemDataAsset* Item, int32 Quantity) const;
+
+	/**
+	 * Get a market's inventory with live stock and supply/demand filled in
+	 * Falls back to the template inventory for unregistered markets
+	 * @param Market The market to query
+	 * @return Inventory entries in template order
+	 */
+	UFUNCTION(BlueprintCallable, Category="Economy|Market State")
+	TArray<FMarketInventoryEntry> GetMarketInventory(UMarketDataAsset* Market) const;
+
+	/**
+	 * Get the live state of an item at a market instance
+	 * @param InstanceID The instance to query
+	 * @param Item The item to look up
+	 * @param OutState Current stock, supply/demand and event multiplier
+	 * @return False if the instance is not registered or does not list the item
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Market State")
+	bool GetInstanceItemState(FName InstanceID, UTradeItemDataAsset* Item, FMarketItemState& OutState) const;
+
+	/**
+	 * Get a market instance's inventory with live stock and supply/demand filled in
+	 * @param InstanceID The instance to query
+	 * @return Inventory entries in template order, empty if the instance is not registered
+	 */
+	UFUNCTION(BlueprintCallable, Category="Economy|Market State")
+	TArray<FMarketInventoryEntry> GetInstanceInventory(FName InstanceID) const;
+
+	/**
+	 * Activate one of a market's configured events at the current game time
+	 * @param Market The market to run the event at
+	 * @param EventID The event to start
+	 * @return True if an inactive event with this ID was found and started
+	 */
+	UFUNCTION(BlueprintCallable, Category="Economy|Market State")
+	bool StartMarketEvent(UMarketDataAsset* Market, FName EventID);
+
+	/**
+	 * Get the active events at a market affecting an item
+	 * @param Market The market to query
+	 * @param ItemID The item to check
+	 * @return Active events with live start times
+	 */
+	UFUNCTION(BlueprintCallable, Category="Economy|Market State")
+	TArray<FMarketEvent> GetActiveEventsForItem(UMarketDataAsset* Market, FName ItemID) const;
+
+	/** Live state of an item at a market, nullptr if not registered or not listed */
+	const FMarketItemState* FindItemState(const UMarketDataAsset* Market, const UTradeItemDataAsset* Item) const;
+
+	/** Registered instance by ID, nullptr if none */
+	const FMarketInstance* FindMarketInstance(FName InstanceID) const;
+
+	/** Runtime state of every registered market (game thread only; use AcquireSnapshot elsewhere) */
+	const FMarketStateTable& GetMarketStates() const { return MarketStates; }
+
+	// ====================
+	// SNAPSHOTS
+	// ====================
+
+	/**
+	 * Pin the latest published economy snapshot
+	 * Safe from any thread; release the handle before the game instance shuts down
+	 * @return Invalid handle until the first tick has published
+	 */
+	FEconomySnapshotHandle AcquireSnapshot() const { return Snapshots.Acquire(); }
+
+	/**
+	 * Get the latest published snapshot version
+	 * Only increases when a tick changed market state
+	 * @return Version, 0 before the first publish
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Snapshots")
+	int64 GetSnapshotVersion() const;
+
+	/**
+	 * Check whether a market changed after a snapshot version the caller has already seen
+	 * @param Market The market to check
+	 * @param SinceVersion Version the caller last read
+	 * @return True if the market's published state is newer
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Snapshots")
+	bool HasMarketChangedSince(UMarketDataAsset* Market, int64 SinceVersion) const;
+
 	// ====================
 	// TIME & SIMULATION
 	// ====================
@@ -204,18 +399,85 @@ class ADASTREA_API UEconomyManager : public UGameInstanceSubsystem
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Time")
 	float GetTimeScale() const;
 
+	/**
+	 * Advance the economy by a span of game time (time skip, offline progression)
+	 * Runs every whole fixed step in one catch-up batch with the same results
+	 * as stepping one update at a time; the remainder carries over.
+	 * @param GameHours Game time to simulate
+	 */
+	UFUNCTION(BlueprintCallable, Category="Economy|Time")
+	void AdvanceTime(float GameHours);
+
+	/**
+	 * Advance the economy by real time at the current time scale
+	 * e.g. the time since SaveTimestamp when loading a save
+	 * @param RealSeconds Real time to simulate
+	 */
+	UFUNCTION(BlueprintCallable, Category="Economy|Time")
+	void AdvanceRealTime(float RealSeconds);
+
+	/**
+	 * Get the number of fixed steps simulated so far
+	 * @return Step count (game time = steps * FixedStepHours)
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Economy|Time")
+	int64 GetSimulationStep() const { return SimulationStep; }
+
+	// ====================
+	// EVENTS
+	// ====================
+
+	// Called when a market template gets its first instance
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMarketRegistered, UMarketDataAsset*, Market);
+	UPROPERTY(BlueprintAssignable, Category="Economy|Events")
+	FOnMarketRegistered OnMarketRegistered;
+
+	// Called when a market template's last instance is unregistered
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMarketUnregistered, UMarketDataAsset*, Market);
+	UPROPERTY(BlueprintAssignable, Category="Economy|Events")
+	FOnMarketUnregistered OnMarketUnregistered;
+
+	// Called when a transaction changes one item's state at one market
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnMarketItemUpdated, UMarketDataAsset*, Market, UTradeItemDataAsset*, Item);
+	UPROPERTY(BlueprintAssignable, Category="Economy|Events")
+	FOnMarketItemUpdated OnMarketItemUpdated;
+
+	// Called after each economy simulation step (all markets updated)
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEconomyUpdated, float, GameTime);
+	UPROPERTY(BlueprintAssignable, Category="Economy|Events")
+	FOnEconomyUpdated OnEconomyUpdated;
+
 protected:
 	// ====================
 	// INTERNAL STATE
 	// ====================
 
-	/** Active markets in the economy */
+	/** Templates with at least one registered instance */
 	UPROPERTY()
 	TArray<UMarketDataAsset*> ActiveMarkets;
 
+	/** Registered market instances, in the same order as their MarketStates rows */
+	UPROPERTY()
+	TArray<FMarketInstance> MarketInstances;
+
 	/** Timer handle for economy updates */
 	FTimerHandle UpdateTimerHandle;
 
+	/** Live state of every registered market, one row per instance */
+	FMarketStateTable MarketStates;
+
+	/** Flat working buffers for the batched economy tick */
+	FEconomySimulationBatch SimulationBatch;
+
+	/** Published copies of MarketStates for readers off the tick */
+	FEconomySnapshotBuffer Snapshots;
+
+	/** Fixed steps simulated since initialization */
+	int64 SimulationStep;
+
+	/** Game hours advanced but not yet simulated (less than one step) */
+	double PendingHours;
+
 	// ====================
 	// INTERNAL SIMULATION
 	// ====================
@@ -227,18 +489,41 @@ class ADASTREA_API UEconomyManager : public UGameInstanceSubsystem
 	void UpdateEconomy();
 
 	/**
-	 * Update prices for a specific market
+	 * Simulate whole fixed steps and advance game time
+	 * @param NumSteps Steps to run in one batch
+	 */
+	void StepEconomy(int64 NumSteps);
+
+	/**
+	 * Update all markets in one fused pass over flat buffers
+	 * Equivalent to UpdateMarketPrices + SimulateBackgroundActivity per market, NumSteps times
+	 * @param DeltaHours Length of one step in game hours
+	 * @param NumSteps Consecutive steps to run
+	 */
+	void UpdateMarketsBatched(float DeltaHours, int64 NumSteps);
+
+	/**
+	 * Update prices for a specific market instance
 	 * Applies economic recovery over time
-	 * @param Market The market to update
+	 * @param Market The market instance to update
 	 * @param DeltaHours Time elapsed in game hours
 	 */
-	void UpdateMarketPrices(UMarketDataAsset* Market, float DeltaHours);
+	void UpdateMarketPrices(const FMarketInstance& Market, float DeltaHours);
 
 	/**
 	 * Simulate background trading activity
 	 * Replenishes stock, simulates NPC trading
-	 * @param Market The market to simulate
+	 * @param Market The market instance to simulate
 	 * @param DeltaHours Time elapsed in game hours
 	 */
-	void SimulateBackgroundActivity(UMarketDataAsset* Market, float DeltaHours);
+	void SimulateBackgroundActivity(const FMarketInstance& Market, float DeltaHours);
+
+	/**
+	 * Expire a market instance's finished events at the current game time
+	 * @param Instance The market instance to update
+	 */
+	void UpdateMarketEvents(const FMarketInstance& Instance);
+
+	/** Remove one instance and its state row; broadcasts OnMarketUnregistered if it was the template's last */
+	void RemoveMarketInstance(int32 InstanceIndex);
 };
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+struct FMarketInstance;
+struct FMarketStateTable;
+
+/**
+ * Economy Simulation Batch
+ *
+ * Structure-of-arrays working set for the economy tick.
+ * Supply, demand, stock and replenishment data for every registered market
+ * is laid out in flat, contiguous buffers so a single fused pass can apply
+ * recovery, clamping and replenishment without touching UObjects.
+ *
+ * Layout (per-entry max stock, replenish rate, per-market entry counts) is cached and
+ * only rebuilt when the market set or a market's row size changes. Mutable state
+ * (supply, demand, stock) is gathered from and scattered back to each
+ * market's row in the FMarketStateTable around the kernel; max stock and
+ * replenishment come from the market templates.
+ *
+ * Usage:
+ * @code
+ * Batch.Gather(MarketInstances, MarketStates);
+ * Batch.Simulate(RecoveryAlpha, MinLevel, MaxLevel, DeltaHours);
+ * Batch.Scatter(MarketInstances, MarketStates, DeltaHours);
+ * @endcode
+ */
+struct ADASTREA_API FEconomySimulationBatch
+{
+	/** Flag the cached layout as stale (market registered/unregistered) */
+	void MarkLayoutDirty() { bLayoutDirty = true; }
+
+	/** Number of inventory entries in the batch */
+	int32 GetNum() const { return Supply.Num(); }
+
+	/**
+	 * Copy supply, demand and stock of every market instance's state row into the flat buffers.
+	 * Rebuilds the cached layout first if the market set or any row size changed.
+	 * Instances without a row in States are skipped.
+	 * @param Markets Market instances to gather, in simulation order
+	 * @param States Runtime state table holding each market's row
+	 */
+	void Gather(const TArray<FMarketInstance>& Markets, const FMarketStateTable& States);
+
+	/**
+	 * Run the fused simulation kernel over the gathered buffers
+	 * @param RecoveryAlpha Fraction of the distance back to baseline recovered per step (clamped to [0, 1])
+	 * @param MinLevel Minimum supply/demand level
+	 * @param MaxLevel Maximum supply/demand level
+	 * @param DeltaHours Length of one step in game hours
+	 * @param NumSteps Consecutive steps to run (catch-up), bit-identical to running them one at a time
+	 */
+	void Simulate(float RecoveryAlpha, float MinLevel, float MaxLevel, float DeltaHours, int64 NumSteps = 1);
+
+	/**
+	 * Write simulated supply, demand and stock back into each market's state row.
+	 * Must be called with the same markets and table that were passed to Gather().
+	 * @param Markets Market instances to write back for
+	 * @param States Runtime state table to write to
+	 * @param DeltaHours Time elapsed in game hours (used to mirror replenishment stock flags)
+	 */
+	void Scatter(const TArray<FMarketInstance>& Markets, FMarketStateTable& States, float DeltaHours) const;
+
+	/**
+	 * Fused economy kernel operating on raw structure-of-arrays buffers.
+	 * Branch-free per element so the compiler can vectorize the loop.
+	 * Supply/demand use the same lerp formulation as FMath::Lerp so results
+	 * match the per-entry path bit for bit when RecoveryAlpha <= 1.
+	 */
+	static void SimulateStep(
+		int32 Num,
+		float* RESTRICT SupplyLevels,
+		float* RESTRICT DemandLevels,
+		int32* RESTRICT StockLevels,
+		const int32* RESTRICT MaxStockLevels,
+		const float* RESTRICT ReplenishRates,
+		float RecoveryAlpha,
+		float MinLevel,
+		float MaxLevel,
+		float DeltaHours);
+
+	/**
+	 * Catch-up kernel: the result of SimulateStep applied NumSteps times.
+	 * Each entry iterates recovery only until supply and demand reach their
+	 * float fixed point (further steps would not change them), and
+	 * replenishment, a constant amount per step up to MaxStock, is applied in
+	 * closed form, so the cost is bounded per entry rather than per step.
+	 */
+	static void SimulateSteps(
+		int32 Num,
+		float* RESTRICT SupplyLevels,
+		float* RESTRICT DemandLevels,
+		int32* RESTRICT StockLevels,
+		const int32* RESTRICT MaxStockLevels,
+		const float* RESTRICT ReplenishRates,
+		float RecoveryAlpha,
+		float MinLevel,
+		float MaxLevel,
+		float DeltaHours,
+		int64 NumSteps);
+
+private:
+	/** Rebuild cached per-entry layout data from the current markets */
+	void RebuildLayout(const TArray<FMarketInstance>& Markets, const FMarketStateTable& States);
+
+	/** Check whether the cached layout still matches the given markets */
+	bool IsLayoutValid(const TArray<FMarketInstance>& Markets, const FMarketStateTable& States) const;
+
+	/** State row of a market instance and its entry count in the batch (0 if it has no row) */
+	static int32 GetBatchEntryCount(const FMarketInstance& Market, const FMarketStateTable& States, int32& OutRow);
+
+	// Mutable per-entry state (gathered every tick)
+	TArray<float> Supply;
+	TArray<float> Demand;
+	TArray<int32> Stock;
+
+	// Cached per-entry layout (rebuilt only when dirty)
+	TArray<int32> MaxStock;
+	TArray<float> ReplenishRate;
+
+	/** State row entry count per market, in simulation order */
+	TArray<int32> MarketEntryCounts;
+
+	/** Whether the layout must be rebuilt before the next gather */
+	bool bLayoutDirty = true;
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trading/MarketStateTable.h"
+#include <atomic>
+
+/**
+ * Immutable copy of every market's runtime state, published after an economy tick
+ */
+struct ADASTREA_API FEconomySnapshot
+{
+	/** Publish counter; only increases when market state actually changed (0 = nothing published) */
+	uint64 Version = 0;
+
+	/** Economy game time (hours) when this state was published */
+	float GameTimeHours = 0.0f;
+
+	/** Market rows as of this version */
+	FMarketStateTable MarketStates;
+
+	/** Whether anything changed after a version a reader has already seen */
+	bool HasChangedSince(uint64 SinceVersion) const { return Version > SinceVersion; }
+
+	/**
+	 * Whether one market's row changed after a version a reader has already seen
+	 * Markets not in the snapshot (e.g. unregistered since) report any newer version as a change
+	 */
+	bool HasMarketChangedSince(FName MarketID, uint64 SinceVersion) const;
+
+private:
+	friend class FEconomySnapshotBuffer;
+
+	/** Version in which each market's row last changed */
+	TMap<FName, uint64> MarketVersions;
+};
+
+/**
+ * Read pin on a published snapshot
+ * While a handle is held the publisher will not reuse its buffer, so the
+ * snapshot can be read from any thread without locks. Handles are move-only
+ * and must be released before the owning FEconomySnapshotBuffer is destroyed.
+ */
+class ADASTREA_API FEconomySnapshotHandle
+{
+public:
+	FEconomySnapshotHandle() = default;
+	FEconomySnapshotHandle(FEconomySnapshotHandle&& Other);
+	FEconomySnapshotHandle& operator=(FEconomySnapshotHandle&& Other);
+	FEconomySnapshotHandle(const FEconomySnapshotHandle&) = delete;
+	FEconomySnapshotHandle& operator=(const FEconomySnapshotHandle&) = delete;
+	~FEconomySnapshotHandle() { Release(); }
+
+	bool IsValid() const { return Snapshot != nullptr; }
+	const FEconomySnapshot* Get() const { return Snapshot; }
+	const FEconomySnapshot* operator->() const { check(Snapshot); return Snapshot; }
+	const FEconomySnapshot& operator*() const { check(Snapshot); return *Snapshot; }
+
+	/** Drop the pin early */
+	void Release();
+
+private:
+	friend class FEconomySnapshotBuffer;
+
+	FEconomySnapshotHandle(const FEconomySnapshot* InSnapshot, std::atomic<int32>* InReaders)
+		: Snapshot(InSnapshot)
+		, Readers(InReaders)
+	{}
+
+	const FEconomySnapshot* Snapshot = nullptr;
+	std::atomic<int32>* Readers = nullptr;
+};
+
+/**
+ * Economy Snapshot Buffer
+ *
+ * Fixed set of snapshot buffers with an atomically swapped "published" slot.
+ * The game thread copies the state table into a buffer no reader holds and
+ * then swaps it in; readers on any thread pin the published buffer with
+ * Acquire() and read it without locks or copies. With three slots the writer
+ * always finds a free buffer unless two older snapshots are still pinned
+ * (e.g. a long autosave), in which case that publish is skipped and the next
+ * one catches up. Buffers are reused, so steady-state publishing does not
+ * allocate.
+ */
+class ADASTREA_API FEconomySnapshotBuffer
+{
+public:
+	static constexpr int32 NumSlots = 3;
+
+	FEconomySnapshotBuffer() = default;
+	FEconomySnapshotBuffer(const FEconomySnapshotBuffer&) = delete;
+	FEconomySnapshotBuffer& operator=(const FEconomySnapshotBuffer&) = delete;
+
+	/**
+	 * Publish the current state if it differs from the last published snapshot (game thread only)
+	 * @return True if a new version was published
+	 */
+	bool Publish(const FMarketStateTable& States, float GameTimeHours);
+
+	/** Pin the latest snapshot (any thread); invalid until something was published */
+	FEconomySnapshotHandle Acquire() const;
+
+	/** Latest published version (any thread) */
+	uint64 GetVersion() const { return PublishedVersion.load(std::memory_order_acquire); }
+
+	/** Unpublish and free unpinned buffers (game thread only); versions keep counting up */
+	void Reset();
+
+	/** Memory held by all buffers */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FSlot
+	{
+		FEconomySnapshot Snapshot;
+		mutable std::atomic<int32> Readers{ 0 };
+	};
+
+	/** Whether a row differs from the same market's row in another table */
+	static bool HasRowChanged(const FMarketStateTable& States, int32 Row, const FMarketStateTable& Previous);
+
+	FSlot Slots[NumSlots];
+
+	/** Slot readers should pin, INDEX_NONE before the first publish */
+	std::atomic<int32> PublishedSlot{ INDEX_NONE };
+
+	std::atomic<uint64> PublishedVersion{ 0 };
+};
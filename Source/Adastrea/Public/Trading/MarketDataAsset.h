@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "Trading/MarketStateTable.h"
 #include "MarketDataAsset.generated.h"
 
 // Forward declarations
@@ -79,12 +80,12 @@ struct FMarketEvent
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Market Event", meta=(ClampMin="0"))
 	float DurationHours;
 
-	// When event started (game time)
-	UPROPERTY(BlueprintReadWrite, Category="Market Event")
+	// When event started (game time); live value lives in UEconomyManager's market state table
+	UPROPERTY(BlueprintReadOnly, Category="Market Event")
 	float StartTime;
 
-	// Whether event is currently active
-	UPROPERTY(BlueprintReadWrite, Category="Market Event")
+	// Whether event is currently active; live value lives in UEconomyManager's market state table
+	UPROPERTY(BlueprintReadOnly, Category="Market Event")
 	bool bIsActive;
 
 	FMarketEvent()
@@ -102,6 +103,8 @@ struct FMarketEvent
 
 /**
  * Market inventory entry tracking stock and pricing
+ * On a UMarketDataAsset these are the initial values of a market instance;
+ * UEconomyManager::GetMarketInventory returns entries with live values.
  */
 USTRUCT(BlueprintType)
 struct FMarketInventoryEntry
@@ -113,7 +116,7 @@ struct FMarketInventoryEntry
 	UTradeItemDataAsset* TradeItem;
 
 	// Current stock level
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Inventory", meta=(ClampMin="0"))
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Inventory", meta=(ClampMin="0"))
 	int32 CurrentStock;
 
 	// Maximum stock level
@@ -121,19 +124,19 @@ struct FMarketInventoryEntry
 	int32 MaxStock;
 
 	// Base supply level (1.0 = typical)
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Inventory", meta=(ClampMin="0.0"))
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Inventory", meta=(ClampMin="0.0"))
 	float SupplyLevel;
 
 	// Base demand level (1.0 = typical)
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Inventory", meta=(ClampMin="0.0"))
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Inventory", meta=(ClampMin="0.0"))
 	float DemandLevel;
 
-	// Last price this was sold at
-	UPROPERTY(BlueprintReadWrite, Category="Inventory")
+	// Last price this was sold at (runtime only)
+	UPROPERTY(BlueprintReadOnly, Category="Inventory")
 	float LastTradePrice;
 
-	// Whether this item is currently in stock
-	UPROPERTY(BlueprintReadWrite, Category="Inventory")
+	// Whether this item is currently in stock (runtime only)
+	UPROPERTY(BlueprintReadOnly, Category="Inventory")
 	bool bInStock;
 
 	FMarketInventoryEntry()
@@ -150,6 +153,10 @@ struct FMarketInventoryEntry
 /**
  * Market configuration data asset
  * Defines market behavior, inventory, and pricing
+ *
+ * The asset is a read-only template: stock, supply/demand and event state
+ * that change during play live in UEconomyManager's FMarketStateTable,
+ * so one asset can back markets in any number of worlds.
  */
 UCLASS(BlueprintType)
 class ADASTREA_API UMarketDataAsset : public UPrimaryDataAsset
@@ -218,24 +225,21 @@ class ADASTREA_API UMarketDataAsset : public UPrimaryDataAsset
 	// INVENTORY
 	// ====================
 
-	// Items available in this market
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Inventory")
+	// Items available in this market (initial state of each market instance)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Inventory")
 	TArray<FMarketInventoryEntry> Inventory;
 
 	// Stock refresh rate in game hours
+	// Not read by the economy tick: stock replenishes every step at each item's ReplenishmentRate
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Inventory", meta=(ClampMin="0"))
 	float StockRefreshRate;
 
-	// Last stock refresh time
-	UPROPERTY(BlueprintReadWrite, Category="Inventory")
-	float LastStockRefreshTime;
-
 	// ====================
 	// MARKET EVENTS
 	// ====================
 
-	// Active market events
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Market Events")
+	// Market events this market can run (started via UEconomyManager::StartMarketEvent)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Market Events")
 	TArray<FMarketEvent> ActiveEvents;
 
 	// Random event chance per day (0.0 to 1.0)
@@ -269,14 +273,38 @@ class ADASTREA_API UMarketDataAsset : public UPrimaryDataAsset
 	// ====================
 
 	/**
-	 * Get current price for an item (buy or sell)
+	 * Get the template price for an item (buy or sell)
+	 * Uses the asset's initial supply/demand; live prices come from UEconomyManager::GetItemPrice
 	 * @param TradeItem The item to get price for
 	 * @param bIsBuying True if player is buying, false if selling
-	 * @return Current price per unit
+	 * @return Price per unit
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Market|Pricing")
 	float GetItemPrice(UTradeItemDataAsset* TradeItem, bool bIsBuying) const;
 
+	/**
+	 * Price an item for a given runtime state of this market
+	 * Calls the Blueprint price overrides only when a class implements them
+	 * @param TradeItem The item to price (must not be null)
+	 * @param bIsBuying True if player is buying, false if selling
+	 * @param State Live state of the item at a market instance
+	 * @return Price per unit
+	 */
+	float CalculateItemPrice(UTradeItemDataAsset* TradeItem, bool bIsBuying, const FMarketItemState& State) const;
+
+	/**
+	 * Runtime state a new market instance starts with for an inventory entry
+	 * @param InventoryIndex Index into Inventory
+	 */
+	FMarketItemState MakeInitialItemState(int32 InventoryIndex) const;
+
+	/**
+	 * Total price multiplier from the events active in a runtime event state
+	 * @param ItemID The item to price
+	 * @param EventStates Live state per ActiveEvents entry
+	 */
+	float GetEventPriceMultiplier(FName ItemID, TConstArrayView<FMarketEventState> EventStates) const;
+
 	/**
 	 * Get inventory entry for a specific item
 	 * @param ItemID The item ID to find
@@ -287,13 +315,35 @@ class ADASTREA_API UMarketDataAsset : public UPrimaryDataAsset
 	bool GetInventoryEntry(FName ItemID, FMarketInventoryEntry& OutEntry) const;
 
 	/**
-	 * Check if an item is in stock
-	 * @param ItemID The item to check
-	 * @param Quantity The quantity needed
-	 * @return True if sufficient stock is available
+	 * Find the inventory entry for an item without copying it
+	 * Constant time via the lazily rebuilt inventory index
+	 * @param ItemID The item ID to find
+	 * @return Pointer into Inventory, or nullptr if the item is not stocked
 	 */
-	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Market|Inventory")
-	bool IsItemInStock(FName ItemID, int32 Quantity) const;
+	const FMarketInventoryEntry* FindInventoryEntry(FName ItemID) const;
+
+	/**
+	 * Find the inventory entry for a trade item asset without copying it
+	 * @param TradeItem The item asset to find
+	 * @return Pointer into Inventory, or nullptr if the item is not stocked
+	 */
+	const FMarketInventoryEntry* FindInventoryEntry(const UTradeItemDataAsset* TradeItem) const;
+
+	/**
+	 * Get the index of an item in Inventory
+	 * @param ItemID The item ID to find
+	 * @return Index into Inventory, or INDEX_NONE if not stocked
+	 */
+	int32 FindInventoryIndex(FName ItemID) const;
+	int32 FindInventoryIndex(const UTradeItemDataAsset* TradeItem) const;
+
+	/**
+	 * Mark the inventory index as stale
+	 * Call after replacing TradeItem on existing entries at runtime;
+	 * adding or removing entries is detected automatically
+	 */
+	UFUNCTION(BlueprintCallable, Category="Market|Inventory")
+	void InvalidateInventoryIndex();
 
 	/**
 	 * Get all items in a specific category
@@ -307,35 +357,116 @@ class ADASTREA_API UMarketDataAsset : public UPrimaryDataAsset
 	// All players can access all markets in MVP Trading
 
 	/**
-	 * Get active market events affecting a specific item
-	 * @param ItemID The item to check
-	 * @return Array of active events affecting this item
+	 * Mark the cached template event price multipliers as stale
+	 * Call after editing multipliers on ActiveEvents at runtime
 	 */
 	UFUNCTION(BlueprintCallable, Category="Market|Events")
-	TArray<FMarketEvent> GetActiveEventsForItem(FName ItemID) const;
+	void InvalidateEventCache();
+
+	// ====================
+	// DEPRECATED
+	// Live market state moved to UEconomyManager; these forward to it for existing Blueprints
+	// ====================
 
-private:
 	/**
-	 * Update market inventory and prices based on elapsed time
-	 * Internal system operation - called by EconomyManager
+	 * Check if an item is in stock at this market's registered instance
+	 * @param WorldContextObject World whose economy to query
+	 * @param ItemID The item to check
+	 * @param Quantity The quantity needed
+	 * @return True if sufficient stock is available, false if the market isn't registered
 	 */
-	void UpdateMarket(float DeltaHours);
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Market|Inventory", meta=(WorldContext="WorldContextObject", DeprecatedFunction, DeprecationMessage="Use UEconomyManager::IsItemInStock"))
+	bool IsItemInStock(const UObject* WorldContextObject, FName ItemID, int32 Quantity) const;
 
 	/**
-	 * Refresh stock levels for all items
-	 * Internal system operation - called by UpdateMarket
+	 * Get active market events affecting a specific item at this market's registered instance
+	 * @param WorldContextObject World whose economy to query
+	 * @param ItemID The item to check
+	 * @return Active events with live start times, empty if the market isn't registered
 	 */
-	void RefreshStock();
+	UFUNCTION(BlueprintCallable, Category="Market|Events", meta=(WorldContext="WorldContextObject", DeprecatedFunction, DeprecationMessage="Use UEconomyManager::GetActiveEventsForItem"))
+	TArray<FMarketEvent> GetActiveEventsForItem(const UObject* WorldContextObject, FName ItemID) const;
 
 	/**
-	 * Process a market event update (check expiration, etc.)
-	 * Internal system operation - called by EconomyManager
+	 * Activate a configured market event at this market's registered instance
+	 * @param WorldContextObject World whose economy to update
+	 * @param EventID The event to start
+	 * @param CurrentGameTime Ignored; the event starts at the economy's game time
+	 * @return True if an inactive event with this ID was found and started
 	 */
-	void UpdateMarketEvents(float CurrentGameTime);
+	UFUNCTION(BlueprintCallable, Category="Market|Events", meta=(WorldContext="WorldContextObject", DeprecatedFunction, DeprecationMessage="Use UEconomyManager::StartMarketEvent"))
+	bool StartMarketEvent(const UObject* WorldContextObject, FName EventID, float CurrentGameTime);
+
+	// ====================
+	// UObject Interface
+	// ====================
+
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	// ====================
+	// INVENTORY INDEX
+	// ====================
+
+	/**
+	 * ItemID -> Inventory index lookup, rebuilt lazily on first query after invalidation
+	 *
+	 * Thread Safety: Data Assets are typically accessed from the game thread only.
+	 * If multi-threaded access is needed, external synchronization should be used.
+	 */
+	mutable TMap<FName, int32> ItemIDToInventoryIndex;
+
+	/** TradeItem asset -> Inventory index lookup (identity only, never dereferenced) */
+	mutable TMap<const UTradeItemDataAsset*, int32> ItemToInventoryIndex;
+
+	/** Inventory size when the index was built, to catch unnotified adds/removes */
+	mutable int32 IndexedInventoryNum;
+
+	/** Dirty flag for index invalidation */
+	mutable bool bInventoryIndexDirty;
+
+	/** Rebuild the index if it is dirty or Inventory changed size */
+	void UpdateInventoryIndex() const;
+
+	// ====================
+	// EVENT MULTIPLIER CACHE
+	// ====================
+
+	/** Product of PriceMultiplier for active events that list the item explicitly */
+	mutable TMap<FName, float> ItemEventMultipliers;
+
+	/** Product of PriceMultiplier for active events with no AffectedItemIDs (affect every item) */
+	mutable float GlobalEventMultiplier;
+
+	/** ActiveEvents size when the cache was built, to catch unnotified adds/removes */
+	mutable int32 CachedEventCount;
+
+	/** Dirty flag for event cache invalidation */
+	mutable bool bEventCacheDirty;
+
+	/** Rebuild the event multiplier cache if it is dirty or ActiveEvents changed size */
+	void UpdateEventCache() const;
+
+	// ====================
+	// PRICING
+	// ====================
+
+	/** Whether this market's class overrides OnCalculateCustomMarketPrice (detected on init/load) */
+	bool bHasCustomMarketPriceOverride;
+
+	void DetectPriceOverride();
+
+	/** Standard supply/demand/event/markup/tax price, with no Blueprint overrides */
+	float CalculateNativePrice(const UTradeItemDataAsset* TradeItem, bool bIsBuying, const FMarketItemState& State) const;
 
 	/**
-	 * Calculate total price multiplier from all active events for an item
-	 * Internal calculation - called by GetItemPrice
+	 * Price multiplier from the events active in the template
+	 * Internal calculation - called by MakeInitialItemState
 	 */
 	float GetEventPriceMultiplier(FName ItemID) const;
 
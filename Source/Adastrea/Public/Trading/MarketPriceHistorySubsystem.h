@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Trading/PriceCandleSeries.h"
+#include "MarketPriceHistorySubsystem.generated.h"
+
+// Forward declarations
+class UEconomyManager;
+class UMarketDataAsset;
+class UTradeItemDataAsset;
+
+/**
+ * Market Price History Subsystem
+ *
+ * Keeps OHLC/volume candles per (market, item) at 1 game hour, 1 game day
+ * and 1 game week resolution, updated incrementally as trades are recorded.
+ * Price history queries cost O(buckets) and never touch raw transactions.
+ *
+ * Memory is bounded: each resolution keeps a fixed number of candles per
+ * (market, item), and a market's history is dropped when it is unregistered.
+ *
+ * Usage:
+ * - Access via UGameInstance::GetSubsystem<UMarketPriceHistorySubsystem>()
+ * - Query with GetCandles(), GetAveragePrice() and GetPriceTrend()
+ *
+ * Integration:
+ * - UEconomyManager::RecordTransaction records player trades
+ * - UAITraderComponent::ExecuteTrade records AI trades
+ * - Game time comes from UEconomyManager (hours)
+ */
+UCLASS()
+class ADASTREA_API UMarketPriceHistorySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UMarketPriceHistorySubsystem();
+
+	// ====================
+	// SUBSYSTEM LIFECYCLE
+	// ====================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// ====================
+	// CONFIGURATION
+	// ====================
+
+	/** Hour candles kept per (market, item) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Price History|Config", meta=(ClampMin="1"))
+	int32 HourCandleCount;
+
+	/** Day candles kept per (market, item) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Price History|Config", meta=(ClampMin="1"))
+	int32 DayCandleCount;
+
+	/** Week candles kept per (market, item) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Price History|Config", meta=(ClampMin="1"))
+	int32 WeekCandleCount;
+
+	// ====================
+	// RECORDING
+	// ====================
+
+	/**
+	 * Record a trade at the current economy game time
+	 * @param Market Market where the trade happened
+	 * @param Item Item traded
+	 * @param Price Price per unit
+	 * @param Quantity Units traded
+	 */
+	UFUNCTION(BlueprintCallable, Category="Price History")
+	void RecordTrade(UMarketDataAsset* Market, UTradeItemDataAsset* Item, float Price, int32 Quantity);
+
+	/** Record a trade at an explicit game time in hours (for replaying history) */
+	void RecordTradeAt(const UMarketDataAsset* Market, const UTradeItemDataAsset* Item, float Price, int32 Quantity, float GameTimeHours);
+
+	/** Drop all history of a market */
+	UFUNCTION(BlueprintCallable, Category="Price History")
+	void ClearMarketHistory(UMarketDataAsset* Market);
+
+	// ====================
+	// QUERIES
+	// ====================
+
+	/**
+	 * Get the newest candles for an item at a market
+	 * @param MaxCount Number of candles (<= 0 for all retained)
+	 * @return Candles oldest first
+	 */
+	UFUNCTION(BlueprintCallable, Category="Price History")
+	TArray<FPriceCandle> GetCandles(UMarketDataAsset* Market, UTradeItemDataAsset* Item, EPriceCandleResolution Resolution, int32 MaxCount) const;
+
+	/**
+	 * Volume-weighted average price over the newest candles
+	 * @return 0 if the item has no recorded trades at the market
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Price History")
+	float GetAveragePrice(UMarketDataAsset* Market, UTradeItemDataAsset* Item, EPriceCandleResolution Resolution, int32 Buckets) const;
+
+	/**
+	 * Relative price change over the newest candles (0.1 = +10%)
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Price History")
+	float GetPriceTrend(UMarketDataAsset* Market, UTradeItemDataAsset* Item, EPriceCandleResolution Resolution, int32 Buckets) const;
+
+	/** Candle series for an item at a market, nullptr if nothing was recorded */
+	const FPriceCandleSeries* FindSeries(const UMarketDataAsset* Market, const UTradeItemDataAsset* Item) const;
+
+	/** Number of (market, item) series currently held */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Price History")
+	int32 GetSeriesCount() const;
+
+private:
+	UFUNCTION()
+	void HandleMarketUnregistered(UMarketDataAsset* Market);
+
+	UPROPERTY()
+	UEconomyManager* EconomyManager;
+
+	/** Series per market, then per item (keys are only compared, never dereferenced) */
+	TMap<const UMarketDataAsset*, TMap<const UTradeItemDataAsset*, FPriceCandleSeries>> History;
+};
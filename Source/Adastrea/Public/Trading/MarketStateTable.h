@@ -0,0 +1,207 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectPtr.h"
+#include "MarketStateTable.generated.h"
+
+// Forward declarations
+class UMarketDataAsset;
+class UTradeItemDataAsset;
+
+/**
+ * Runtime state of one item at one market instance
+ * Plain data only, so rows can be copied, compared and serialized in bulk.
+ */
+USTRUCT(BlueprintType)
+struct ADASTREA_API FMarketItemState
+{
+	GENERATED_BODY()
+
+	// Current stock level
+	UPROPERTY(BlueprintReadOnly, Category="Market State")
+	int32 CurrentStock = 0;
+
+	// Supply level (1.0 = typical)
+	UPROPERTY(BlueprintReadOnly, Category="Market State")
+	float SupplyLevel = 1.0f;
+
+	// Demand level (1.0 = typical)
+	UPROPERTY(BlueprintReadOnly, Category="Market State")
+	float DemandLevel = 1.0f;
+
+	// Last price this item traded at
+	UPROPERTY(BlueprintReadOnly, Category="Market State")
+	float LastTradePrice = 0.0f;
+
+	// Product of the price multipliers of active events affecting this item
+	UPROPERTY(BlueprintReadOnly, Category="Market State")
+	float EventMultiplier = 1.0f;
+
+	// Whether the item is currently in stock
+	UPROPERTY(BlueprintReadOnly, Category="Market State")
+	bool bInStock = false;
+
+	bool operator==(const FMarketItemState& Other) const
+	{
+		return CurrentStock == Other.CurrentStock
+			&& SupplyLevel == Other.SupplyLevel
+			&& DemandLevel == Other.DemandLevel
+			&& LastTradePrice == Other.LastTradePrice
+			&& EventMultiplier == Other.EventMultiplier
+			&& bInStock == Other.bInStock;
+	}
+
+	bool operator!=(const FMarketItemState& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Runtime state of one configured event at one market instance
+ */
+struct FMarketEventState
+{
+	/** When the event started (game hours) */
+	float StartTime = 0.0f;
+
+	/** Whether the event is currently active */
+	bool bIsActive = false;
+};
+
+/**
+ * One market instance in the state table
+ * Item and event states are contiguous ranges in the table's flat arrays,
+ * in the same order as the template's Inventory and ActiveEvents.
+ */
+struct FMarketStateRow
+{
+	/** Market instance key (the template's MarketID for its primary instance) */
+	FName MarketID;
+
+	int32 FirstItem = 0;
+	int32 NumItems = 0;
+	int32 FirstEvent = 0;
+	int32 NumEvents = 0;
+};
+
+/** An item whose state differs between two tables */
+struct FMarketStateItemRef
+{
+	FName MarketID;
+
+	/** Index into the market template's Inventory */
+	int32 ItemIndex = INDEX_NONE;
+};
+
+/**
+ * A registered market: the read-only template and the key of its state row
+ */
+USTRUCT()
+struct ADASTREA_API FMarketInstance
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UMarketDataAsset> Template = nullptr;
+
+	UPROPERTY()
+	FName InstanceID;
+};
+
+static_assert(std::is_trivially_copyable_v<FMarketItemState>, "Market item state must stay plain data");
+static_assert(std::is_trivially_copyable_v<FMarketEventState>, "Market event state must stay plain data");
+
+/**
+ * Market State Table
+ *
+ * Mutable economy state for every market instance, one row per instance
+ * keyed by instance ID. Several instances may share one template; a
+ * template's primary instance is keyed by its MarketID, so lookups by asset
+ * read that row. UMarketDataAsset stays a read-only template (names,
+ * config, initial stock and supply/demand); everything the simulation
+ * changes lives here, in flat plain-data arrays, so the whole economy can be
+ * copied as a snapshot, diffed against an older copy, or serialized without
+ * touching any asset.
+ *
+ * Owned by UEconomyManager; see UEconomyManager::GetMarketStates().
+ */
+struct ADASTREA_API FMarketStateTable
+{
+	/** Row key of a template's primary instance (MarketID, or the asset name if unset) */
+	static FName GetMarketKey(const UMarketDataAsset* Market);
+
+	/** Unused key for a new instance of a template: its primary key if free, else a numbered variant */
+	FName MakeInstanceID(const UMarketDataAsset* Template) const;
+
+	/**
+	 * Add a row initialized from a template's inventory and events
+	 * @param InstanceID Key of the new row
+	 * @return New row index, or INDEX_NONE if the key is None or already in use
+	 */
+	int32 AddMarket(const UMarketDataAsset* Template, FName InstanceID);
+
+	/** Add a template's primary instance */
+	int32 AddMarket(const UMarketDataAsset* Template) { return AddMarket(Template, GetMarketKey(Template)); }
+
+	/** Remove a market's row; later rows move down */
+	bool RemoveMarket(FName MarketID);
+
+	/** Remove every row */
+	void Reset();
+
+	int32 FindRow(FName MarketID) const;
+	int32 FindRow(const UMarketDataAsset* Market) const { return Market ? FindRow(GetMarketKey(Market)) : INDEX_NONE; }
+
+	int32 NumRows() const { return Rows.Num(); }
+	int32 NumItems() const { return Items.Num(); }
+	const FMarketStateRow& GetRow(int32 Row) const { return Rows[Row]; }
+
+	/** Item states of a row, in template Inventory order */
+	TArrayView<FMarketItemState> GetItems(int32 Row);
+	TConstArrayView<FMarketItemState> GetItems(int32 Row) const;
+
+	/** Event states of a row, in template ActiveEvents order */
+	TArrayView<FMarketEventState> GetEvents(int32 Row);
+	TConstArrayView<FMarketEventState> GetEvents(int32 Row) const;
+
+	/** State of an item at a market instance, nullptr if the instance has no row or its template does not list the item */
+	FMarketItemState* FindItem(FName InstanceID, const UMarketDataAsset* Template, const UTradeItemDataAsset* Item);
+	const FMarketItemState* FindItem(FName InstanceID, const UMarketDataAsset* Template, const UTradeItemDataAsset* Item) const;
+
+	/** State of an item at a template's primary instance */
+	FMarketItemState* FindItem(const UMarketDataAsset* Market, const UTradeItemDataAsset* Item) { return FindItem(GetMarketKey(Market), Market, Item); }
+	const FMarketItemState* FindItem(const UMarketDataAsset* Market, const UTradeItemDataAsset* Item) const { return FindItem(GetMarketKey(Market), Market, Item); }
+
+	/**
+	 * Current price of an item at a market instance
+	 * Instances without a row price from their template values
+	 */
+	float GetItemPrice(FName InstanceID, const UMarketDataAsset* Template, UTradeItemDataAsset* Item, bool bIsBuying) const;
+
+	/** Current price of an item at a template's primary instance */
+	float GetItemPrice(const UMarketDataAsset* Market, UTradeItemDataAsset* Item, bool bIsBuying) const { return GetItemPrice(GetMarketKey(Market), Market, Item, bIsBuying); }
+
+	/** Recompute every item's EventMultiplier after event states of a row changed */
+	void RefreshEventMultipliers(int32 Row, const UMarketDataAsset* Template);
+
+	/**
+	 * Items whose state differs from a baseline copy of the table
+	 * Rows are matched by MarketID; every item of a row missing from (or
+	 * shaped differently in) the baseline counts as changed.
+	 */
+	void FindChangedItems(const FMarketStateTable& Baseline, TArray<FMarketStateItemRef>& OutChanged) const;
+
+	/** Memory used by the table's arrays */
+	SIZE_T GetAllocatedSize() const;
+
+	friend ADASTREA_API FArchive& operator<<(FArchive& Ar, FMarketStateTable& Table);
+
+private:
+	/** Rebuild RowByID after rows moved */
+	void RebuildRowIndex();
+
+	TArray<FMarketStateRow> Rows;
+	TArray<FMarketItemState> Items;
+	TArray<FMarketEventState> Events;
+
+	/** Instance ID -> row */
+	TMap<FName, int32> RowByID;
+};
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class UMarketDataAsset;
+class FSectorGraph;
+
+/**
+ * Market Travel Matrix
+ *
+ * Cached all-pairs travel distance between markets bound to world positions.
+ * Markets get their position from the marketplace module that hosts them;
+ * cross-sector trips follow the shortest path through the world's
+ * FSectorGraph (owned by USectorGraphSubsystem). A market's sector is found
+ * by a grid-coordinate lookup in the graph, not by testing every sector.
+ *
+ * Distance model:
+ * - Same sector (or either market outside every sector): straight line
+ * - Different sectors: market -> sector center -> shortest sector path -> sector center -> market
+ * - No sector path between the two sectors: Unreachable
+ * - Market without a known position: 0 (treated as co-located, never pruned)
+ *
+ * Only the markets x markets matrix is stored. Adding or moving a market
+ * runs one Dijkstra from its sector and recomputes that market's row and
+ * column (O(markets)). A sector change rebuilds the full matrix lazily on
+ * the next query with one Dijkstra per distinct market sector, so the cost
+ * follows the number of occupied sectors rather than all sector pairs.
+ *
+ * Distances are in Unreal units (cm); divide by a travel speed for time.
+ */
+class ADASTREA_API FMarketTravelMatrix
+{
+public:
+	/** Distance returned for market pairs with no sector path between them */
+	static constexpr float Unreachable = TNumericLimits<float>::Max();
+
+	/** Drop all markets and unbind the sector graph */
+	void Reset();
+
+	/** Route cross-sector trips through a sector graph (nullptr for straight lines only) */
+	void SetSectorGraph(const FSectorGraph* InGraph);
+
+	/** Bind a market to a world position (adds the market or moves it) */
+	void SetMarketLocation(const UMarketDataAsset* Market, const FVector& WorldLocation);
+
+	/** Stop tracking a market's position */
+	void RemoveMarket(const UMarketDataAsset* Market);
+
+	/** Note that sectors were added, moved or removed; every market row is recomputed on the next query */
+	void MarkSectorsDirty() { bSectorsDirty = true; }
+
+	/** Whether a market has a known position */
+	bool HasMarket(const UMarketDataAsset* Market) const { return MarketToSlot.Contains(Market); }
+
+	/**
+	 * Travel distance between two markets
+	 * @return Distance in Unreal units, 0 if either position is unknown, Unreachable if no sector path exists
+	 */
+	float GetDistance(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination) const;
+
+	/** Whether a route between two markets exists within MaxDistance (<= 0 for no limit) */
+	bool IsWithinRange(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination, float MaxDistance) const;
+
+	/**
+	 * Re-resolve market sectors and rebuild every market row if the sector set changed
+	 * Queries do this lazily; call it on the game thread before reading from worker threads
+	 */
+	void UpdateIfDirty() const;
+
+	int32 GetMarketCount() const { return MarketToSlot.Num(); }
+
+private:
+	struct FMarketNode
+	{
+		const UMarketDataAsset* Market = nullptr;
+		FVector Location = FVector::ZeroVector;
+
+		/** Containing sector graph node, INDEX_NONE if outside every sector */
+		int32 Sector = INDEX_NONE;
+	};
+
+	/** Sector graph node containing a position, INDEX_NONE if none */
+	int32 FindSector(const FVector& WorldLocation) const;
+
+	/** Grow the dense matrix so it can hold at least MinStride slots */
+	void ReserveSlots(int32 MinStride) const;
+
+	/**
+	 * Recompute one market's row and column
+	 * @param PathsFromSlot Shortest path lengths from the market's sector to every sector node
+	 */
+	void UpdateMarketRow(int32 Slot, const TArray<float>& PathsFromSlot) const;
+
+	/** Distance between two tracked market slots given the sector paths from SlotA's sector */
+	float ComputeDistance(int32 SlotA, int32 SlotB, const TArray<float>& PathsFromA) const;
+
+	// Market slots (Market == nullptr for freed slots)
+	mutable TArray<FMarketNode> MarketSlots;
+	TArray<int32> FreeMarketSlots;
+	TMap<const UMarketDataAsset*, int32> MarketToSlot;
+
+	/** Graph cross-sector trips are routed through; not owned */
+	const FSectorGraph* SectorGraph = nullptr;
+
+	/** Dijkstra output reused across market rows */
+	mutable TArray<float> SectorPaths;
+
+	/** Market slot x market slot distances (row-major, MatrixStride stride) */
+	mutable TArray<float> Distances;
+	mutable int32 MatrixStride = 0;
+
+	/** Whether market sectors and the full matrix must be rebuilt before the next query */
+	mutable bool bSectorsDirty = false;
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PriceCandleSeries.generated.h"
+
+/**
+ * Candle bucket sizes for market price history
+ */
+UENUM(BlueprintType)
+enum class EPriceCandleResolution : uint8
+{
+	Hour UMETA(DisplayName = "1 Game Hour"),
+	Day UMETA(DisplayName = "1 Game Day"),
+	Week UMETA(DisplayName = "1 Game Week")
+};
+
+/**
+ * OHLC price candle with traded volume for one time bucket
+ */
+USTRUCT(BlueprintType)
+struct ADASTREA_API FPriceCandle
+{
+	GENERATED_BODY()
+
+	// Bucket start in game hours
+	UPROPERTY(BlueprintReadOnly, Category="Price History")
+	float StartTime;
+
+	// First trade price in the bucket
+	UPROPERTY(BlueprintReadOnly, Category="Price History")
+	float Open;
+
+	// Highest trade price in the bucket
+	UPROPERTY(BlueprintReadOnly, Category="Price History")
+	float High;
+
+	// Lowest trade price in the bucket
+	UPROPERTY(BlueprintReadOnly, Category="Price History")
+	float Low;
+
+	// Last trade price in the bucket
+	UPROPERTY(BlueprintReadOnly, Category="Price History")
+	float Close;
+
+	// Units traded
+	UPROPERTY(BlueprintReadOnly, Category="Price History")
+	int32 Volume;
+
+	// Number of trades
+	UPROPERTY(BlueprintReadOnly, Category="Price History")
+	int32 TradeCount;
+
+	// Sum of price * quantity (for volume-weighted prices)
+	UPROPERTY(BlueprintReadOnly, Category="Price History")
+	double TradedValue;
+
+	FPriceCandle()
+		: StartTime(0.0f)
+		, Open(0.0f)
+		, High(0.0f)
+		, Low(0.0f)
+		, Close(0.0f)
+		, Volume(0)
+		, TradeCount(0)
+		, TradedValue(0.0)
+	{}
+
+	/** Volume-weighted average price, or Close if nothing was traded */
+	float GetVolumeWeightedPrice() const
+	{
+		return Volume > 0 ? static_cast<float>(TradedValue / Volume) : Close;
+	}
+};
+
+/**
+ * Fixed-capacity ring of candles for one resolution, oldest first
+ */
+struct ADASTREA_API FPriceCandleRing
+{
+	/** Set the capacity, keeping the newest candles */
+	void SetCapacity(int32 InCapacity);
+
+	/** Fold a trade into the candle for its bucket (opens a new candle when the bucket changes) */
+	void AddTrade(float BucketStart, float Price, int32 Quantity);
+
+	int32 Num() const { return Count; }
+
+	/** Candle by age order (0 = oldest) */
+	const FPriceCandle& Get(int32 Index) const { return Candles[(Head + Index) % Candles.Num()]; }
+
+	/** Newest candle (ring must not be empty) */
+	const FPriceCandle& Last() const { return Get(Count - 1); }
+
+private:
+	TArray<FPriceCandle> Candles;
+
+	/** Slot of the oldest candle */
+	int32 Head = 0;
+	int32 Count = 0;
+};
+
+/**
+ * Candle history of one item at one market at every resolution
+ *
+ * Every trade is folded into the current candle of each resolution, so a
+ * day or week candle always equals the hour candles it spans merged
+ * together. Buckets without trades produce no candle; each resolution keeps
+ * at most its capacity, so memory does not grow with session length.
+ */
+struct ADASTREA_API FPriceCandleSeries
+{
+	/** Number of EPriceCandleResolution values */
+	static constexpr int32 NumResolutions = 3;
+
+	/** Bucket length in game hours */
+	static float GetBucketHours(EPriceCandleResolution Resolution);
+
+	/** Set per-resolution capacities (Hour, Day, Week) */
+	void SetCapacities(int32 HourCandles, int32 DayCandles, int32 WeekCandles);
+
+	/** Record one trade at a game time in hours */
+	void AddTrade(float GameTimeHours, float Price, int32 Quantity);
+
+	const FPriceCandleRing& GetRing(EPriceCandleResolution Resolution) const { return Rings[static_cast<int32>(Resolution)]; }
+
+	/** Copy the newest MaxCount candles (<= 0 for all), oldest first */
+	void GetCandles(EPriceCandleResolution Resolution, int32 MaxCount, TArray<FPriceCandle>& OutCandles) const;
+
+	/** Volume-weighted price over the newest Buckets candles, 0 if none */
+	float GetVolumeWeightedPrice(EPriceCandleResolution Resolution, int32 Buckets) const;
+
+	/** Relative change from the open of the oldest to the close of the newest of the last Buckets candles */
+	float GetPriceTrend(EPriceCandleResolution Resolution, int32 Buckets) const;
+
+private:
+	FPriceCandleRing Rings[NumResolutions];
+};
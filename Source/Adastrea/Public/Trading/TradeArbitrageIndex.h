@@ -0,0 +1,218 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trading/AITraderComponent.h"
+
+// Forward declarations
+class UMarketDataAsset;
+class UTradeItemDataAsset;
+class FReferenceCollector;
+struct FMarketStateTable;
+
+/**
+ * Indexed binary heap of (key, price) pairs
+ *
+ * Keys are small dense integers (market or item slots). A key->position
+ * table makes update and removal of an arbitrary key O(log N), so a single
+ * price change only touches the heap entry that moved.
+ */
+struct ADASTREA_API FArbitragePriceHeap
+{
+	explicit FArbitragePriceHeap(bool bInMaxHeap = false)
+		: bMaxHeap(bInMaxHeap)
+	{}
+
+	/**
+	 * Insert a key or update its value
+	 * @return True if the heap changed (new key or different value)
+	 */
+	bool Set(int32 Key, float Value);
+
+	/**
+	 * Remove a key if present
+	 * @return True if the key was in the heap
+	 */
+	bool Remove(int32 Key);
+
+	bool Contains(int32 Key) const { return KeyPositions.IsValidIndex(Key) && KeyPositions[Key] != INDEX_NONE; }
+	bool IsEmpty() const { return HeapKeys.Num() == 0; }
+	int32 Num() const { return HeapKeys.Num(); }
+	void Reset();
+
+	/** Key at the top of the heap (lowest price for a min heap, highest for a max heap) */
+	int32 TopKey() const { return HeapKeys[0]; }
+	float TopValue() const { return HeapValues[0]; }
+
+	/**
+	 * Visit entries in priority order without modifying the heap
+	 * Costs O(V log V) for V visited entries, independent of heap size
+	 * @param Visitor Called with (Key, Value); return false to stop
+	 */
+	void ForEachOrdered(TFunctionRef<bool(int32 Key, float Value)> Visitor) const;
+
+private:
+	bool Before(float A, float B) const { return bMaxHeap ? A > B : A < B; }
+	void SiftUp(int32 Position);
+	void SiftDown(int32 Position);
+	void SwapPositions(int32 A, int32 B);
+
+	// Heap storage (parallel arrays)
+	TArray<int32> HeapKeys;
+	TArray<float> HeapValues;
+
+	/** Key -> heap position, INDEX_NONE when absent */
+	TArray<int32> KeyPositions;
+
+	bool bMaxHeap;
+};
+
+/**
+ * Per-query constraints for route search
+ * Mirrors the checks UAITraderComponent applies in its own search
+ */
+struct ADASTREA_API FArbitrageRouteFilter
+{
+	/** Only use AllowedMarkets; otherwise every indexed market is allowed */
+	bool bRestrictToAllowedMarkets = false;
+
+	/** Markets the trader may use when restricted (empty = no routes) */
+	TArray<UMarketDataAsset*> AllowedMarkets;
+
+	/** Skip origins where one unit costs more than this */
+	float MaxBuyPrice = TNumericLimits<float>::Max();
+
+	/** Minimum profit per unit relative to buy price */
+	float MinProfitMargin = 0.0f;
+
+	/**
+	 * Optional origin -> destination test (e.g. travel range or sector reachability)
+	 * Unset = every pair is reachable
+	 */
+	TFunction<bool(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination)> IsRouteReachable;
+};
+
+/**
+ * Trade Arbitrage Index
+ *
+ * Shared best-buy/best-sell book for every (market, item) pair.
+ * Each item keeps a min-heap of buy prices (markets with the item in stock)
+ * and a max-heap of sell prices (markets that list the item); a global
+ * max-heap ranks items by their best unconstrained spread.
+ *
+ * Updates are incremental: a transaction refreshes one (market, item) pair
+ * in O(log N), and an economy tick only re-sifts prices that actually moved.
+ * Route queries walk the item heap in spread order and stop as soon as the
+ * remaining upper bound cannot beat the current top K, so a query costs
+ * O(K log N) in the common case instead of O(markets^2 x items) per trader.
+ *
+ * Prices are read from the live market state table (template prices when none
+ * is set), so ranking matches what a trader would pay and receive. Routes are
+ * ranked by profit per unit.
+ */
+class ADASTREA_API FTradeArbitrageIndex
+{
+public:
+	/** Drop all markets and items */
+	void Reset();
+
+	/** Live market state to read prices and stock from (nullptr reads market templates) */
+	void SetMarketStates(const FMarketStateTable* InMarketStates) { MarketStates = InMarketStates; }
+
+	/** Rebuild the whole index from a market set */
+	void Rebuild(const TArray<UMarketDataAsset*>& Markets);
+
+	/** Start tracking a market and index its inventory */
+	void AddMarket(UMarketDataAsset* Market);
+
+	/** Stop tracking a market and remove its prices from every item book */
+	void RemoveMarket(UMarketDataAsset* Market);
+
+	/** Re-read prices for one (market, item) pair, e.g. after a transaction */
+	void RefreshMarketItem(UMarketDataAsset* Market, UTradeItemDataAsset* Item);
+
+	/**
+	 * Re-read every tracked price, e.g. after an economy tick
+	 * Only prices that changed are re-sifted
+	 * @return Number of (market, item) prices that changed
+	 */
+	int32 RefreshAll();
+
+	/**
+	 * Re-read the prices of the markets a predicate selects, e.g. the rows an economy tick changed
+	 * Only prices that changed are re-sifted
+	 * @return Number of (market, item) prices that changed
+	 */
+	int32 RefreshMarkets(TFunctionRef<bool(const UMarketDataAsset*)> ShouldRefresh);
+
+	/**
+	 * Find the most profitable routes (best route per item)
+	 * @param MaxRoutes Number of routes to return
+	 * @param Filter Trader constraints
+	 * @param OutRoutes Routes sorted by profit per unit, best first
+	 */
+	void FindTopRoutes(int32 MaxRoutes, const FArbitrageRouteFilter& Filter, TArray<FTradeRoute>& OutRoutes) const;
+
+	int32 GetMarketCount() const { return MarketToSlot.Num(); }
+	int32 GetItemCount() const { return ItemToSlot.Num(); }
+
+	/** Report indexed markets and items to the GC; the owner must call this while the index is in use */
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
+private:
+	/** Buy/sell books for one item, keyed by market slot */
+	struct FItemBook
+	{
+		FItemBook()
+			: BuyPrices(false)
+			, SellPrices(true)
+		{}
+
+		FArbitragePriceHeap BuyPrices;
+		FArbitragePriceHeap SellPrices;
+	};
+
+	/** Market and item slots of a candidate route */
+	struct FRouteCandidate
+	{
+		int32 OriginSlot = INDEX_NONE;
+		int32 DestinationSlot = INDEX_NONE;
+		float BuyPrice = 0.0f;
+		float SellPrice = 0.0f;
+	};
+
+	int32 FindOrAddItemSlot(UTradeItemDataAsset* Item);
+
+	/** Write current prices for one pair; returns true if either heap changed */
+	bool UpdatePrices(int32 MarketSlot, int32 ItemSlot);
+
+	/** Recompute an item's best unconstrained spread in the item heap */
+	void UpdateItemSpread(int32 ItemSlot);
+
+	/**
+	 * Best route for one item under a filter
+	 * Without a reachability test the two best markets on each side are enough;
+	 * with one, origins are walked cheapest first and destinations best first
+	 * until the remaining spread cannot beat the best reachable pair
+	 * @param AllowedSlots Market slot mask, or nullptr for no restriction
+	 */
+	bool FindBestRouteForItem(int32 ItemSlot, const TBitArray<>* AllowedSlots, const FArbitrageRouteFilter* Filter, FRouteCandidate& OutCandidate) const;
+
+	/** FindBestRouteForItem path for filters with a reachability test */
+	bool FindBestReachableRouteForItem(const FItemBook& Book, TFunctionRef<bool(int32)> IsAllowed, float MaxBuyPrice, const FArbitrageRouteFilter& Filter, FRouteCandidate& OutCandidate) const;
+
+	// Market slots (nullptr for freed slots)
+	TArray<TObjectPtr<UMarketDataAsset>> MarketSlots;
+	TArray<int32> FreeMarketSlots;
+	TMap<UMarketDataAsset*, int32> MarketToSlot;
+
+	// Item slots and per-item books
+	TArray<TObjectPtr<UTradeItemDataAsset>> ItemSlots;
+	TMap<UTradeItemDataAsset*, int32> ItemToSlot;
+	TArray<FItemBook> Books;
+
+	/** Items ranked by best unconstrained spread (max heap) */
+	FArbitragePriceHeap ItemSpreads = FArbitragePriceHeap(true);
+
+	/** Live market state, not owned */
+	const FMarketStateTable* MarketStates = nullptr;
+};
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Trading/TradeArbitrageIndex.h"
+#include "Trading/MarketTravelMatrix.h"
+#include "TradeArbitrageSubsystem.generated.h"
+
+// Forward declarations
+class UEconomyManager;
+class UMarketDataAsset;
+class UTradeItemDataAsset;
+class AMarketplaceModule;
+class ASpaceSectorMap;
+
+/**
+ * Trade Arbitrage Subsystem
+ *
+ * World-level arbitrage service shared by every AI trader.
+ * Keeps an FTradeArbitrageIndex of best buy/sell markets per item in sync
+ * with the EconomyManager, so traders query top routes instead of each one
+ * re-pricing every market pair on its own.
+ *
+ * Features:
+ * - Tracks all markets registered with the EconomyManager
+ * - Refreshes a single (market, item) pair after each transaction
+ * - Re-reads only the markets an economy tick changed, per the published snapshot versions
+ * - Top-K route queries with per-trader filters (known markets, capital, margin, range)
+ * - Cached market-to-market travel distances from marketplace positions and the sector graph
+ *
+ * Usage:
+ * - Access via UWorld::GetSubsystem<UTradeArbitrageSubsystem>()
+ * - Call FindTopRoutes() from C++ or GetTopTradeRoutes() from Blueprint
+ *
+ * Integration:
+ * - UAITraderComponent::FindBestTradeRoutes uses this when available
+ * - Listens to UEconomyManager market/transaction/tick events
+ * - AMarketplaceModule and ASpaceSectorMap register themselves on BeginPlay/EndPlay
+ */
+UCLASS()
+class ADASTREA_API UTradeArbitrageSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ====================
+	// SUBSYSTEM LIFECYCLE
+	// ====================
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Keeps markets and items held by the index alive */
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	// ====================
+	// ROUTE QUERIES
+	// ====================
+
+	/**
+	 * Get the most profitable routes across all tracked markets
+	 * @param MaxRoutes Number of routes to return
+	 * @return Best route per item, sorted by profit per unit
+	 */
+	UFUNCTION(BlueprintCallable, Category="Trading|Arbitrage")
+	TArray<FTradeRoute> GetTopTradeRoutes(int32 MaxRoutes = 10) const;
+
+	/**
+	 * Find the most profitable routes that satisfy a trader's constraints
+	 * @param MaxRoutes Number of routes to return
+	 * @param Filter Known markets, capital and margin constraints
+	 * @param OutRoutes Routes sorted by profit per unit, best first
+	 */
+	void FindTopRoutes(int32 MaxRoutes, const FArbitrageRouteFilter& Filter, TArray<FTradeRoute>& OutRoutes) const;
+
+	/**
+	 * Rebuild the index from the EconomyManager's registered markets
+	 * Only needed after bulk changes made outside the EconomyManager
+	 */
+	UFUNCTION(BlueprintCallable, Category="Trading|Arbitrage")
+	void RebuildIndex();
+
+	/** Number of markets currently tracked */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Trading|Arbitrage")
+	int32 GetTrackedMarketCount() const { return Index.GetMarketCount(); }
+
+	// ====================
+	// TRAVEL DISTANCES
+	// ====================
+
+	/**
+	 * Bind a marketplace's market to the marketplace's world position
+	 * If several marketplaces share one market asset, the first registered one defines its position
+	 */
+	void RegisterMarketplace(AMarketplaceModule* Marketplace);
+
+	/** Remove a marketplace; its market moves to the next marketplace sharing it, if any */
+	void UnregisterMarketplace(AMarketplaceModule* Marketplace);
+
+	/** Sector added or moved; travel distances are recomputed from the sector graph on the next query */
+	void RegisterSector(ASpaceSectorMap* Sector);
+
+	/** Sector removed; travel distances are recomputed from the sector graph on the next query */
+	void UnregisterSector(ASpaceSectorMap* Sector);
+
+	/**
+	 * Travel distance between two markets
+	 * @return Distance in Unreal units, 0 if either market has no known position,
+	 *         FMarketTravelMatrix::Unreachable if no sector path connects them
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Trading|Arbitrage")
+	float GetMarketDistance(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination) const;
+
+	/**
+	 * Check whether a destination can be reached from an origin
+	 * @param MaxDistance Maximum travel distance (0 = only require a sector path)
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Trading|Arbitrage")
+	bool IsMarketInRange(const UMarketDataAsset* Origin, const UMarketDataAsset* Destination, float MaxDistance = 0.0f) const;
+
+	/** Cached travel distances between positioned markets */
+	const FMarketTravelMatrix& GetTravelMatrix() const { return TravelMatrix; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// Economy event handlers
+	UFUNCTION()
+	void HandleMarketRegistered(UMarketDataAsset* Market);
+
+	UFUNCTION()
+	void HandleMarketUnregistered(UMarketDataAsset* Market);
+
+	UFUNCTION()
+	void HandleMarketItemUpdated(UMarketDataAsset* Market, UTradeItemDataAsset* Item);
+
+	UFUNCTION()
+	void HandleEconomyUpdated(float GameTime);
+
+	/** Economy this index mirrors */
+	UPROPERTY()
+	UEconomyManager* EconomyManager;
+
+	/** Best buy/sell book for every tracked (market, item) pair */
+	FTradeArbitrageIndex Index;
+
+	/** Economy snapshot version the index last caught up with */
+	uint64 LastSeenSnapshotVersion = 0;
+
+	/** Marketplaces currently placed in the world, in registration order */
+	UPROPERTY()
+	TArray<AMarketplaceModule*> Marketplaces;
+
+	/** Travel distances between marketplace positions */
+	FMarketTravelMatrix TravelMatrix;
+};
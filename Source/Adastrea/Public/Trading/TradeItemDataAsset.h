@@ -7,6 +7,16 @@
 // Forward declarations
 class UMaterialDataAsset;
 
+namespace TradePricing
+{
+	/**
+	 * Whether a class overrides a pricing BlueprintNativeEvent of NativeBase
+	 * True when a Blueprint implements the event, or when a native subclass of
+	 * NativeBase may override its _Implementation.
+	 */
+	ADASTREA_API bool IsPriceEventOverridden(const UClass* Class, const UClass* NativeBase, FName EventName);
+}
+
 /**
  * Enum for trade item categories
  * Categorizes items for market filtering and AI behavior
@@ -250,6 +260,12 @@ class ADASTREA_API UTradeItemDataAsset : public UPrimaryDataAsset
 	UFUNCTION(BlueprintNativeEvent, Category="Trade Item|Events")
 	float OnCalculateCustomPrice(float Supply, float Demand, float EventMultiplier, float BaseCalculatedPrice) const;
 
+	/**
+	 * Whether pricing has to call OnCalculateCustomPrice
+	 * False for items whose class does not override it, letting markets skip the Blueprint VM
+	 */
+	bool HasCustomPriceOverride() const { return bHasCustomPriceOverride; }
+
 	/**
 	 * BlueprintNativeEvent: Called when this item is traded
 	 * Allows designers to trigger custom events on trade
@@ -261,6 +277,13 @@ class ADASTREA_API UTradeItemDataAsset : public UPrimaryDataAsset
 	// REMOVED: OnItemTraded event - faction tracking removed per Trade Simulator MVP
 	// Can be re-added post-MVP if needed for analytics
 
+	// ====================
+	// UObject Interface
+	// ====================
+
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+
 #if WITH_EDITOR
 	/**
 	 * Validate trade item data asset properties
@@ -268,4 +291,10 @@ class ADASTREA_API UTradeItemDataAsset : public UPrimaryDataAsset
 	 */
 	virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
 #endif
+
+private:
+	/** Cached per class on init/load (see TradePricing::IsPriceEventOverridden) */
+	bool bHasCustomPriceOverride;
+
+	void DetectPriceOverride();
 };
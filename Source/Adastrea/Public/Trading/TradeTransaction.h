@@ -163,9 +163,55 @@ struct ADASTREA_API FTradeTransaction
 	{}
 };
 
+/**
+ * Secondary index over the transaction ring buffer
+ * Sequence numbers are appended in recording order and evicted from the
+ * front, with inclusive prefix sums so range aggregates cost O(log N)
+ */
+struct FTradeTransactionIndexList
+{
+	/** Transaction sequence numbers, oldest first (live entries start at First) */
+	TArray<int64> Sequences;
+
+	/** Timestamps of the indexed transactions (for range searches) */
+	TArray<float> Timestamps;
+
+	// Inclusive prefix sums of quantity, quantity * price and price
+	TArray<double> CumQuantity;
+	TArray<double> CumValue;
+	TArray<double> CumPrice;
+
+	/** First live entry; earlier entries were evicted and are compacted lazily */
+	int32 First = 0;
+
+	int32 Num() const { return Sequences.Num() - First; }
+};
+
+/**
+ * Running aggregates for one trader
+ */
+struct FTradeTraderAggregate
+{
+	/** Sell value minus buy value, matching GetPlayerProfitLoss */
+	int64 NetValue = 0;
+
+	/** Live transactions involving this trader */
+	int32 TransactionCount = 0;
+};
+
 /**
  * Transaction History Manager
  * Tracks and queries transaction history
+ *
+ * History is an append-only ring buffer of MaxHistorySize transactions, so
+ * recording never sorts or shifts: once full, the oldest entry is overwritten.
+ * Per-item, per-market and per-trader indexes hold sequence numbers in
+ * recording order with prefix sums, so lookups cost O(matches) and volume,
+ * average price and VWAP over a time range cost O(log N).
+ *
+ * Time-range searches assume transactions are recorded in timestamp order
+ * (game time only moves forward); if an older timestamp is ever recorded the
+ * manager falls back to scanning the relevant index until ClearHistory().
  */
 UCLASS(BlueprintType)
 class ADASTREA_API UTradeTransactionManager : public UObject
@@ -174,30 +220,20 @@ class ADASTREA_API UTradeTransactionManager : public UObject
 
 public:
 	// ====================
-	// TRANSACTION HISTORY
+	// Constructor
 	// ====================
 
-	// All recorded transactions
-	UPROPERTY(BlueprintReadWrite, Category="Transaction History")
-	TArray<FTradeTransaction> TransactionHistory;
+	UTradeTransactionManager();
 
-	// Maximum history size (older transactions are removed)
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Transaction History", meta=(ClampMin="100"))
-	int32 MaxHistorySize;
-
-private:
-	// Performance optimization: cached latest timestamp
-	// Updated when transactions are recorded to avoid scanning entire history
-	float CachedLatestTimestamp;
-	
-	// Track if cache needs invalidation
-	bool bCacheValid;
+	virtual void PostLoad() override;
 
 	// ====================
-	// Constructor
+	// TRANSACTION HISTORY
 	// ====================
 
-	UTradeTransactionManager();
+	// Maximum history size (older transactions are removed)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Transaction History", meta=(ClampMin="100"))
+	int32 MaxHistorySize;
 
 	// ====================
 	// Blueprint Callable Functions
@@ -210,6 +246,19 @@ class ADASTREA_API UTradeTransactionManager : public UObject
 	UFUNCTION(BlueprintCallable, Category="Transaction History")
 	void RecordTransaction(const FTradeTransaction& Transaction);
 
+	/**
+	 * Get all recorded transactions, oldest first
+	 * @return Copy of the retained history
+	 */
+	UFUNCTION(BlueprintCallable, Category="Transaction History")
+	TArray<FTradeTransaction> GetTransactionHistory() const;
+
+	/**
+	 * Get the number of retained transactions
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Transaction History")
+	int32 GetTransactionCount() const { return NumTransactions; }
+
 	/**
 	 * Get all transactions for a specific item
 	 * @param ItemID The item to search for
@@ -228,6 +277,28 @@ class ADASTREA_API UTradeTransactionManager : public UObject
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Transaction History|Analytics")
 	float GetAveragePrice(FName ItemID, float StartTime, float EndTime) const;
 
+	/**
+	 * Calculate volume-weighted average price for an item over time
+	 * @param ItemID The item to calculate for
+	 * @param StartTime Start of time range
+	 * @param EndTime End of time range
+	 * @return Total value / total quantity, or 0 if nothing was traded
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Transaction History|Analytics")
+	float GetVolumeWeightedAveragePrice(FName ItemID, float StartTime, float EndTime) const;
+
+	/**
+	 * Total quantity traded for an item across the retained history (O(1))
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Transaction History|Analytics")
+	int32 GetItemTradeVolume(FName ItemID) const;
+
+	/**
+	 * Volume-weighted average price for an item across the retained history (O(1))
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Transaction History|Analytics")
+	float GetItemVolumeWeightedPrice(FName ItemID) const;
+
 	/**
 	 * Get total player profit/loss
 	 * @param PlayerID The player to calculate for
@@ -242,6 +313,29 @@ class ADASTREA_API UTradeTransactionManager : public UObject
 	UFUNCTION(BlueprintCallable, Category="Transaction History")
 	void ClearHistory();
 
+	// ====================
+	// SERIALIZATION
+	// ====================
+
+	/**
+	 * Export the retained history, oldest first, to a binary trade archive
+	 * @param FilePath Destination file (overwritten)
+	 * @return True if the archive was written
+	 * @see FTradeTransactionArchiveWriter
+	 */
+	UFUNCTION(BlueprintCallable, Category="Transaction History|Serialization")
+	bool ExportToFile(const FString& FilePath) const;
+
+	/**
+	 * Record every transaction of a binary trade archive, in file order
+	 * Items and markets are resolved through the asset registry; only the
+	 * newest MaxHistorySize transactions are retained
+	 * @param FilePath Archive written by ExportToFile
+	 * @return True if the whole archive was read
+	 */
+	UFUNCTION(BlueprintCallable, Category="Transaction History|Serialization")
+	bool ImportFromFile(const FString& FilePath);
+
 private:
 	/**
 	 * Get all transactions at a specific market
@@ -279,18 +373,75 @@ class ADASTREA_API UTradeTransactionManager : public UObject
 	 */
 	TArray<FName> GetMostTradedItems(int32 Count, float StartTime, float EndTime) const;
 
-	/**
-	 * Export transaction history to string (for save/load)
-	 * Internal serialization function
-	 */
-	FString ExportToString() const;
+	// ====================
+	// RING BUFFER
+	// ====================
+
+	/** Transaction stored for a sequence number */
+	const FTradeTransaction& GetBySequence(int64 Sequence) const { return TransactionHistory[static_cast<int32>(Sequence % HistoryCapacity)]; }
+
+	/** Sequence number of the oldest retained transaction */
+	int64 GetOldestSequence() const { return NextSequence - NumTransactions; }
+
+	/** Resize the ring to MaxHistorySize, keeping the newest transactions */
+	void ResizeHistory();
+
+	/** Drop the oldest transaction from the ring and every index */
+	void EvictOldest();
+
+	/** Add a transaction to the indexes and aggregates */
+	void IndexTransaction(const FTradeTransaction& Transaction, int64 Sequence);
+
+	/** Remove the oldest entries of the indexes and aggregates for an evicted transaction */
+	void UnindexTransaction(const FTradeTransaction& Transaction);
+
+	/** Rebuild every index from the ring contents */
+	void RebuildIndexes();
+
+	/** Copy the transactions of an index list, oldest first */
+	TArray<FTradeTransaction> CollectTransactions(const FTradeTransactionIndexList* List) const;
 
 	/**
-	 * Import transaction history from string
-	 * Internal serialization function
+	 * Live index entry range [OutBegin, OutEnd) with StartTime <= Timestamp <= EndTime
+	 * Only valid while timestamps are ordered
 	 */
-	bool ImportFromString(const FString& Data);
+	void FindTimeRange(const FTradeTransactionIndexList& List, float StartTime, float EndTime, int32& OutBegin, int32& OutEnd) const;
+
+	/** Sum quantity, value and price over a time range of an index list */
+	void SumTimeRange(const FTradeTransactionIndexList& List, float StartTime, float EndTime, double& OutQuantity, double& OutValue, double& OutPrice, int32& OutCount) const;
+
+	/** Item ID used as the index key for a transaction */
+	static FName GetItemKey(const FTradeTransaction& Transaction);
+
+	// All recorded transactions (ring storage, slot = sequence % HistoryCapacity)
+	UPROPERTY()
+	TArray<FTradeTransaction> TransactionHistory;
+
+	/** Ring capacity the stored slots were laid out for */
+	UPROPERTY()
+	int32 HistoryCapacity;
+
+	/** Sequence number the next recorded transaction receives */
+	UPROPERTY()
+	int64 NextSequence;
+
+	/** Number of retained transactions */
+	UPROPERTY()
+	int32 NumTransactions;
+
+	// Secondary indexes
+	TMap<FName, FTradeTransactionIndexList> ItemIndex;
+	TMap<UMarketDataAsset*, FTradeTransactionIndexList> MarketIndex;
+	TMap<FName, FTradeTransactionIndexList> TraderIndex;
+	TMap<FName, FTradeTraderAggregate> TraderAggregates;
+
+	// Performance optimization: cached latest timestamp
+	// Updated when transactions are recorded to avoid scanning entire history
+	float CachedLatestTimestamp;
+	
+	// Track if cache needs invalidation
+	bool bCacheValid;
 
-	// Prune old transactions if history exceeds max size
-	void PruneOldTransactions();
+	/** Whether every retained transaction was recorded in timestamp order */
+	bool bTimestampsOrdered;
 };
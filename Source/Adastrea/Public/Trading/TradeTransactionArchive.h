@@ -0,0 +1,205 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trading/TradeTransaction.h"
+
+// Forward declarations
+class FArchive;
+class IMappedFileHandle;
+class IMappedFileRegion;
+class UTradeItemDataAsset;
+class UMarketDataAsset;
+
+/**
+ * Trade Transaction Archive
+ *
+ * Versioned, compressed columnar binary format for FTradeTransaction history.
+ *
+ * File layout (little-endian):
+ * - Header: magic "ADTX", version, compression format, row count, rows per block, block count
+ * - Blocks of up to RowsPerBlock rows, each holding one compressed buffer per column
+ *
+ * Encoding:
+ * - Names (item IDs, traders, factions, events) and asset paths are
+ *   dictionary-encoded; each block carries only the entries it introduces
+ * - Timestamps are delta-encoded per block (float bit patterns and
+ *   FDateTime ticks) as zigzag varints
+ * - Integers are zigzag varints; floats and vectors are stored raw
+ *
+ * The writer streams blocks to disk as they fill, so memory stays bounded
+ * by one block. The reader memory-maps the file (falling back to a full
+ * read if mapping is unavailable) and decodes one block at a time.
+ */
+namespace TradeTransactionArchive
+{
+	/** File magic ("ADTX") */
+	constexpr uint32 Magic = 0x58544441;
+
+	/** Current format version */
+	constexpr uint16 Version = 1;
+
+	/** Default rows per block */
+	constexpr int32 DefaultRowsPerBlock = 65536;
+
+	/** Block compression formats */
+	enum class ECompression : uint8
+	{
+		None = 0,
+		Zlib = 1,
+		Oodle = 2
+	};
+}
+
+/**
+ * Resolves archived asset references back to loaded assets
+ *
+ * Items are looked up by object path first (already loaded objects, then
+ * the asset registry); if the path no longer exists, the asset registry is
+ * scanned once for UTradeItemDataAsset assets and matched by ItemID.
+ */
+class ADASTREA_API FTradeTransactionAssetResolver
+{
+public:
+	UTradeItemDataAsset* ResolveItem(FName ItemID, const FString& ObjectPath);
+	UMarketDataAsset* ResolveMarket(const FString& ObjectPath);
+
+private:
+	/** Load an object by path from memory or the asset registry */
+	static UObject* ResolvePath(const FString& ObjectPath);
+
+	/** Build ItemsByID from every trade item asset in the registry */
+	void ScanItems();
+
+	TMap<FName, UTradeItemDataAsset*> ItemsByID;
+	bool bItemsScanned = false;
+};
+
+/**
+ * Streaming writer for trade transaction archives
+ *
+ * Usage:
+ * @code
+ * FTradeTransactionArchiveWriter Writer;
+ * if (Writer.Open(FilePath))
+ * {
+ *     for (const FTradeTransaction& Transaction : Transactions) { Writer.Write(Transaction); }
+ *     Writer.Close();
+ * }
+ * @endcode
+ */
+class ADASTREA_API FTradeTransactionArchiveWriter
+{
+public:
+	explicit FTradeTransactionArchiveWriter(int32 InRowsPerBlock = TradeTransactionArchive::DefaultRowsPerBlock,
+		TradeTransactionArchive::ECompression InCompression = TradeTransactionArchive::ECompression::Oodle);
+	~FTradeTransactionArchiveWriter();
+
+	/** Create the file and write a placeholder header */
+	bool Open(const FString& FilePath);
+
+	/** Append one transaction; a block is flushed to disk each time RowsPerBlock rows are buffered */
+	void Write(const FTradeTransaction& Transaction);
+
+	/** Flush the last block, patch the header and close the file */
+	bool Close();
+
+	bool IsOpen() const { return FileWriter.IsValid(); }
+	int64 GetNumRows() const { return NumRows; }
+
+private:
+	/** Column buffers for the block being built */
+	struct FBlockColumns;
+
+	void FlushBlock();
+	void WriteHeader();
+
+	uint32 FindOrAddName(FName Name);
+
+	TUniquePtr<FArchive> FileWriter;
+	TUniquePtr<FBlockColumns> Columns;
+
+	int32 RowsPerBlock;
+	TradeTransactionArchive::ECompression Compression;
+
+	int64 NumRows = 0;
+	int32 NumBlocks = 0;
+	int32 RowsInBlock = 0;
+	bool bError = false;
+
+	// Dictionaries (index + 1 is stored, 0 means none)
+	TMap<FName, uint32> NameIndices;
+	TMap<const UTradeItemDataAsset*, uint32> ItemIndices;
+	TMap<const UMarketDataAsset*, uint32> MarketIndices;
+
+	// Running delta bases (reset every block)
+	uint32 PreviousTimestampBits = 0;
+	int64 PreviousRealTicks = 0;
+};
+
+/**
+ * Memory-mapped reader for trade transaction archives
+ *
+ * Usage:
+ * @code
+ * FTradeTransactionArchiveReader Reader;
+ * TArray<FTradeTransaction> Rows;
+ * if (Reader.Open(FilePath))
+ * {
+ *     while (Reader.ReadNextBlock(Rows)) { ... }
+ * }
+ * @endcode
+ */
+class ADASTREA_API FTradeTransactionArchiveReader
+{
+public:
+	FTradeTransactionArchiveReader();
+	~FTradeTransactionArchiveReader();
+
+	/** Map the file and validate its header */
+	bool Open(const FString& FilePath);
+
+	/** Release the mapping */
+	void Close();
+
+	/**
+	 * Decode the next block
+	 * @param OutRows Receives the block's rows (storage is reused between calls)
+	 * @return False at the end of the file or on a corrupt block (see HasError)
+	 */
+	bool ReadNextBlock(TArray<FTradeTransaction>& OutRows);
+
+	int64 GetNumRows() const { return NumRows; }
+	bool HasError() const { return bError; }
+
+	/** Asset resolver used for item and market references */
+	FTradeTransactionAssetResolver& GetResolver() { return Resolver; }
+
+private:
+	bool ReadDictionary(const uint8* Data, int32 Size);
+
+	// File data (mapped region or fallback buffer)
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray<uint8> FallbackData;
+	const uint8* FileData = nullptr;
+	int64 FileSize = 0;
+	int64 Offset = 0;
+
+	TradeTransactionArchive::ECompression Compression = TradeTransactionArchive::ECompression::None;
+	int64 NumRows = 0;
+	int32 RowsPerBlock = 0;
+	int32 NumBlocks = 0;
+	int32 BlocksRead = 0;
+	int64 RowsRead = 0;
+	bool bError = false;
+
+	// Dictionaries accumulated across blocks
+	TArray<FName> Names;
+	TArray<UTradeItemDataAsset*> Items;
+	TArray<UMarketDataAsset*> Markets;
+
+	/** Decompression scratch, one buffer per column */
+	TArray<TArray<uint8>> ColumnBuffers;
+
+	FTradeTransactionAssetResolver Resolver;
+};
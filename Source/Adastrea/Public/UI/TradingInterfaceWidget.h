@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
 #include "Trading/TradeItemDataAsset.h"
+#include "Trading/PriceCandleSeries.h"
 #include "TradingInterfaceWidget.generated.h"
 
 // Forward declarations
@@ -186,6 +187,16 @@ class ADASTREA_API UTradingInterfaceWidget : public UUserWidget
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Trading")
 	int32 GetItemPrice(UTradeItemDataAsset* Item, int32 Quantity) const;
 
+	/**
+	 * Get recent price candles for an item at current market (for price charts)
+	 * @param Item The item to chart
+	 * @param Resolution Candle size
+	 * @param MaxCandles Number of candles, newest last
+	 * @return Candles oldest first (empty if the item has not been traded here)
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Trading")
+	TArray<FPriceCandle> GetItemPriceHistory(UTradeItemDataAsset* Item, EPriceCandleResolution Resolution, int32 MaxCandles) const;
+
 	/**
 	 * Get player's current credits
 	 * @return Player credits
@@ -348,9 +359,15 @@ class ADASTREA_API UTradingInterfaceWidget : public UUserWidget
 	/** Unbind from component events */
 	void UnbindComponentEvents();
 
+	/** Periodic refresh: rebuild only if the economy published a change to the current market */
+	void RefreshMarketDisplayIfChanged();
+
 	/** Timer handle for periodic updates */
 	FTimerHandle UpdateTimer;
 
+	/** Economy snapshot version the displayed inventory was built from */
+	int64 DisplayedSnapshotVersion = 0;
+
 protected:
 	/** Callback for player credits changed */
 	UFUNCTION()
@@ -199,7 +199,7 @@ class ADASTREA_API UUniverseMapWidget : public UUserWidget
 
 	/**
 	 * Find path between two sectors
-	 * Simple A* pathfinding through sector grid
+	 * Shortest route over grid-adjacent sectors via USectorGraphSubsystem
 	 * @param StartSector Starting sector
 	 * @param EndSector Destination sector
 	 * @return Array of sectors forming the path, empty if no path found
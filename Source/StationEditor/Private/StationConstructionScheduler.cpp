@@ -0,0 +1,448 @@
+// Copyright (c) 2025 Mittenzx. Licensed under MIT.
+
+#include "StationConstructionScheduler.h"
+#include "Stations/SpaceStation.h"
+#include "Stations/SpaceStationModule.h"
+#include "Stations/FabricationModule.h"
+#include "AdastreaLog.h"
+#include "Engine/World.h"
+
+UStationConstructionScheduler::UStationConstructionScheduler()
+	: NextQueueId(1)
+	, ActiveBuildCount(0)
+	, SlotsPerFabricationModule(DefaultSlotsPerFabricationModule)
+	, ResourceCheckInterval(DefaultResourceCheckInterval)
+	, RefreshCursor(0)
+	, RefreshCarry(0.0)
+{
+	// Build while the station produces at least as much power as it uses
+	ResourceGate = [](const ASpaceStation* Station)
+	{
+		return Station->GetPowerBalance() >= 0.0f;
+	};
+}
+
+bool UStationConstructionScheduler::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStationConstructionScheduler::Deinitialize()
+{
+	Orders.Reset();
+	FreeOrders.Reset();
+	OrderIndices.Reset();
+	Sites.Reset();
+	SiteIndices.Reset();
+	CompletionHeap.Reset();
+	ActiveBuildCount = 0;
+	RefreshCursor = 0;
+	RefreshCarry = 0.0;
+
+	Super::Deinitialize();
+}
+
+TStatId UStationConstructionScheduler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UStationConstructionScheduler, STATGROUP_Tickables);
+}
+
+double UStationConstructionScheduler::GetNow() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UStationConstructionScheduler::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const double Now = GetNow();
+
+	// Only builds that are due surface from the heap
+	while (CompletionHeap.Num() > 0 && CompletionHeap.HeapTop().Time <= Now)
+	{
+		FConstructionCompletion Completion;
+		CompletionHeap.HeapPop(Completion, EAllowShrinking::No);
+
+		// Cancelled, paused or stalled since it was scheduled
+		const FStationConstructionOrder& Order = Orders[Completion.OrderIndex];
+		if (Order.SiteIndex == INDEX_NONE || Order.Serial != Completion.Serial)
+		{
+			continue;
+		}
+
+		CompleteOrder(Completion.OrderIndex, Now);
+	}
+
+	// Spread slot and resource checks so every site is visited about once per interval
+	if (Sites.Num() == 0)
+	{
+		return;
+	}
+
+	RefreshCarry += Sites.Num() * static_cast<double>(DeltaTime) / ResourceCheckInterval;
+	const int32 NumChecks = FMath::Min(FMath::FloorToInt32(RefreshCarry), Sites.Num());
+	RefreshCarry -= NumChecks;
+
+	for (int32 Check = 0; Check < NumChecks; ++Check)
+	{
+		const int32 SiteIndex = RefreshCursor;
+		RefreshCursor = (RefreshCursor + 1) % Sites.Num();
+
+		if (Sites[SiteIndex].Queue.Num() > 0 && RefreshSite(SiteIndex, Now))
+		{
+			OnQueueChanged.Broadcast(Sites[SiteIndex].Station.Get());
+		}
+	}
+}
+
+// =====================
+// Queue
+// =====================
+
+int32 UStationConstructionScheduler::QueueConstruction(ASpaceStation* Station, const FConstructionQueueItem& Item)
+{
+	if (!Station || !Item.ModuleClass)
+	{
+		return -1;
+	}
+
+	const int32 SiteIndex = FindOrAddSite(Station);
+	const int32 OrderIndex = AllocateOrder();
+
+	FStationConstructionOrder& Order = Orders[OrderIndex];
+	Order.Item = Item;
+	Order.Item.QueueId = NextQueueId++;
+	Order.Item.bIsBuilding = false;
+	Order.SiteIndex = SiteIndex;
+
+	Sites[SiteIndex].Queue.Add(OrderIndex);
+	OrderIndices.Add(Order.Item.QueueId, OrderIndex);
+
+	// Pick up the station's current slots and resources so the order can start right away
+	RefreshSite(SiteIndex, GetNow());
+	OnQueueChanged.Broadcast(Station);
+
+	UE_LOG(LogAdastreaStations, Verbose, TEXT("StationConstructionScheduler::QueueConstruction - Queued %s on %s (ID: %d)"),
+		*Item.ModuleClass->GetName(), *Station->GetName(), Orders[OrderIndex].Item.QueueId);
+
+	return Orders[OrderIndex].Item.QueueId;
+}
+
+bool UStationConstructionScheduler::CancelConstruction(int32 QueueId)
+{
+	const int32* OrderIndexPtr = OrderIndices.Find(QueueId);
+	if (!OrderIndexPtr)
+	{
+		return false;
+	}
+
+	const int32 OrderIndex = *OrderIndexPtr;
+	const int32 SiteIndex = Orders[OrderIndex].SiteIndex;
+	const double Now = GetNow();
+
+	if (Orders[OrderIndex].Item.bIsBuilding)
+	{
+		StopBuild(OrderIndex, Now);
+	}
+
+	Sites[SiteIndex].Queue.RemoveSingle(OrderIndex);
+	ReleaseOrder(OrderIndex);
+	FillBuildSlots(SiteIndex, Now);
+
+	OnQueueChanged.Broadcast(Sites[SiteIndex].Station.Get());
+	return true;
+}
+
+bool UStationConstructionScheduler::SetConstructionPaused(int32 QueueId, bool bPause)
+{
+	const int32* OrderIndexPtr = OrderIndices.Find(QueueId);
+	if (!OrderIndexPtr)
+	{
+		return false;
+	}
+
+	const int32 OrderIndex = *OrderIndexPtr;
+	const int32 SiteIndex = Orders[OrderIndex].SiteIndex;
+	const double Now = GetNow();
+
+	FConstructionQueueItem& Item = Orders[OrderIndex].Item;
+	Item.bIsPaused = bPause;
+	if (bPause && Item.bIsBuilding)
+	{
+		StopBuild(OrderIndex, Now);
+	}
+	FillBuildSlots(SiteIndex, Now);
+
+	OnQueueChanged.Broadcast(Sites[SiteIndex].Station.Get());
+	return true;
+}
+
+bool UStationConstructionScheduler::ReorderConstruction(int32 QueueId, bool bMoveUp)
+{
+	const int32* OrderIndexPtr = OrderIndices.Find(QueueId);
+	if (!OrderIndexPtr)
+	{
+		return false;
+	}
+
+	// Can't move a build that is already running
+	const int32 OrderIndex = *OrderIndexPtr;
+	if (Orders[OrderIndex].Item.bIsBuilding)
+	{
+		return false;
+	}
+
+	FStationConstructionSite& Site = Sites[Orders[OrderIndex].SiteIndex];
+	const int32 Position = Site.Queue.Find(OrderIndex);
+	const int32 NewPosition = bMoveUp ? Position - 1 : Position + 1;
+	if (!Site.Queue.IsValidIndex(NewPosition))
+	{
+		return false;
+	}
+
+	Site.Queue.Swap(Position, NewPosition);
+
+	OnQueueChanged.Broadcast(Site.Station.Get());
+	return true;
+}
+
+TArray<FConstructionQueueItem> UStationConstructionScheduler::GetConstructionQueue(ASpaceStation* Station) const
+{
+	TArray<FConstructionQueueItem> Result;
+
+	const int32* SiteIndex = SiteIndices.Find(Station);
+	if (!SiteIndex)
+	{
+		return Result;
+	}
+
+	const double Now = GetNow();
+	const FStationConstructionSite& Site = Sites[*SiteIndex];
+	Result.Reserve(Site.Queue.Num());
+
+	for (const int32 OrderIndex : Site.Queue)
+	{
+		const FStationConstructionOrder& Order = Orders[OrderIndex];
+		FConstructionQueueItem& Item = Result.Add_GetRef(Order.Item);
+		if (Item.bIsBuilding)
+		{
+			Item.TimeRemaining = static_cast<float>(FMath::Max(0.0, Order.CompletionTime - Now));
+		}
+	}
+
+	return Result;
+}
+
+int32 UStationConstructionScheduler::GetBuildSlots(ASpaceStation* Station) const
+{
+	const int32* SiteIndex = SiteIndices.Find(Station);
+	return SiteIndex ? Sites[*SiteIndex].BuildSlots : BaseBuildSlots;
+}
+
+// =====================
+// Slots and Resources
+// =====================
+
+void UStationConstructionScheduler::RefreshStation(ASpaceStation* Station)
+{
+	const int32* SiteIndex = SiteIndices.Find(Station);
+	if (SiteIndex && RefreshSite(*SiteIndex, GetNow()))
+	{
+		OnQueueChanged.Broadcast(Station);
+	}
+}
+
+bool UStationConstructionScheduler::RefreshSite(int32 SiteIndex, double Now)
+{
+	FStationConstructionSite& Site = Sites[SiteIndex];
+	ASpaceStation* Station = Site.Station.Get();
+
+	// Drop the orders of stations that no longer exist
+	if (!Station)
+	{
+		if (Site.Queue.Num() == 0)
+		{
+			return false;
+		}
+
+		for (const int32 OrderIndex : Site.Queue)
+		{
+			if (Orders[OrderIndex].Item.bIsBuilding)
+			{
+				StopBuild(OrderIndex, Now);
+			}
+			ReleaseOrder(OrderIndex);
+		}
+		Site.Queue.Reset();
+		return true;
+	}
+
+	int32 NumFabricationModules = 0;
+	for (const ASpaceStationModule* Module : Station->Modules)
+	{
+		if (Module && Module->IsA<AFabricationModule>())
+		{
+			++NumFabricationModules;
+		}
+	}
+	Site.BuildSlots = BaseBuildSlots + NumFabricationModules * SlotsPerFabricationModule;
+
+	bool bChanged = false;
+	const bool bResourcesAvailable = !ResourceGate || ResourceGate(Station);
+	if (bResourcesAvailable != Site.bResourcesAvailable)
+	{
+		Site.bResourcesAvailable = bResourcesAvailable;
+		bChanged = true;
+
+		// Stalled builds keep their progress and restart in queue order
+		if (!bResourcesAvailable)
+		{
+			for (const int32 OrderIndex : Site.Queue)
+			{
+				if (Orders[OrderIndex].Item.bIsBuilding)
+				{
+					StopBuild(OrderIndex, Now);
+				}
+			}
+		}
+
+		UE_LOG(LogAdastreaStations, Log, TEXT("StationConstructionScheduler - Construction on %s %s"),
+			*Station->GetName(), bResourcesAvailable ? TEXT("resumed") : TEXT("stalled on resources"));
+	}
+
+	return FillBuildSlots(SiteIndex, Now) || bChanged;
+}
+
+bool UStationConstructionScheduler::FillBuildSlots(int32 SiteIndex, double Now)
+{
+	const FStationConstructionSite& Site = Sites[SiteIndex];
+	if (!Site.bResourcesAvailable)
+	{
+		return false;
+	}
+
+	bool bStarted = false;
+	for (int32 Position = 0; Position < Site.Queue.Num() && Site.ActiveBuilds < Site.BuildSlots; ++Position)
+	{
+		const int32 OrderIndex = Site.Queue[Position];
+		const FConstructionQueueItem& Item = Orders[OrderIndex].Item;
+		if (!Item.bIsBuilding && !Item.bIsPaused)
+		{
+			StartBuild(OrderIndex, Now);
+			bStarted = true;
+		}
+	}
+	return bStarted;
+}
+
+void UStationConstructionScheduler::StartBuild(int32 OrderIndex, double Now)
+{
+	FStationConstructionOrder& Order = Orders[OrderIndex];
+	Order.Item.bIsBuilding = true;
+	Order.CompletionTime = Now + FMath::Max(0.0f, Order.Item.TimeRemaining);
+	++Order.Serial;
+
+	CompletionHeap.HeapPush({ Order.CompletionTime, OrderIndex, Order.Serial });
+	++Sites[Order.SiteIndex].ActiveBuilds;
+	++ActiveBuildCount;
+}
+
+void UStationConstructionScheduler::StopBuild(int32 OrderIndex, double Now)
+{
+	// The heap entry goes stale and is skipped when it surfaces
+	FStationConstructionOrder& Order = Orders[OrderIndex];
+	Order.Item.bIsBuilding = false;
+	Order.Item.TimeRemaining = static_cast<float>(FMath::Max(0.0, Order.CompletionTime - Now));
+	++Order.Serial;
+
+	--Sites[Order.SiteIndex].ActiveBuilds;
+	--ActiveBuildCount;
+}
+
+void UStationConstructionScheduler::CompleteOrder(int32 OrderIndex, double Now)
+{
+	const int32 SiteIndex = Orders[OrderIndex].SiteIndex;
+	const FConstructionQueueItem Item = Orders[OrderIndex].Item;
+
+	--Sites[SiteIndex].ActiveBuilds;
+	--ActiveBuildCount;
+	Sites[SiteIndex].Queue.RemoveSingle(OrderIndex);
+	ReleaseOrder(OrderIndex);
+
+	ASpaceStation* Station = Sites[SiteIndex].Station.Get();
+	if (ASpaceStationModule* NewModule = Station ? SpawnModule(Station, Item) : nullptr)
+	{
+		OnConstructionCompleted.Broadcast(Station, NewModule, Item.QueueId);
+	}
+
+	// The new module may add slots or change the station's resources
+	RefreshSite(SiteIndex, Now);
+	OnQueueChanged.Broadcast(Station);
+}
+
+ASpaceStationModule* UStationConstructionScheduler::SpawnModule(ASpaceStation* Station, const FConstructionQueueItem& Item) const
+{
+	UWorld* World = GetWorld();
+	if (!World || !Item.ModuleClass)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = Station;
+
+	ASpaceStationModule* NewModule = World->SpawnActor<ASpaceStationModule>(
+		Item.ModuleClass,
+		Item.TargetPosition,
+		Item.TargetRotation,
+		SpawnParams
+	);
+
+	if (!NewModule)
+	{
+		UE_LOG(LogAdastreaStations, Error, TEXT("StationConstructionScheduler::SpawnModule - Failed to spawn %s"), *Item.ModuleClass->GetName());
+		return nullptr;
+	}
+
+	Station->AddModuleAtLocation(NewModule, Item.TargetPosition - Station->GetActorLocation());
+	return NewModule;
+}
+
+// =====================
+// Storage
+// =====================
+
+int32 UStationConstructionScheduler::FindOrAddSite(ASpaceStation* Station)
+{
+	if (const int32* Existing = SiteIndices.Find(Station))
+	{
+		return *Existing;
+	}
+
+	const int32 SiteIndex = Sites.AddDefaulted();
+	Sites[SiteIndex].Station = Station;
+	SiteIndices.Add(Station, SiteIndex);
+	return SiteIndex;
+}
+
+int32 UStationConstructionScheduler::AllocateOrder()
+{
+	// Reused slots keep their Serial so old heap entries stay stale
+	if (FreeOrders.Num() > 0)
+	{
+		return FreeOrders.Pop(EAllowShrinking::No);
+	}
+	return Orders.AddDefaulted();
+}
+
+void UStationConstructionScheduler::ReleaseOrder(int32 OrderIndex)
+{
+	FStationConstructionOrder& Order = Orders[OrderIndex];
+	OrderIndices.Remove(Order.Item.QueueId);
+	Order.Item = FConstructionQueueItem();
+	Order.SiteIndex = INDEX_NONE;
+	++Order.Serial;
+	FreeOrders.Add(OrderIndex);
+}
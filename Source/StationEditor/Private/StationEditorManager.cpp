@@ -3,9 +3,12 @@
 #include "StationEditorManager.h"
 #include "StationBuildPreview.h"
 #include "StationGridSystem.h"
+#include "StationTemplate.h"
+#include "StationConstructionScheduler.h"
 #include "AdastreaLog.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
 
 UStationEditorManager::UStationEditorManager()
 {
@@ -20,6 +23,16 @@ UStationEditorManager::UStationEditorManager()
 	PreviewActor = nullptr;
 	GridSystem = nullptr;
 	LastPowerBalance = 0.0f;
+
+	// Reactors feed the power network; habitation modules feed life support
+	PowerNetwork.SetSourcePredicate([](const ASpaceStationModule* Module)
+	{
+		return Module->ModuleGroup == EStationModuleGroup::Power || Module->ModulePower < 0.0f;
+	});
+	LifeSupportNetwork.SetSourcePredicate([](const ASpaceStationModule* Module)
+	{
+		return Module->ModuleGroup == EStationModuleGroup::Habitation;
+	});
 }
 
 // =====================
@@ -47,14 +60,23 @@ bool UStationEditorManager::BeginEditing_Implementation(ASpaceStation* Station)
 	ModulesAddedThisSession.Empty();
 	OriginalModuleTransforms.Empty();
 	
-	// Clear undo/redo stacks for new session
+	// Clear undo/redo history and module handles for new session
 	ClearUndoHistory();
+	ModulesByHandle.Reset();
+	HandlesByModule.Reset();
 	
 	// Clear connections and regenerate from existing modules
 	Connections.Empty();
+	PowerNetwork.Reset();
+	DataNetwork.Reset();
+	LifeSupportNetwork.Reset();
 	
-	// Clear construction queue
-	ConstructionQueue.Empty();
+	// Follow the station's construction queue, which outlives editing sessions
+	if (UStationConstructionScheduler* Scheduler = GetConstructionScheduler())
+	{
+		ConstructionQueueChangedHandle = Scheduler->OnQueueChanged.AddUObject(this, &UStationEditorManager::HandleConstructionQueueChanged);
+		ConstructionCompletedHandle = Scheduler->OnConstructionCompleted.AddUObject(this, &UStationEditorManager::HandleConstructionCompleted);
+	}
 	
 	// Clear notifications
 	ClearNotifications();
@@ -103,6 +125,9 @@ bool UStationEditorManager::BeginEditing_Implementation(ASpaceStation* Station)
 		}
 	}
 
+	// Index existing module footprints for collision and adjacency queries
+	RebuildOccupancyGrid();
+
 	// Auto-generate connections for existing modules
 	for (ASpaceStationModule* Module : Station->Modules)
 	{
@@ -133,6 +158,9 @@ void UStationEditorManager::Cancel_Implementation()
 
 	UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::Cancel - Canceling editing session, reverting changes"));
 	
+	// Stop spawning template modules so the revert sees all of them
+	CancelTemplateInstantiation();
+
 	// Revert all changes made during this session
 	RevertChanges();
 	
@@ -167,6 +195,17 @@ bool UStationEditorManager::Save_Implementation()
 
 void UStationEditorManager::EndEditing_Implementation()
 {
+	// Finish any template in progress while the station is still set
+	CancelTemplateInstantiation();
+
+	if (UStationConstructionScheduler* Scheduler = GetConstructionScheduler())
+	{
+		Scheduler->OnQueueChanged.Remove(ConstructionQueueChangedHandle);
+		Scheduler->OnConstructionCompleted.Remove(ConstructionCompletedHandle);
+	}
+	ConstructionQueueChangedHandle.Reset();
+	ConstructionCompletedHandle.Reset();
+
 	// Clean up preview actor
 	if (IsValid(PreviewActor))
 	{
@@ -178,6 +217,13 @@ void UStationEditorManager::EndEditing_Implementation()
 	// Clear state
 	CurrentStation = nullptr;
 	bIsEditing = false;
+	OccupancyGrid.Reset();
+	ModuleTotals.Reset();
+	ModulesByHandle.Reset();
+	HandlesByModule.Reset();
+
+	// A transaction left open must not swallow the next session's steps and events
+	ResetBatchState();
 	
 	// Broadcast state change
 	OnEditingStateChanged.Broadcast(false);
@@ -235,6 +281,7 @@ ASpaceStationModule* UStationEditorManager::PlaceModule_Implementation(TSubclass
 
 	// Add to station
 	CurrentStation->AddModuleAtLocation(NewModule, RelativeLocation);
+	UpdateOccupancy(NewModule);
 
 	// Track for potential undo
 	ModulesAddedThisSession.Add(NewModule);
@@ -244,6 +291,7 @@ ASpaceStationModule* UStationEditorManager::PlaceModule_Implementation(TSubclass
 	Action.ActionType = EEditorActionType::PlaceModule;
 	Action.ModuleClass = ModuleClass;
 	Action.Module = NewModule;
+	Action.ModuleHandle = BindModuleHandle(NewModule);
 	Action.NewPosition = FinalPosition;
 	Action.NewRotation = Rotation;
 	Action.Timestamp = CurrentTime;
@@ -269,7 +317,7 @@ ASpaceStationModule* UStationEditorManager::PlaceModule_Implementation(TSubclass
 		*NewModule->GetName(), FinalPosition.X, FinalPosition.Y, FinalPosition.Z);
 
 	// Broadcast event
-	OnModulePlaced.Broadcast(NewModule);
+	NotifyModulePlaced(NewModule);
 
 	return NewModule;
 }
@@ -293,18 +341,13 @@ bool UStationEditorManager::RemoveModule_Implementation(ASpaceStationModule* Mod
 	Action.ActionType = EEditorActionType::RemoveModule;
 	Action.ModuleClass = Module->GetClass();
 	Action.Module = nullptr; // Will be invalid after destroy
+	Action.ModuleHandle = GetModuleHandle(Module);
 	Action.PreviousPosition = Module->GetActorLocation();
 	Action.PreviousRotation = Module->GetActorRotation();
 	Action.Timestamp = CurrentTime;
 
 	// Remove connections involving this module
-	for (int32 i = Connections.Num() - 1; i >= 0; --i)
-	{
-		if (Connections[i].ModuleA == Module || Connections[i].ModuleB == Module)
-		{
-			Connections.RemoveAt(i);
-		}
-	}
+	RemoveModuleConnections(Module);
 
 	// Remove from station
 	if (!CurrentStation->RemoveModule(Module))
@@ -314,6 +357,9 @@ bool UStationEditorManager::RemoveModule_Implementation(ASpaceStationModule* Mod
 	}
 
 	// Remove from tracking
+	OccupancyGrid.RemoveModule(Module);
+	ModuleTotals.RemoveModule(Module);
+	ReleaseModuleHandle(Module);
 	ModulesAddedThisSession.Remove(Module);
 	OriginalModuleTransforms.Remove(Module);
 
@@ -329,7 +375,7 @@ bool UStationEditorManager::RemoveModule_Implementation(ASpaceStationModule* Mod
 	NotifyPowerBalanceChanged();
 
 	// Broadcast event
-	OnModuleRemoved.Broadcast(Module);
+	NotifyModuleRemoved(Module);
 
 	// Optionally destroy the module
 	Module->Destroy();
@@ -375,10 +421,13 @@ bool UStationEditorManager::MoveModule_Implementation(ASpaceStationModule* Modul
 
 	if (bSuccess)
 	{
+		UpdateOccupancy(Module);
+
 		// Record action for undo
 		FEditorAction Action;
 		Action.ActionType = EEditorActionType::MoveModule;
 		Action.Module = Module;
+		Action.ModuleHandle = GetModuleHandle(Module);
 		Action.PreviousPosition = PreviousPosition;
 		Action.NewPosition = FinalPosition;
 		Action.Timestamp = CurrentTime;
@@ -415,11 +464,13 @@ bool UStationEditorManager::RotateModule_Implementation(ASpaceStationModule* Mod
 	}
 
 	Module->SetActorRotation(NewRotation);
+	UpdateOccupancy(Module);
 
 	// Record action for undo
 	FEditorAction Action;
 	Action.ActionType = EEditorActionType::RotateModule;
 	Action.Module = Module;
+	Action.ModuleHandle = GetModuleHandle(Module);
 	Action.PreviousRotation = PreviousRotation;
 	Action.NewRotation = NewRotation;
 	Action.Timestamp = CurrentTime;
@@ -483,37 +534,19 @@ EModulePlacementResult UStationEditorManager::CanPlaceModule_Implementation(TSub
 
 bool UStationEditorManager::CheckCollision(TSubclassOf<ASpaceStationModule> ModuleClass, FVector Position, FRotator Rotation) const
 {
-	if (!ModuleClass || !CurrentStation)
-	{
-		return false;
-	}
-
-	// Get default object for collision bounds
-	ASpaceStationModule* DefaultModule = ModuleClass->GetDefaultObject<ASpaceStationModule>();
-	if (!DefaultModule)
+	if (!ModuleClass || !CurrentStation || !GridSystem)
 	{
 		return false;
 	}
 
-	// Simple sphere-based collision check with existing modules
-	// A more sophisticated system would use actual mesh bounds
-	// Uses the configurable CollisionRadius property
-
-	for (ASpaceStationModule* ExistingModule : CurrentStation->Modules)
-	{
-		if (!ExistingModule)
-		{
-			continue;
-		}
-
-		float Distance = FVector::Dist(Position, ExistingModule->GetActorLocation());
-		if (Distance < CollisionRadius * 2.0f)
-		{
-			return true; // Collision detected
-		}
-	}
+	// Footprint overlap against the occupancy grid - cost depends on the
+	// footprint's size, not on how many modules the station has
+	return OccupancyGrid.Overlaps(ComputeFootprint(ModuleClass, Position, Rotation));
+}
 
-	return false;
+ASpaceStationModule* UStationEditorManager::GetModuleAtGridCell(FIntVector GridCoordinate) const
+{
+	return OccupancyGrid.GetModuleAt(GridCoordinate);
 }
 
 bool UStationEditorManager::HasSufficientTechLevel(TSubclassOf<ASpaceStationModule> ModuleClass) const
@@ -557,44 +590,13 @@ bool UStationEditorManager::CanAffordModule(TSubclassOf<ASpaceStationModule> Mod
 
 float UStationEditorManager::GetTotalPowerConsumption() const
 {
-	float TotalConsumption = 0.0f;
-
-	if (!CurrentStation)
-	{
-		return TotalConsumption;
-	}
-
-	for (const ASpaceStationModule* Module : CurrentStation->Modules)
-	{
-		// Positive ModulePower = consumption
-		if (Module && Module->ModulePower > 0.0f)
-		{
-			TotalConsumption += Module->ModulePower;
-		}
-	}
-
-	return TotalConsumption;
+	// Running total kept by UpdateOccupancy and module removal
+	return CurrentStation ? ModuleTotals.GetPowerConsumed() : 0.0f;
 }
 
 float UStationEditorManager::GetTotalPowerGeneration() const
 {
-	float TotalGeneration = 0.0f;
-
-	if (!CurrentStation)
-	{
-		return TotalGeneration;
-	}
-
-	for (const ASpaceStationModule* Module : CurrentStation->Modules)
-	{
-		// Negative ModulePower = generation (use absolute value)
-		if (Module && Module->ModulePower < 0.0f)
-		{
-			TotalGeneration += FMath::Abs(Module->ModulePower);
-		}
-	}
-
-	return TotalGeneration;
+	return CurrentStation ? ModuleTotals.GetPowerGenerated() : 0.0f;
 }
 
 float UStationEditorManager::GetPowerBalance() const
@@ -714,16 +716,20 @@ bool UStationEditorManager::GetModuleBuildCost(TSubclassOf<ASpaceStationModule>
 
 void UStationEditorManager::RevertChanges()
 {
-	// Remove all modules added this session
+	// Remove all modules added this session, pruning their connections in one pass
+	BeginBatch();
 	for (ASpaceStationModule* Module : ModulesAddedThisSession)
 	{
 		if (Module && CurrentStation)
 		{
+			RemoveModuleConnections(Module);
 			CurrentStation->RemoveModule(Module);
+			ReleaseModuleHandle(Module);
 			Module->Destroy();
 		}
 	}
 	ModulesAddedThisSession.Empty();
+	EndBatch();
 
 	// Restore original transforms of moved modules
 	for (const auto& Pair : OriginalModuleTransforms)
@@ -738,346 +744,658 @@ void UStationEditorManager::RevertChanges()
 	}
 	OriginalModuleTransforms.Empty();
 
+	RebuildOccupancyGrid();
+
 	UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::RevertChanges - Reverted all changes"));
 }
 
-void UStationEditorManager::NotifyPowerBalanceChanged()
+FStationModuleFootprint UStationEditorManager::ComputeFootprint(const FBox& WorldBounds) const
 {
-	float CurrentBalance = GetPowerBalance();
-	
-	if (!FMath::IsNearlyEqual(CurrentBalance, LastPowerBalance, 0.01f))
+	// Shrink slightly so boxes that only touch on a cell boundary don't share a cell
+	const FVector Tolerance(GridSystem->GridSize * 0.01f);
+	const FIntVector MinCell = GridSystem->GetGridCoordinate(WorldBounds.Min + Tolerance);
+	const FIntVector MaxCell = GridSystem->GetGridCoordinate(WorldBounds.Max - Tolerance);
+
+	return FStationModuleFootprint(MinCell, FIntVector(
+		FMath::Max(MinCell.X, MaxCell.X),
+		FMath::Max(MinCell.Y, MaxCell.Y),
+		FMath::Max(MinCell.Z, MaxCell.Z)));
+}
+
+FStationModuleFootprint UStationEditorManager::ComputeFootprint(TSubclassOf<ASpaceStationModule> ModuleClass, FVector Position, FRotator Rotation) const
+{
+	// Class defaults have no registered components, so use bounds learned from placed modules
+	FBox LocalBounds(FVector(-CollisionRadius), FVector(CollisionRadius));
+	if (const FBox* KnownBounds = ModuleLocalBounds.Find(ModuleClass.Get()))
 	{
-		LastPowerBalance = CurrentBalance;
-		OnPowerBalanceChanged.Broadcast(CurrentBalance);
+		LocalBounds = *KnownBounds;
 	}
-}
 
-// =====================
-// Undo/Redo System
-// =====================
+	return ComputeFootprint(LocalBounds.TransformBy(FTransform(Rotation, Position)));
+}
 
-bool UStationEditorManager::Undo()
+void UStationEditorManager::UpdateOccupancy(ASpaceStationModule* Module)
 {
-	if (!CanUndo())
+	if (!Module)
 	{
-		return false;
+		return;
 	}
 
-	FEditorAction Action = UndoStack.Pop();
-	
-	if (ReverseAction(Action))
+	// Recounting replaces the module's previous share, so moves don't double-count
+	ModuleTotals.AddModule(Module);
+
+	if (!GridSystem)
 	{
-		RedoStack.Push(Action);
-		NotifyUndoRedoStateChanged();
-		RecalculateStatistics();
-		UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::Undo - Undid action type %d"), static_cast<int32>(Action.ActionType));
-		return true;
+		return;
 	}
 
-	return false;
+	FBox LocalBounds = Module->CalculateComponentsBoundingBoxInLocalSpace(true);
+	if (LocalBounds.IsValid)
+	{
+		ModuleLocalBounds.Add(Module->GetClass(), LocalBounds);
+	}
+	else
+	{
+		LocalBounds = FBox(FVector(-CollisionRadius), FVector(CollisionRadius));
+	}
+
+	OccupancyGrid.AddModule(Module, ComputeFootprint(LocalBounds.TransformBy(Module->GetActorTransform())));
 }
 
-bool UStationEditorManager::Redo()
+void UStationEditorManager::RebuildOccupancyGrid()
 {
-	if (!CanRedo())
+	OccupancyGrid.Reset();
+	ModuleTotals.Reset();
+
+	if (!CurrentStation)
 	{
-		return false;
+		return;
 	}
 
-	FEditorAction Action = RedoStack.Pop();
-	
-	if (ExecuteAction(Action))
+	for (ASpaceStationModule* Module : CurrentStation->Modules)
 	{
-		UndoStack.Push(Action);
-		NotifyUndoRedoStateChanged();
-		RecalculateStatistics();
-		UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::Redo - Redid action type %d"), static_cast<int32>(Action.ActionType));
-		return true;
+		UpdateOccupancy(Module);
 	}
 
-	return false;
+	UE_LOG(LogAdastreaStations, Verbose, TEXT("StationEditorManager::RebuildOccupancyGrid - Indexed %d modules"), OccupancyGrid.Num());
 }
 
-bool UStationEditorManager::CanUndo() const
+void UStationEditorManager::NotifyPowerBalanceChanged()
 {
-	return UndoStack.Num() > 0;
+	// Batched operations report the final balance once
+	if (BatchDepth > 0)
+	{
+		bPendingPowerBalanceNotify = true;
+		return;
+	}
+
+	float CurrentBalance = GetPowerBalance();
+	
+	if (!FMath::IsNearlyEqual(CurrentBalance, LastPowerBalance, 0.01f))
+	{
+		LastPowerBalance = CurrentBalance;
+		OnPowerBalanceChanged.Broadcast(CurrentBalance);
+	}
 }
 
-bool UStationEditorManager::CanRedo() const
+void UStationEditorManager::NotifyModulePlaced(ASpaceStationModule* Module)
 {
-	return RedoStack.Num() > 0;
+	if (BatchDepth > 0)
+	{
+		PendingPlacedModules.Add(Module);
+		return;
+	}
+
+	OnModulePlaced.Broadcast(Module);
 }
 
-void UStationEditorManager::ClearUndoHistory()
+void UStationEditorManager::NotifyModuleRemoved(ASpaceStationModule* Module)
 {
-	UndoStack.Empty();
-	RedoStack.Empty();
-	NotifyUndoRedoStateChanged();
+	if (BatchDepth > 0)
+	{
+		PendingRemovedModules.Add(Module);
+		return;
+	}
+
+	OnModuleRemoved.Broadcast(Module);
 }
 
-int32 UStationEditorManager::GetUndoCount() const
+void UStationEditorManager::BeginBatch()
 {
-	return UndoStack.Num();
+	++BatchDepth;
 }
 
-int32 UStationEditorManager::GetRedoCount() const
+void UStationEditorManager::EndBatch()
 {
-	return RedoStack.Num();
+	if (BatchDepth == 0 || --BatchDepth > 0)
+	{
+		return;
+	}
+
+	// Prune connections of every module removed in the batch in a single pass
+	ApplyPendingConnectionPrunes();
+
+	if (bPendingPowerBalanceNotify)
+	{
+		bPendingPowerBalanceNotify = false;
+		NotifyPowerBalanceChanged();
+	}
+
+	if (bPendingUndoRedoNotify)
+	{
+		bPendingUndoRedoNotify = false;
+		NotifyUndoRedoStateChanged();
+	}
+
+	// One summary for every module the batch placed or removed
+	if (PendingPlacedModules.Num() > 0 || PendingRemovedModules.Num() > 0)
+	{
+		const TArray<ASpaceStationModule*> PlacedModules = MoveTemp(PendingPlacedModules);
+		const TArray<ASpaceStationModule*> RemovedModules = MoveTemp(PendingRemovedModules);
+		PendingPlacedModules.Reset();
+		PendingRemovedModules.Reset();
+		OnModulesChanged.Broadcast(PlacedModules, RemovedModules);
+	}
 }
 
-void UStationEditorManager::RecordAction(const FEditorAction& Action)
+void UStationEditorManager::ApplyPendingConnectionPrunes()
 {
-	// Add to undo stack
-	UndoStack.Push(Action);
-	
-	// Limit stack size efficiently - remove multiple old entries at once
-	if (UndoStack.Num() > MaxUndoStackSize)
+	if (PendingConnectionPrunes.Num() > 0)
 	{
-		const int32 NumToRemove = UndoStack.Num() - MaxUndoStackSize;
-		UndoStack.RemoveAt(0, NumToRemove);
+		Connections.RemoveAll([this](const FModuleConnection& Conn)
+		{
+			return PendingConnectionPrunes.Contains(Conn.ModuleA) || PendingConnectionPrunes.Contains(Conn.ModuleB);
+		});
+		PendingConnectionPrunes.Reset();
 	}
-	
-	// Clear redo stack when new action is recorded
-	RedoStack.Empty();
-	
-	NotifyUndoRedoStateChanged();
 }
 
-bool UStationEditorManager::ExecuteAction(const FEditorAction& Action)
+void UStationEditorManager::ResetBatchState()
 {
-	switch (Action.ActionType)
+	if (TransactionDepth > 0 || BatchDepth > 0)
 	{
-		case EEditorActionType::PlaceModule:
-			if (Action.ModuleClass && CurrentStation)
-			{
-				// Re-place the module without recording action (we're executing from redo stack)
-				UWorld* World = CurrentStation->GetWorld();
-				if (World)
-				{
-					FVector FinalPosition = bSnapToGrid && GridSystem ? GridSystem->SnapToGrid(Action.NewPosition) : Action.NewPosition;
-					
-					FActorSpawnParameters SpawnParams;
-					SpawnParams.Owner = CurrentStation;
-					
-					ASpaceStationModule* NewModule = World->SpawnActor<ASpaceStationModule>(
-						Action.ModuleClass,
-						FinalPosition,
-						Action.NewRotation,
-						SpawnParams
-					);
-					
-					if (NewModule)
-					{
-						FVector RelativeLocation = FinalPosition - CurrentStation->GetActorLocation();
-						CurrentStation->AddModuleAtLocation(NewModule, RelativeLocation);
-						AutoGenerateConnections(NewModule);
-						bStatisticsDirty = true;
-						NotifyPowerBalanceChanged();
-						OnModulePlaced.Broadcast(NewModule);
-						return true;
-					}
-				}
-			}
-			break;
-			
-		case EEditorActionType::RemoveModule:
-			// For redo of remove, we need to find and remove the module we just recreated via undo
-			// Since we stored the position, we can find it
-			if (CurrentStation)
-			{
-				for (ASpaceStationModule* Module : CurrentStation->Modules)
-				{
-					if (Module && 
-						FVector::DistSquared(Module->GetActorLocation(), Action.PreviousPosition) < ModuleMatchDistanceSquared &&
-						Module->GetClass() == Action.ModuleClass)
-					{
-						// Remove connections for this module
-						for (int32 i = Connections.Num() - 1; i >= 0; --i)
-						{
-							if (Connections[i].ModuleA == Module || Connections[i].ModuleB == Module)
-							{
-								Connections.RemoveAt(i);
-							}
-						}
-						CurrentStation->RemoveModule(Module);
-						Module->Destroy();
-						bStatisticsDirty = true;
-						NotifyPowerBalanceChanged();
-						return true;
-					}
-				}
-			}
-			break;
-			
-		case EEditorActionType::MoveModule:
-			if (Action.Module && IsValid(Action.Module) && !Action.Module->IsActorBeingDestroyed())
-			{
-				Action.Module->SetActorLocation(Action.NewPosition);
-				return true;
-			}
-			else
-			{
-				UE_LOG(LogAdastreaStations, Warning, TEXT("Redo MoveModule failed: Module is invalid or being destroyed."));
-			}
-			break;
-			
-		case EEditorActionType::RotateModule:
-			if (Action.Module && IsValid(Action.Module) && !Action.Module->IsActorBeingDestroyed())
-			{
-				Action.Module->SetActorRotation(Action.NewRotation);
-				return true;
-			}
-			else
-			{
-				UE_LOG(LogAdastreaStations, Warning, TEXT("Redo RotateModule failed: Module is invalid or being destroyed."));
-			}
-			break;
-			
-		case EEditorActionType::UpgradeModule:
-			// Upgrade actions are not undoable/redoable - just log and return false
-			UE_LOG(LogAdastreaStations, Log, TEXT("UpgradeModule cannot be redone."));
-			break;
-			
-		default:
-			break;
+		UE_LOG(LogAdastreaStations, Warning, TEXT("StationEditorManager::ResetBatchState - Abandoning open transaction (depth %d, batch depth %d)"),
+			TransactionDepth, BatchDepth);
 	}
-	
-	return false;
+
+	// Removed modules' connections still have to leave the list
+	ApplyPendingConnectionPrunes();
+
+	TransactionDepth = 0;
+	BatchDepth = 0;
+	OpenTransaction = FEditorTransaction();
+	bPendingPowerBalanceNotify = false;
+	bPendingUndoRedoNotify = false;
+	PendingPlacedModules.Reset();
+	PendingRemovedModules.Reset();
 }
 
-bool UStationEditorManager::ReverseAction(const FEditorAction& Action)
+FStationEditorTransactionScope::FStationEditorTransactionScope(UStationEditorManager* InManager, const FText& Description)
+	: Manager(InManager)
 {
-	switch (Action.ActionType)
+	if (InManager)
 	{
-		case EEditorActionType::PlaceModule:
-			// Reverse of place = remove
-			if (Action.Module && IsValid(Action.Module) && CurrentStation && !Action.Module->IsActorBeingDestroyed())
-			{
-				// Remove connections for this module
-				for (int32 i = Connections.Num() - 1; i >= 0; --i)
-				{
-					if (Connections[i].ModuleA == Action.Module || Connections[i].ModuleB == Action.Module)
-					{
-						Connections.RemoveAt(i);
-					}
-				}
-				
-				CurrentStation->RemoveModule(Action.Module);
-				Action.Module->Destroy();
-				bStatisticsDirty = true;
-				NotifyPowerBalanceChanged();
-				return true;
-			}
-			break;
-			
-		case EEditorActionType::RemoveModule:
-			// Reverse of remove = place (needs stored data to recreate)
-			// Don't call PlaceModule as it records a new action
-			if (Action.ModuleClass && CurrentStation)
-			{
-				UWorld* World = CurrentStation->GetWorld();
-				if (World)
-				{
-					FVector FinalPosition = bSnapToGrid && GridSystem ? GridSystem->SnapToGrid(Action.PreviousPosition) : Action.PreviousPosition;
-					
-					FActorSpawnParameters SpawnParams;
-					SpawnParams.Owner = CurrentStation;
-					
-					ASpaceStationModule* NewModule = World->SpawnActor<ASpaceStationModule>(
-						Action.ModuleClass,
-						FinalPosition,
-						Action.PreviousRotation,
-						SpawnParams
-					);
-					
-					if (NewModule)
-					{
-						FVector RelativeLocation = FinalPosition - CurrentStation->GetActorLocation();
-						CurrentStation->AddModuleAtLocation(NewModule, RelativeLocation);
-						AutoGenerateConnections(NewModule);
-						bStatisticsDirty = true;
-						NotifyPowerBalanceChanged();
-						OnModulePlaced.Broadcast(NewModule);
-						return true;
-					}
-				}
-			}
-			break;
-			
-		case EEditorActionType::MoveModule:
-			if (Action.Module && IsValid(Action.Module) && !Action.Module->IsActorBeingDestroyed())
-			{
-				Action.Module->SetActorLocation(Action.PreviousPosition);
-				return true;
-			}
-			else
-			{
-				UE_LOG(LogAdastreaStations, Warning, TEXT("Undo MoveModule failed: Module is invalid or being destroyed."));
-			}
-			break;
-			
-		case EEditorActionType::RotateModule:
-			if (Action.Module && IsValid(Action.Module) && !Action.Module->IsActorBeingDestroyed())
-			{
-				Action.Module->SetActorRotation(Action.PreviousRotation);
-				return true;
-			}
-			else
-			{
-				UE_LOG(LogAdastreaStations, Warning, TEXT("Undo RotateModule failed: Module is invalid or being destroyed."));
-			}
-			break;
-			
-		case EEditorActionType::UpgradeModule:
-			// Upgrade actions are not undoable/redoable - just log and return false
-			UE_LOG(LogAdastreaStations, Log, TEXT("UpgradeModule cannot be undone."));
-			break;
-			
-		default:
-			break;
+		InManager->BeginTransaction(Description);
 	}
-	
-	return false;
 }
 
-void UStationEditorManager::NotifyUndoRedoStateChanged()
+FStationEditorTransactionScope::~FStationEditorTransactionScope()
 {
-	OnUndoRedoStateChanged.Broadcast(CanUndo(), CanRedo());
+	if (UStationEditorManager* EditorManager = Manager.Get())
+	{
+		EditorManager->EndTransaction();
+	}
 }
 
 // =====================
-// Module Connections
+// Module Handles
 // =====================
 
-bool UStationEditorManager::AddConnection(ASpaceStationModule* ModuleA, ASpaceStationModule* ModuleB, EModuleConnectionType ConnectionType)
+FGuid UStationEditorManager::GetModuleHandle(ASpaceStationModule* Module)
 {
-	if (!ModuleA || !ModuleB || ModuleA == ModuleB)
+	if (!Module)
 	{
-		return false;
+		return FGuid();
 	}
 
-	// Check if connection already exists
-	for (const FModuleConnection& Existing : Connections)
+	if (const FGuid* Handle = HandlesByModule.Find(Module))
 	{
-		if (Existing.ConnectionType == ConnectionType &&
-			((Existing.ModuleA == ModuleA && Existing.ModuleB == ModuleB) ||
-			 (Existing.ModuleA == ModuleB && Existing.ModuleB == ModuleA)))
-		{
-			return false; // Already exists
-		}
+		return *Handle;
 	}
+	return BindModuleHandle(Module);
+}
 
-	FModuleConnection NewConnection;
-	NewConnection.ModuleA = ModuleA;
-	NewConnection.ModuleB = ModuleB;
-	NewConnection.ConnectionType = ConnectionType;
-	NewConnection.bIsActive = true;
-	
-	// Set capacity based on connection type using configurable defaults
-	switch (ConnectionType)
+ASpaceStationModule* UStationEditorManager::FindModuleByHandle(FGuid Handle) const
+{
+	return ResolveModuleHandle(Handle);
+}
+
+FGuid UStationEditorManager::BindModuleHandle(ASpaceStationModule* Module, const FGuid& Handle)
+{
+	const FGuid BoundHandle = Handle.IsValid() ? Handle : FGuid::NewGuid();
+	ModulesByHandle.Add(BoundHandle, Module);
+	HandlesByModule.Add(Module, BoundHandle);
+	return BoundHandle;
+}
+
+void UStationEditorManager::ReleaseModuleHandle(ASpaceStationModule* Module)
+{
+	// The handle stays in history so undo can bind it to a respawned module
+	FGuid Handle;
+	if (HandlesByModule.RemoveAndCopyValue(Module, Handle))
 	{
-		case EModuleConnectionType::Power:
-			NewConnection.Capacity = DefaultPowerConnectionCapacity; // MW
+		ModulesByHandle.Remove(Handle);
+	}
+}
+
+ASpaceStationModule* UStationEditorManager::ResolveModuleHandle(const FGuid& Handle) const
+{
+	ASpaceStationModule* const* Module = ModulesByHandle.Find(Handle);
+	return Module && IsValid(*Module) && !(*Module)->IsActorBeingDestroyed() ? *Module : nullptr;
+}
+
+ASpaceStationModule* UStationEditorManager::SpawnModuleInternal(TSubclassOf<ASpaceStationModule> ModuleClass, FVector Position, FRotator Rotation, bool bAutoConnect)
+{
+	UWorld* World = CurrentStation ? CurrentStation->GetWorld() : nullptr;
+	if (!ModuleClass || !World)
+	{
+		return nullptr;
+	}
+
+	FVector FinalPosition = bSnapToGrid && GridSystem ? GridSystem->SnapToGrid(Position) : Position;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = CurrentStation;
+
+	ASpaceStationModule* NewModule = World->SpawnActor<ASpaceStationModule>(
+		ModuleClass,
+		FinalPosition,
+		Rotation,
+		SpawnParams
+	);
+
+	if (NewModule)
+	{
+		FVector RelativeLocation = FinalPosition - CurrentStation->GetActorLocation();
+		CurrentStation->AddModuleAtLocation(NewModule, RelativeLocation);
+		RegisterSpawnedModule(NewModule, bAutoConnect);
+	}
+
+	return NewModule;
+}
+
+void UStationEditorManager::RegisterSpawnedModule(ASpaceStationModule* Module, bool bAutoConnect)
+{
+	UpdateOccupancy(Module);
+	if (bAutoConnect)
+	{
+		AutoGenerateConnections(Module);
+	}
+	bStatisticsDirty = true;
+	NotifyPowerBalanceChanged();
+	NotifyModulePlaced(Module);
+}
+
+void UStationEditorManager::DestroyModuleInternal(ASpaceStationModule* Module)
+{
+	RemoveModuleConnections(Module);
+	CurrentStation->RemoveModule(Module);
+	OccupancyGrid.RemoveModule(Module);
+	ModuleTotals.RemoveModule(Module);
+	ReleaseModuleHandle(Module);
+	bStatisticsDirty = true;
+	NotifyPowerBalanceChanged();
+	NotifyModuleRemoved(Module);
+	Module->Destroy();
+}
+
+// =====================
+// Undo/Redo System
+// =====================
+
+bool UStationEditorManager::Undo()
+{
+	if (!CanUndo())
+	{
+		return false;
+	}
+
+	const FEditorTransaction& Transaction = History[GetHistorySlot(UndoCount - 1)];
+
+	BeginBatch();
+
+	// Reverse actions newest first
+	int32 NumReversed = 0;
+	for (int32 i = Transaction.Actions.Num() - 1; i >= 0; --i)
+	{
+		if (ReverseAction(Transaction.Actions[i]))
+		{
+			++NumReversed;
+		}
+	}
+
+	// A step that couldn't be undone at all can't be redone either
+	--UndoCount;
+	RedoCount = NumReversed > 0 ? RedoCount + 1 : 0;
+	NotifyUndoRedoStateChanged();
+
+	EndBatch();
+	RecalculateStatistics();
+
+	UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::Undo - Undid %d of %d actions"), NumReversed, Transaction.Actions.Num());
+	return NumReversed > 0;
+}
+
+bool UStationEditorManager::Redo()
+{
+	if (!CanRedo())
+	{
+		return false;
+	}
+
+	const FEditorTransaction& Transaction = History[GetHistorySlot(UndoCount)];
+
+	BeginBatch();
+
+	int32 NumExecuted = 0;
+	for (const FEditorAction& Action : Transaction.Actions)
+	{
+		if (ExecuteAction(Action, !Transaction.bHasLinkSet))
+		{
+			++NumExecuted;
+		}
+	}
+
+	// Steps with their own link set get exactly those links back, wired in one pass
+	for (const FEditorLink& Link : Transaction.Links)
+	{
+		LinkModules(ResolveModuleHandle(Link.ModuleHandleA), ResolveModuleHandle(Link.ModuleHandleB), Link.ConnectionType);
+	}
+
+	if (NumExecuted > 0)
+	{
+		++UndoCount;
+		--RedoCount;
+	}
+	else
+	{
+		RedoCount = 0;
+	}
+	NotifyUndoRedoStateChanged();
+
+	EndBatch();
+	RecalculateStatistics();
+
+	UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::Redo - Redid %d of %d actions"), NumExecuted, Transaction.Actions.Num());
+	return NumExecuted > 0;
+}
+
+bool UStationEditorManager::CanUndo() const
+{
+	return UndoCount > 0;
+}
+
+bool UStationEditorManager::CanRedo() const
+{
+	return RedoCount > 0;
+}
+
+void UStationEditorManager::ClearUndoHistory()
+{
+	ResetBatchState();
+	History.Reset();
+	HistoryStart = 0;
+	UndoCount = 0;
+	RedoCount = 0;
+	NotifyUndoRedoStateChanged();
+}
+
+int32 UStationEditorManager::GetUndoCount() const
+{
+	return UndoCount;
+}
+
+int32 UStationEditorManager::GetRedoCount() const
+{
+	return RedoCount;
+}
+
+void UStationEditorManager::BeginTransaction(FText Description)
+{
+	if (TransactionDepth++ == 0)
+	{
+		OpenTransaction.Actions.Reset();
+		OpenTransaction.Description = Description;
+	}
+
+	BeginBatch();
+}
+
+void UStationEditorManager::EndTransaction()
+{
+	if (TransactionDepth == 0)
+	{
+		UE_LOG(LogAdastreaStations, Warning, TEXT("StationEditorManager::EndTransaction - No open transaction"));
+		return;
+	}
+
+	if (--TransactionDepth == 0 && OpenTransaction.Actions.Num() > 0)
+	{
+		UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::EndTransaction - Recorded '%s' with %d actions"),
+			*OpenTransaction.Description.ToString(), OpenTransaction.Actions.Num());
+
+		PushTransaction(MoveTemp(OpenTransaction));
+		OpenTransaction = FEditorTransaction();
+	}
+
+	EndBatch();
+}
+
+bool UStationEditorManager::IsInTransaction() const
+{
+	return TransactionDepth > 0;
+}
+
+void UStationEditorManager::RecordAction(const FEditorAction& Action)
+{
+	if (TransactionDepth > 0)
+	{
+		OpenTransaction.Actions.Add(Action);
+		return;
+	}
+
+	FEditorTransaction Transaction;
+	Transaction.Actions.Add(Action);
+	PushTransaction(MoveTemp(Transaction));
+}
+
+void UStationEditorManager::PushTransaction(FEditorTransaction&& Transaction)
+{
+	if (History.Num() < MaxUndoStackSize)
+	{
+		History.SetNum(MaxUndoStackSize);
+	}
+
+	// Full: overwrite the oldest step instead of shifting the history
+	if (UndoCount == MaxUndoStackSize)
+	{
+		HistoryStart = GetHistorySlot(1);
+		--UndoCount;
+	}
+
+	History[GetHistorySlot(UndoCount)] = MoveTemp(Transaction);
+	++UndoCount;
+
+	// Recording a new step discards the redo history
+	RedoCount = 0;
+
+	NotifyUndoRedoStateChanged();
+}
+
+bool UStationEditorManager::ExecuteAction(const FEditorAction& Action, bool bAutoConnect)
+{
+	switch (Action.ActionType)
+	{
+		case EEditorActionType::PlaceModule:
+			// Re-place the module without recording action (we're executing from redo history)
+			if (ASpaceStationModule* NewModule = SpawnModuleInternal(Action.ModuleClass, Action.NewPosition, Action.NewRotation, bAutoConnect))
+			{
+				BindModuleHandle(NewModule, Action.ModuleHandle);
+				return true;
+			}
+			break;
+			
+		case EEditorActionType::RemoveModule:
+			if (ASpaceStationModule* Module = ResolveModuleHandle(Action.ModuleHandle))
+			{
+				DestroyModuleInternal(Module);
+				return true;
+			}
+			UE_LOG(LogAdastreaStations, Warning, TEXT("Redo RemoveModule failed: Module is no longer placed."));
+			break;
+			
+		case EEditorActionType::MoveModule:
+			if (ASpaceStationModule* Module = ResolveModuleHandle(Action.ModuleHandle))
+			{
+				Module->SetActorLocation(Action.NewPosition);
+				UpdateOccupancy(Module);
+				return true;
+			}
+			UE_LOG(LogAdastreaStations, Warning, TEXT("Redo MoveModule failed: Module is invalid or being destroyed."));
+			break;
+			
+		case EEditorActionType::RotateModule:
+			if (ASpaceStationModule* Module = ResolveModuleHandle(Action.ModuleHandle))
+			{
+				Module->SetActorRotation(Action.NewRotation);
+				UpdateOccupancy(Module);
+				return true;
+			}
+			UE_LOG(LogAdastreaStations, Warning, TEXT("Redo RotateModule failed: Module is invalid or being destroyed."));
+			break;
+			
+		case EEditorActionType::UpgradeModule:
+			// Upgrade actions are not undoable/redoable - just log and return false
+			UE_LOG(LogAdastreaStations, Log, TEXT("UpgradeModule cannot be redone."));
+			break;
+			
+		default:
+			break;
+	}
+	
+	return false;
+}
+
+bool UStationEditorManager::ReverseAction(const FEditorAction& Action)
+{
+	switch (Action.ActionType)
+	{
+		case EEditorActionType::PlaceModule:
+			// Reverse of place = remove
+			if (ASpaceStationModule* Module = ResolveModuleHandle(Action.ModuleHandle))
+			{
+				DestroyModuleInternal(Module);
+				return true;
+			}
+			UE_LOG(LogAdastreaStations, Warning, TEXT("Undo PlaceModule failed: Module is no longer placed."));
+			break;
+			
+		case EEditorActionType::RemoveModule:
+			// Reverse of remove = place under the same handle, so later steps still find it
+			// Don't call PlaceModule as it records a new action
+			if (ASpaceStationModule* NewModule = SpawnModuleInternal(Action.ModuleClass, Action.PreviousPosition, Action.PreviousRotation))
+			{
+				BindModuleHandle(NewModule, Action.ModuleHandle);
+				return true;
+			}
+			break;
+			
+		case EEditorActionType::MoveModule:
+			if (ASpaceStationModule* Module = ResolveModuleHandle(Action.ModuleHandle))
+			{
+				Module->SetActorLocation(Action.PreviousPosition);
+				UpdateOccupancy(Module);
+				return true;
+			}
+			UE_LOG(LogAdastreaStations, Warning, TEXT("Undo MoveModule failed: Module is invalid or being destroyed."));
+			break;
+			
+		case EEditorActionType::RotateModule:
+			if (ASpaceStationModule* Module = ResolveModuleHandle(Action.ModuleHandle))
+			{
+				Module->SetActorRotation(Action.PreviousRotation);
+				UpdateOccupancy(Module);
+				return true;
+			}
+			UE_LOG(LogAdastreaStations, Warning, TEXT("Undo RotateModule failed: Module is invalid or being destroyed."));
+			break;
+			
+		case EEditorActionType::UpgradeModule:
+			// Upgrade actions are not undoable/redoable - just log and return false
+			UE_LOG(LogAdastreaStations, Log, TEXT("UpgradeModule cannot be undone."));
+			break;
+			
+		default:
+			break;
+	}
+	
+	return false;
+}
+
+void UStationEditorManager::NotifyUndoRedoStateChanged()
+{
+	if (BatchDepth > 0)
+	{
+		bPendingUndoRedoNotify = true;
+		return;
+	}
+
+	OnUndoRedoStateChanged.Broadcast(CanUndo(), CanRedo());
+}
+
+// =====================
+// Module Connections
+// =====================
+
+bool UStationEditorManager::AddConnection(ASpaceStationModule* ModuleA, ASpaceStationModule* ModuleB, EModuleConnectionType ConnectionType)
+{
+	if (!LinkModules(ModuleA, ModuleB, ConnectionType))
+	{
+		return false;
+	}
+
+	OnConnectionChanged.Broadcast(Connections.Last());
+
+	UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::AddConnection - Added %d connection between %s and %s"),
+		static_cast<int32>(ConnectionType), *ModuleA->GetName(), *ModuleB->GetName());
+
+	return true;
+}
+
+bool UStationEditorManager::LinkModules(ASpaceStationModule* ModuleA, ASpaceStationModule* ModuleB, EModuleConnectionType ConnectionType)
+{
+	if (!ModuleA || !ModuleB || ModuleA == ModuleB)
+	{
+		return false;
+	}
+
+	// Link in the type's network; fails if the connection already exists
+	if (!GetNetwork(ConnectionType).AddLink(ModuleA, ModuleB))
+	{
+		return false;
+	}
+
+	FModuleConnection NewConnection;
+	NewConnection.ModuleA = ModuleA;
+	NewConnection.ModuleB = ModuleB;
+	NewConnection.ConnectionType = ConnectionType;
+	NewConnection.bIsActive = true;
+	
+	// Set capacity based on connection type using configurable defaults
+	switch (ConnectionType)
+	{
+		case EModuleConnectionType::Power:
+			NewConnection.Capacity = DefaultPowerConnectionCapacity; // MW
 			break;
 		case EModuleConnectionType::Data:
 			NewConnection.Capacity = DefaultDataConnectionCapacity; // Mbps
@@ -1088,12 +1406,8 @@ bool UStationEditorManager::AddConnection(ASpaceStationModule* ModuleA, ASpaceSt
 	}
 
 	Connections.Add(NewConnection);
-	OnConnectionChanged.Broadcast(NewConnection);
 	bStatisticsDirty = true;
 
-	UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::AddConnection - Added %d connection between %s and %s"),
-		static_cast<int32>(ConnectionType), *ModuleA->GetName(), *ModuleB->GetName());
-
 	return true;
 }
 
@@ -1108,6 +1422,7 @@ bool UStationEditorManager::RemoveConnection(ASpaceStationModule* ModuleA, ASpac
 		{
 			FModuleConnection RemovedConnection = Connections[i];
 			Connections.RemoveAt(i);
+			GetNetwork(ConnectionType).RemoveLink(ModuleA, ModuleB);
 			OnConnectionChanged.Broadcast(RemovedConnection);
 			bStatisticsDirty = true;
 			return true;
@@ -1152,37 +1467,46 @@ TArray<FModuleConnection> UStationEditorManager::GetAllConnections() const
 }
 
 void UStationEditorManager::AutoGenerateConnections(ASpaceStationModule* Module)
+{
+	// Batches report new links through OnModulesChanged instead of per connection
+	ConnectAdjacentModules(Module, BatchDepth == 0);
+}
+
+void UStationEditorManager::ConnectAdjacentModules(ASpaceStationModule* Module, bool bBroadcast)
 {
 	if (!Module || !CurrentStation || !GridSystem)
 	{
 		return;
 	}
 
-	FVector ModulePosition = Module->GetActorLocation();
-	
-	// Check all existing modules for adjacency
-	for (ASpaceStationModule* OtherModule : CurrentStation->Modules)
+	const FStationModuleFootprint* Footprint = OccupancyGrid.FindFootprint(Module);
+	if (!Footprint)
 	{
-		if (!OtherModule || OtherModule == Module)
-		{
-			continue;
-		}
+		return;
+	}
+
+	// Only modules whose footprints share a face with this one
+	TArray<ASpaceStationModule*> AdjacentModules;
+	OccupancyGrid.GetAdjacentModules(*Footprint, AdjacentModules, Module);
+
+	auto Connect = [this, Module, bBroadcast](ASpaceStationModule* OtherModule, EModuleConnectionType ConnectionType)
+	{
+		return bBroadcast ? AddConnection(Module, OtherModule, ConnectionType) : LinkModules(Module, OtherModule, ConnectionType);
+	};
+
+	for (ASpaceStationModule* OtherModule : AdjacentModules)
+	{
+		// Auto-add power connection
+		Connect(OtherModule, EModuleConnectionType::Power);
+		
+		// Auto-add data connection
+		Connect(OtherModule, EModuleConnectionType::Data);
 		
-		// Check if modules are adjacent
-		if (GridSystem->ArePositionsAdjacent(ModulePosition, OtherModule->GetActorLocation()))
+		// Add life support if either module is habitation-related
+		if (Module->ModuleGroup == EStationModuleGroup::Habitation ||
+			OtherModule->ModuleGroup == EStationModuleGroup::Habitation)
 		{
-			// Auto-add power connection
-			AddConnection(Module, OtherModule, EModuleConnectionType::Power);
-			
-			// Auto-add data connection
-			AddConnection(Module, OtherModule, EModuleConnectionType::Data);
-			
-			// Add life support if either module is habitation-related
-			if (Module->ModuleGroup == EStationModuleGroup::Habitation ||
-				OtherModule->ModuleGroup == EStationModuleGroup::Habitation)
-			{
-				AddConnection(Module, OtherModule, EModuleConnectionType::LifeSupport);
-			}
+			Connect(OtherModule, EModuleConnectionType::LifeSupport);
 		}
 	}
 }
@@ -1191,29 +1515,17 @@ bool UStationEditorManager::IsConnectedToPower(const ASpaceStationModule* Module
 {
 	if (!Module || !CurrentStation)
 	{
-		return false;
-	}
-
-	// Simple check: see if module has any power connections
-	// A full implementation would do graph traversal to find path to reactor
-	for (const FModuleConnection& Conn : Connections)
-	{
-		if (Conn.ConnectionType == EModuleConnectionType::Power && Conn.bIsActive)
-		{
-			if (Conn.ModuleA == Module || Conn.ModuleB == Module)
-			{
-				return true;
-			}
-		}
+		return false;
 	}
-	
+
 	// Power generators are always "connected"
-	if (Module->ModuleGroup == EStationModuleGroup::Power)
+	if (FStationModuleTotals::IsGenerator(Module))
 	{
 		return true;
 	}
 	
-	return false;
+	// Otherwise the module's power network must contain a generator
+	return PowerNetwork.GetReachableSourceCount(Module) > 0;
 }
 
 bool UStationEditorManager::HasLifeSupport(const ASpaceStationModule* Module) const
@@ -1223,18 +1535,53 @@ bool UStationEditorManager::HasLifeSupport(const ASpaceStationModule* Module) co
 		return false;
 	}
 
-	for (const FModuleConnection& Conn : Connections)
+	// Linked into a life support network that reaches a habitation module
+	return LifeSupportNetwork.GetDegree(Module) > 0 && LifeSupportNetwork.GetReachableSourceCount(Module) > 0;
+}
+
+bool UStationEditorManager::AreModulesConnected(const ASpaceStationModule* ModuleA, const ASpaceStationModule* ModuleB, EModuleConnectionType ConnectionType) const
+{
+	return GetNetwork(ConnectionType).AreConnected(ModuleA, ModuleB);
+}
+
+FStationNetworkGraph& UStationEditorManager::GetNetwork(EModuleConnectionType ConnectionType)
+{
+	switch (ConnectionType)
+	{
+		case EModuleConnectionType::Data:
+			return DataNetwork;
+		case EModuleConnectionType::LifeSupport:
+			return LifeSupportNetwork;
+		case EModuleConnectionType::Power:
+		default:
+			return PowerNetwork;
+	}
+}
+
+const FStationNetworkGraph& UStationEditorManager::GetNetwork(EModuleConnectionType ConnectionType) const
+{
+	return const_cast<UStationEditorManager*>(this)->GetNetwork(ConnectionType);
+}
+
+void UStationEditorManager::RemoveModuleConnections(ASpaceStationModule* Module)
+{
+	// Batches prune every removed module's connections together in EndBatch
+	if (BatchDepth > 0)
 	{
-		if (Conn.ConnectionType == EModuleConnectionType::LifeSupport && Conn.bIsActive)
+		PendingConnectionPrunes.Add(Module);
+	}
+	else
+	{
+		Connections.RemoveAll([Module](const FModuleConnection& Conn)
 		{
-			if (Conn.ModuleA == Module || Conn.ModuleB == Module)
-			{
-				return true;
-			}
-		}
+			return Conn.ModuleA == Module || Conn.ModuleB == Module;
+		});
 	}
-	
-	return false;
+
+	PowerNetwork.RemoveModule(Module);
+	DataNetwork.RemoveModule(Module);
+	LifeSupportNetwork.RemoveModule(Module);
+	bStatisticsDirty = true;
 }
 
 // =====================
@@ -1248,10 +1595,16 @@ int32 UStationEditorManager::QueueConstruction(TSubclassOf<ASpaceStationModule>
 		return -1;
 	}
 
+	UStationConstructionScheduler* Scheduler = GetConstructionScheduler();
+	if (!Scheduler)
+	{
+		UE_LOG(LogAdastreaStations, Warning, TEXT("StationEditorManager::QueueConstruction - No station or construction scheduler"));
+		return -1;
+	}
+
 	FConstructionQueueItem Item;
-	Item.QueueId = NextQueueId++;
 	Item.ModuleClass = ModuleClass;
-	Item.TargetPosition = Position;
+	Item.TargetPosition = bSnapToGrid && GridSystem ? GridSystem->SnapToGrid(Position) : Position;
 	Item.TargetRotation = Rotation;
 	
 	// Get build time from catalog
@@ -1267,15 +1620,13 @@ int32 UStationEditorManager::QueueConstruction(TSubclassOf<ASpaceStationModule>
 		Item.TimeRemaining = DefaultBuildTime;
 	}
 	
-	// Start building if this is the first item
-	if (ConstructionQueue.Num() == 0)
+	// The scheduler starts it as soon as the station has a free build slot
+	const int32 QueueId = Scheduler->QueueConstruction(CurrentStation, Item);
+	if (QueueId < 0)
 	{
-		Item.bIsBuilding = true;
+		return -1;
 	}
 	
-	ConstructionQueue.Add(Item);
-	OnConstructionQueueChanged.Broadcast();
-	
 	// Add notification
 	ASpaceStationModule* DefaultModule = ModuleClass->GetDefaultObject<ASpaceStationModule>();
 	FString ModuleName = DefaultModule ? DefaultModule->ModuleType : TEXT("Module");
@@ -1283,174 +1634,311 @@ int32 UStationEditorManager::QueueConstruction(TSubclassOf<ASpaceStationModule>
 		ENotificationSeverity::Info, nullptr);
 	
 	UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::QueueConstruction - Queued %s (ID: %d)"),
-		*ModuleClass->GetName(), Item.QueueId);
+		*ModuleClass->GetName(), QueueId);
 
-	return Item.QueueId;
+	return QueueId;
 }
 
 bool UStationEditorManager::CancelConstruction(int32 QueueId)
 {
-	for (int32 i = 0; i < ConstructionQueue.Num(); ++i)
-	{
-		if (ConstructionQueue[i].QueueId == QueueId)
-		{
-			ConstructionQueue.RemoveAt(i);
-			
-			// Start next item if we removed the current one
-			if (i == 0 && ConstructionQueue.Num() > 0)
-			{
-				ConstructionQueue[0].bIsBuilding = true;
-			}
-			
-			OnConstructionQueueChanged.Broadcast();
-			return true;
-		}
-	}
-	return false;
+	UStationConstructionScheduler* Scheduler = GetConstructionScheduler();
+	return Scheduler && Scheduler->CancelConstruction(QueueId);
 }
 
 bool UStationEditorManager::SetConstructionPaused(int32 QueueId, bool bPause)
 {
-	for (FConstructionQueueItem& Item : ConstructionQueue)
-	{
-		if (Item.QueueId == QueueId)
-		{
-			Item.bIsPaused = bPause;
-			OnConstructionQueueChanged.Broadcast();
-			return true;
-		}
-	}
-	return false;
+	UStationConstructionScheduler* Scheduler = GetConstructionScheduler();
+	return Scheduler && Scheduler->SetConstructionPaused(QueueId, bPause);
 }
 
 bool UStationEditorManager::ReorderConstruction(int32 QueueId, bool MoveUp)
 {
-	for (int32 i = 0; i < ConstructionQueue.Num(); ++i)
+	UStationConstructionScheduler* Scheduler = GetConstructionScheduler();
+	return Scheduler && Scheduler->ReorderConstruction(QueueId, MoveUp);
+}
+
+TArray<FConstructionQueueItem> UStationEditorManager::GetConstructionQueue() const
+{
+	const UStationConstructionScheduler* Scheduler = GetConstructionScheduler();
+	return Scheduler ? Scheduler->GetConstructionQueue(CurrentStation) : TArray<FConstructionQueueItem>();
+}
+
+bool UStationEditorManager::GetCurrentConstruction(FConstructionQueueItem& OutItem) const
+{
+	for (const FConstructionQueueItem& Item : GetConstructionQueue())
 	{
-		if (ConstructionQueue[i].QueueId == QueueId)
+		if (Item.bIsBuilding)
 		{
-			int32 NewIndex = MoveUp ? i - 1 : i + 1;
-			
-			// Can't move first item up or last item down
-			if (NewIndex < 0 || NewIndex >= ConstructionQueue.Num())
-			{
-				return false;
-			}
-			
-			// Can't move if we're currently building (first item)
-			if (i == 0 && ConstructionQueue[i].bIsBuilding)
-			{
-				return false;
-			}
-			
-			// Swap items
-			FConstructionQueueItem Temp = ConstructionQueue[i];
-			ConstructionQueue[i] = ConstructionQueue[NewIndex];
-			ConstructionQueue[NewIndex] = Temp;
-			
-			OnConstructionQueueChanged.Broadcast();
+			OutItem = Item;
 			return true;
 		}
 	}
 	return false;
 }
 
-TArray<FConstructionQueueItem> UStationEditorManager::GetConstructionQueue() const
+void UStationEditorManager::UpdateConstruction(float DeltaTime)
+{
+	CurrentTime += DeltaTime;
+}
+
+UStationConstructionScheduler* UStationEditorManager::GetConstructionScheduler() const
 {
-	return ConstructionQueue;
+	UWorld* World = CurrentStation ? CurrentStation->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UStationConstructionScheduler>() : nullptr;
 }
 
-bool UStationEditorManager::GetCurrentConstruction(FConstructionQueueItem& OutItem) const
+void UStationEditorManager::HandleConstructionQueueChanged(ASpaceStation* Station)
 {
-	if (ConstructionQueue.Num() > 0 && ConstructionQueue[0].bIsBuilding)
+	if (Station == CurrentStation)
 	{
-		OutItem = ConstructionQueue[0];
-		return true;
+		OnConstructionQueueChanged.Broadcast();
 	}
-	return false;
 }
 
-void UStationEditorManager::UpdateConstruction(float DeltaTime)
+void UStationEditorManager::HandleConstructionCompleted(ASpaceStation* Station, ASpaceStationModule* Module, int32 QueueId)
 {
-	CurrentTime += DeltaTime;
-	
-	if (ConstructionQueue.Num() == 0)
+	if (Station != CurrentStation)
 	{
 		return;
 	}
-	
-	FConstructionQueueItem& CurrentItem = ConstructionQueue[0];
-	
-	if (!CurrentItem.bIsBuilding)
+
+	// Construction from queue is a committed action, not an editor operation, so no undo is recorded
+	RegisterSpawnedModule(Module);
+
+	// Add completion notification
+	AddNotification(FText::FromString(FString::Printf(TEXT("%s construction complete"), *Module->ModuleType)),
+		ENotificationSeverity::Success, Module);
+
+	UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::HandleConstructionCompleted - Built %s (ID: %d)"),
+		*Module->GetName(), QueueId);
+}
+
+// =====================
+// Station Templates
+// =====================
+
+bool UStationEditorManager::InstantiateTemplate(UStationTemplate* Template)
+{
+	if (!bIsEditing || !CurrentStation || !GridSystem)
 	{
-		CurrentItem.bIsBuilding = true;
+		UE_LOG(LogAdastreaStations, Warning, TEXT("StationEditorManager::InstantiateTemplate - Not in editing mode"));
+		return false;
 	}
-	
-	if (CurrentItem.bIsPaused)
+
+	if (!Template || !Template->IsTemplateValid())
+	{
+		UE_LOG(LogAdastreaStations, Warning, TEXT("StationEditorManager::InstantiateTemplate - Invalid template"));
+		return false;
+	}
+
+	if (IsInstantiatingTemplate())
+	{
+		UE_LOG(LogAdastreaStations, Warning, TEXT("StationEditorManager::InstantiateTemplate - Template %s is still being instantiated"),
+			*ActiveTemplate->GetName());
+		return false;
+	}
+
+	UWorld* World = CurrentStation->GetWorld();
+	if (!World)
+	{
+		UE_LOG(LogAdastreaStations, Error, TEXT("StationEditorManager::InstantiateTemplate - No world available"));
+		return false;
+	}
+
+	ActiveTemplate = Template;
+	TemplateModules.Reset(Template->Modules.Num());
+	TemplateTransaction = FEditorTransaction();
+	TemplateTransaction.Description = Template->DisplayName.IsEmpty() ? FText::FromString(Template->GetName()) : Template->DisplayName;
+	TemplateTransaction.Actions.Reserve(Template->Modules.Num());
+	TemplateOriginCell = GridSystem->GetGridCoordinate(CurrentStation->GetActorLocation());
+
+	TemplateTimerHandle = World->GetTimerManager().SetTimerForNextTick(
+		FTimerDelegate::CreateUObject(this, &UStationEditorManager::ProcessTemplateInstantiation));
+
+	UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::InstantiateTemplate - Instantiating %s (%d modules)"),
+		*Template->GetName(), Template->Modules.Num());
+
+	return true;
+}
+
+void UStationEditorManager::CancelTemplateInstantiation()
+{
+	if (!IsInstantiatingTemplate())
 	{
 		return;
 	}
-	
-	CurrentItem.TimeRemaining -= DeltaTime;
-	
-	if (CurrentItem.TimeRemaining <= 0.0f)
+
+	if (UWorld* World = CurrentStation ? CurrentStation->GetWorld() : nullptr)
 	{
-		CompleteConstruction(CurrentItem);
-		ConstructionQueue.RemoveAt(0);
-		
-		// Start next item
-		if (ConstructionQueue.Num() > 0)
-		{
-			ConstructionQueue[0].bIsBuilding = true;
-		}
-		
-		OnConstructionQueueChanged.Broadcast();
+		World->GetTimerManager().ClearTimer(TemplateTimerHandle);
+	}
+
+	UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::CancelTemplateInstantiation - Stopped after %d of %d modules"),
+		TemplateModules.Num(), ActiveTemplate->Modules.Num());
+
+	FinishTemplateInstantiation();
+}
+
+bool UStationEditorManager::IsInstantiatingTemplate() const
+{
+	return ActiveTemplate != nullptr;
+}
+
+float UStationEditorManager::GetTemplateInstantiationProgress() const
+{
+	if (!ActiveTemplate || ActiveTemplate->Modules.Num() == 0)
+	{
+		return 0.0f;
 	}
+	return static_cast<float>(TemplateModules.Num()) / static_cast<float>(ActiveTemplate->Modules.Num());
 }
 
-void UStationEditorManager::CompleteConstruction(FConstructionQueueItem& Item)
+void UStationEditorManager::ProcessTemplateInstantiation()
 {
-	if (!Item.ModuleClass || !CurrentStation)
+	TemplateTimerHandle.Invalidate();
+
+	UWorld* World = CurrentStation ? CurrentStation->GetWorld() : nullptr;
+	if (!ActiveTemplate || !World)
 	{
 		return;
 	}
-	
-	// Spawn the module directly without recording an undo action
-	// Construction from queue is a committed action, not an editor operation
-	UWorld* World = CurrentStation->GetWorld();
-	if (!World)
+
+	const TArray<FStationTemplateModule>& Entries = ActiveTemplate->Modules;
+	const double Deadline = FPlatformTime::Seconds() + TemplateSpawnBudgetMs / 1000.0;
+
+	// At least one module per frame so a tiny budget still makes progress
+	while (TemplateModules.Num() < Entries.Num())
+	{
+		TemplateModules.Add(SpawnTemplateModule(Entries[TemplateModules.Num()]));
+
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			break;
+		}
+	}
+
+	if (TemplateModules.Num() < Entries.Num())
 	{
+		TemplateTimerHandle = World->GetTimerManager().SetTimerForNextTick(
+			FTimerDelegate::CreateUObject(this, &UStationEditorManager::ProcessTemplateInstantiation));
 		return;
 	}
-	
-	FVector FinalPosition = bSnapToGrid && GridSystem ? GridSystem->SnapToGrid(Item.TargetPosition) : Item.TargetPosition;
-	
+
+	FinishTemplateInstantiation();
+}
+
+ASpaceStationModule* UStationEditorManager::SpawnTemplateModule(const FStationTemplateModule& Entry)
+{
+	const FIntVector Cell = TemplateOriginCell + Entry.Cell;
+	const FVector Position = GridSystem->GridCoordinateToWorld(Cell);
+
+	// Multi-cell modules can collide with neighbours even when their origin cell is free
+	if (OccupancyGrid.Overlaps(ComputeFootprint(Entry.ModuleClass, Position, Entry.Rotation)))
+	{
+		UE_LOG(LogAdastreaStations, Warning, TEXT("StationEditorManager::SpawnTemplateModule - %s at cell (%d, %d, %d) overlaps an existing module, skipping"),
+			*Entry.ModuleClass->GetName(), Cell.X, Cell.Y, Cell.Z);
+		return nullptr;
+	}
+
 	FActorSpawnParameters SpawnParams;
 	SpawnParams.Owner = CurrentStation;
-	
-	ASpaceStationModule* NewModule = World->SpawnActor<ASpaceStationModule>(
-		Item.ModuleClass,
-		FinalPosition,
-		Item.TargetRotation,
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ASpaceStationModule* NewModule = CurrentStation->GetWorld()->SpawnActor<ASpaceStationModule>(
+		Entry.ModuleClass,
+		Position,
+		Entry.Rotation,
 		SpawnParams
 	);
-	
-	if (NewModule)
+
+	if (!NewModule)
 	{
-		FVector RelativeLocation = FinalPosition - CurrentStation->GetActorLocation();
-		CurrentStation->AddModuleAtLocation(NewModule, RelativeLocation);
-		
-		// Auto-generate connections
-		AutoGenerateConnections(NewModule);
-		
-		bStatisticsDirty = true;
-		NotifyPowerBalanceChanged();
-		OnModulePlaced.Broadcast(NewModule);
-		
-		// Add completion notification
-		AddNotification(FText::FromString(FString::Printf(TEXT("%s construction complete"), *NewModule->ModuleType)),
-			ENotificationSeverity::Success, NewModule);
+		UE_LOG(LogAdastreaStations, Error, TEXT("StationEditorManager::SpawnTemplateModule - Failed to spawn %s"), *Entry.ModuleClass->GetName());
+		return nullptr;
+	}
+
+	CurrentStation->AddModuleAtLocation(NewModule, Position - CurrentStation->GetActorLocation());
+	UpdateOccupancy(NewModule);
+	ModulesAddedThisSession.Add(NewModule);
+
+	FEditorAction Action;
+	Action.ActionType = EEditorActionType::PlaceModule;
+	Action.ModuleClass = Entry.ModuleClass;
+	Action.Module = NewModule;
+	Action.ModuleHandle = BindModuleHandle(NewModule);
+	Action.NewPosition = Position;
+	Action.NewRotation = Entry.Rotation;
+	Action.Timestamp = CurrentTime;
+	TemplateTransaction.Actions.Add(Action);
+
+	return NewModule;
+}
+
+void UStationEditorManager::FinishTemplateInstantiation()
+{
+	UStationTemplate* Template = ActiveTemplate;
+
+	// Drop modules that were removed while the template was still spawning
+	int32 NumSpawned = 0;
+	for (ASpaceStationModule*& Module : TemplateModules)
+	{
+		if (Module && (!IsValid(Module) || Module->IsActorBeingDestroyed()))
+		{
+			Module = nullptr;
+		}
+		NumSpawned += Module ? 1 : 0;
+	}
+
+	BeginBatch();
+
+	// Wire everything in one pass now that the occupancy grid holds every module
+	const int32 FirstTemplateConnection = Connections.Num();
+	for (const FStationTemplateConnection& Connection : Template->Connections)
+	{
+		if (TemplateModules.IsValidIndex(Connection.ModuleIndexA) && TemplateModules.IsValidIndex(Connection.ModuleIndexB))
+		{
+			LinkModules(TemplateModules[Connection.ModuleIndexA], TemplateModules[Connection.ModuleIndexB], Connection.ConnectionType);
+		}
+	}
+
+	if (Template->bAutoGenerateConnections)
+	{
+		for (ASpaceStationModule* Module : TemplateModules)
+		{
+			ConnectAdjacentModules(Module, false);
+		}
+	}
+
+	bStatisticsDirty = true;
+	NotifyPowerBalanceChanged();
+
+	// The whole template is undone as one step; redo restores the links made here, not fresh adjacency
+	if (TemplateTransaction.Actions.Num() > 0)
+	{
+		TemplateTransaction.bHasLinkSet = true;
+		TemplateTransaction.Links.Reserve(Connections.Num() - FirstTemplateConnection);
+		for (int32 Index = FirstTemplateConnection; Index < Connections.Num(); ++Index)
+		{
+			FEditorLink& Link = TemplateTransaction.Links.AddDefaulted_GetRef();
+			Link.ModuleHandleA = GetModuleHandle(Connections[Index].ModuleA);
+			Link.ModuleHandleB = GetModuleHandle(Connections[Index].ModuleB);
+			Link.ConnectionType = Connections[Index].ConnectionType;
+		}
+
+		PushTransaction(MoveTemp(TemplateTransaction));
 	}
+
+	ActiveTemplate = nullptr;
+	TemplateModules.Reset();
+	TemplateTransaction = FEditorTransaction();
+
+	EndBatch();
+	RecalculateStatistics();
+
+	UE_LOG(LogAdastreaStations, Log, TEXT("StationEditorManager::FinishTemplateInstantiation - Spawned %d of %d modules from %s"),
+		NumSpawned, Template->Modules.Num(), *Template->GetName());
+
+	OnTemplateInstantiated.Broadcast(Template, NumSpawned);
 }
 
 // =====================
@@ -1471,6 +1959,21 @@ void UStationEditorManager::RecalculateStatistics()
 	RecalculateStatisticsInternal();
 }
 
+void UStationEditorManager::ResyncStatistics()
+{
+	ModuleTotals.Reset();
+	if (CurrentStation)
+	{
+		for (const ASpaceStationModule* Module : CurrentStation->Modules)
+		{
+			ModuleTotals.AddModule(Module);
+		}
+	}
+
+	RecalculateStatisticsInternal();
+	NotifyPowerBalanceChanged();
+}
+
 void UStationEditorManager::RecalculateStatisticsInternal() const
 {
 	CachedStatistics = FStationStatistics();
@@ -1489,16 +1992,10 @@ void UStationEditorManager::RecalculateStatisticsInternal() const
 	CachedStatistics.EfficiencyRating = GetEfficiencyRating();
 	
 	// Calculate cargo capacity using configurable default
-	for (const ASpaceStationModule* Module : CurrentStation->Modules)
-	{
-		if (Module && Module->ModuleGroup == EStationModuleGroup::Storage)
-		{
-			CachedStatistics.CargoCapacity += DefaultCargoCapacityPerModule;
-		}
-	}
+	CachedStatistics.CargoCapacity = static_cast<float>(ModuleTotals.GetGroupCount(EStationModuleGroup::Storage)) * DefaultCargoCapacityPerModule;
 	
 	// Calculate data network usage based on connections
-	int32 DataConnections = GetConnectionsByType(EModuleConnectionType::Data).Num();
+	int32 DataConnections = DataNetwork.GetLinkCount();
 	int32 NumModules = CurrentStation->Modules.Num();
 	if (NumModules < 2)
 	{
@@ -1513,15 +2010,8 @@ void UStationEditorManager::RecalculateStatisticsInternal() const
 	}
 	
 	// Calculate life support coverage
-	int32 LifeSupportConnections = GetConnectionsByType(EModuleConnectionType::LifeSupport).Num();
-	int32 HabitationModules = 0;
-	for (const ASpaceStationModule* Module : CurrentStation->Modules)
-	{
-		if (Module && Module->ModuleGroup == EStationModuleGroup::Habitation)
-		{
-			HabitationModules++;
-		}
-	}
+	int32 LifeSupportConnections = LifeSupportNetwork.GetLinkCount();
+	int32 HabitationModules = ModuleTotals.GetGroupCount(EStationModuleGroup::Habitation);
 	CachedStatistics.LifeSupportCoverage = HabitationModules > 0 ? 
 		FMath::Clamp(static_cast<float>(LifeSupportConnections) / static_cast<float>(HabitationModules), 0.0f, 1.0f) : 1.0f;
 	
@@ -1530,41 +2020,22 @@ void UStationEditorManager::RecalculateStatisticsInternal() const
 
 int32 UStationEditorManager::GetPopulationCapacity() const
 {
-	int32 Capacity = 0;
-	
 	if (!CurrentStation)
 	{
-		return Capacity;
+		return 0;
 	}
 	
-	for (const ASpaceStationModule* Module : CurrentStation->Modules)
-	{
-		if (Module && Module->ModuleGroup == EStationModuleGroup::Habitation)
-		{
-			Capacity += DefaultPopulationCapacityPerModule;
-		}
-	}
-	
-	return Capacity;
+	return ModuleTotals.GetGroupCount(EStationModuleGroup::Habitation) * DefaultPopulationCapacityPerModule;
 }
 
 float UStationEditorManager::GetDefenseRating() const
 {
-	float Rating = 0.0f;
-	
 	if (!CurrentStation)
 	{
-		return Rating;
-	}
-	
-	for (const ASpaceStationModule* Module : CurrentStation->Modules)
-	{
-		if (Module && Module->ModuleGroup == EStationModuleGroup::Defence)
-		{
-			Rating += DefaultDefenseRatingPerModule;
-		}
+		return 0.0f;
 	}
 	
+	const float Rating = static_cast<float>(ModuleTotals.GetGroupCount(EStationModuleGroup::Defence)) * DefaultDefenseRatingPerModule;
 	return FMath::Clamp(Rating, 0.0f, 100.0f);
 }
 
@@ -1588,15 +2059,8 @@ float UStationEditorManager::GetEfficiencyRating() const
 		Efficiency -= PowerOverProductionEfficiencyPenalty;
 	}
 	
-	// Connection efficiency
-	int32 ConnectedModules = 0;
-	for (const ASpaceStationModule* Module : CurrentStation->Modules)
-	{
-		if (Module && IsConnectedToPower(Module))
-		{
-			ConnectedModules++;
-		}
-	}
+	// Connection efficiency: generators plus the modules their networks supply (see IsConnectedToPower)
+	int32 ConnectedModules = ModuleTotals.GetGeneratorCount() + PowerNetwork.GetSuppliedModuleCount();
 	float ConnectionRatio = static_cast<float>(ConnectedModules) / static_cast<float>(CurrentStation->Modules.Num());
 	Efficiency *= ConnectionRatio;
 	
@@ -1784,6 +2248,9 @@ bool UStationEditorManager::UpgradeModule(ASpaceStationModule* Module)
 	PlayerCredits -= Cost.Credits;
 	
 	// Note: Upgrade actions are not recorded to undo stack as they cannot be reversed
+
+	// Pick up any power or group change from the upgrade
+	ModuleTotals.AddModule(Module);
 	
 	// Add notification
 	AddNotification(FText::FromString(FString::Printf(TEXT("%s upgraded successfully"), *Module->ModuleType)),
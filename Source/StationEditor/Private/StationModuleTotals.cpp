@@ -0,0 +1,78 @@
+// Copyright (c) 2025 Mittenzx. Licensed under MIT.
+
+#include "StationModuleTotals.h"
+#include "Stations/SpaceStationModule.h"
+
+void FStationModuleTotals::Reset()
+{
+	Contributions.Reset();
+	GroupCounts.Reset();
+	PowerGenerated = 0.0;
+	PowerConsumed = 0.0;
+	GeneratorCount = 0;
+}
+
+void FStationModuleTotals::AddModule(const ASpaceStationModule* Module)
+{
+	if (!Module)
+	{
+		return;
+	}
+
+	FContribution Contribution;
+	Contribution.Power = Module->ModulePower;
+	Contribution.Group = Module->ModuleGroup;
+	Contribution.bIsGenerator = IsGenerator(Module);
+
+	if (FContribution* Existing = Contributions.Find(Module))
+	{
+		Apply(*Existing, -1);
+		*Existing = Contribution;
+	}
+	else
+	{
+		Contributions.Add(Module, Contribution);
+	}
+	Apply(Contribution, 1);
+}
+
+bool FStationModuleTotals::RemoveModule(const ASpaceStationModule* Module)
+{
+	FContribution Contribution;
+	if (!Contributions.RemoveAndCopyValue(Module, Contribution))
+	{
+		return false;
+	}
+
+	Apply(Contribution, -1);
+	return true;
+}
+
+int32 FStationModuleTotals::GetGroupCount(EStationModuleGroup Group) const
+{
+	const int32* Count = GroupCounts.Find(Group);
+	return Count ? *Count : 0;
+}
+
+bool FStationModuleTotals::IsGenerator(const ASpaceStationModule* Module)
+{
+	return Module->ModuleGroup == EStationModuleGroup::Power || Module->ModulePower < 0.0f;
+}
+
+void FStationModuleTotals::Apply(const FContribution& Contribution, int32 Sign)
+{
+	if (Contribution.Power > 0.0f)
+	{
+		PowerConsumed += Sign * static_cast<double>(Contribution.Power);
+	}
+	else
+	{
+		PowerGenerated -= Sign * static_cast<double>(Contribution.Power);
+	}
+
+	GroupCounts.FindOrAdd(Contribution.Group) += Sign;
+	if (Contribution.bIsGenerator)
+	{
+		GeneratorCount += Sign;
+	}
+}
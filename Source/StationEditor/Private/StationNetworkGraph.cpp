@@ -0,0 +1,242 @@
+// Copyright (c) 2025 Mittenzx. Licensed under MIT.
+
+#include "StationNetworkGraph.h"
+
+void FStationNetworkGraph::Reset()
+{
+	NodeIndices.Reset();
+	Modules.Reset();
+	Neighbors.Reset();
+	SourceFlags.Reset();
+	Parents.Reset();
+	Ranks.Reset();
+	SourceCounts.Reset();
+	Sizes.Reset();
+	SuppliedCount = 0;
+	bComponentsDirty = false;
+	LinkCount = 0;
+}
+
+int32 FStationNetworkGraph::FindOrAddNode(ASpaceStationModule* Module)
+{
+	if (const int32* Existing = NodeIndices.Find(Module))
+	{
+		return *Existing;
+	}
+
+	const bool bIsSource = IsSource && IsSource(Module);
+	const int32 Node = Modules.Add(Module);
+	NodeIndices.Add(Module, Node);
+	Neighbors.AddDefaulted();
+	SourceFlags.Add(bIsSource);
+
+	// Keep components valid while clean; a dirty rebuild covers the new node anyway
+	if (!bComponentsDirty)
+	{
+		Parents.Add(Node);
+		Ranks.Add(0);
+		SourceCounts.Add(bIsSource ? 1 : 0);
+		Sizes.Add(1);
+	}
+	return Node;
+}
+
+int32 FStationNetworkGraph::FindRoot(int32 Node) const
+{
+	while (Parents[Node] != Node)
+	{
+		Parents[Node] = Parents[Parents[Node]];
+		Node = Parents[Node];
+	}
+	return Node;
+}
+
+void FStationNetworkGraph::Union(int32 NodeA, int32 NodeB) const
+{
+	int32 RootA = FindRoot(NodeA);
+	int32 RootB = FindRoot(NodeB);
+	if (RootA == RootB)
+	{
+		return;
+	}
+
+	if (Ranks[RootA] < Ranks[RootB])
+	{
+		Swap(RootA, RootB);
+	}
+
+	// Only components with a source supply their other modules
+	auto Supplied = [](int32 Size, int32 Sources) { return Sources > 0 ? Size - Sources : 0; };
+	SuppliedCount -= Supplied(Sizes[RootA], SourceCounts[RootA]) + Supplied(Sizes[RootB], SourceCounts[RootB]);
+
+	Parents[RootB] = RootA;
+	SourceCounts[RootA] += SourceCounts[RootB];
+	Sizes[RootA] += Sizes[RootB];
+	SuppliedCount += Supplied(Sizes[RootA], SourceCounts[RootA]);
+	if (Ranks[RootA] == Ranks[RootB])
+	{
+		++Ranks[RootA];
+	}
+}
+
+void FStationNetworkGraph::RebuildComponentsIfDirty() const
+{
+	if (!bComponentsDirty)
+	{
+		return;
+	}
+
+	const int32 NumNodes = Modules.Num();
+	Parents.SetNumUninitialized(NumNodes);
+	Ranks.SetNumUninitialized(NumNodes);
+	SourceCounts.SetNumUninitialized(NumNodes);
+	Sizes.SetNumUninitialized(NumNodes);
+	SuppliedCount = 0;
+	for (int32 Node = 0; Node < NumNodes; ++Node)
+	{
+		Parents[Node] = Node;
+		Ranks[Node] = 0;
+		SourceCounts[Node] = SourceFlags[Node] ? 1 : 0;
+		Sizes[Node] = 1;
+	}
+
+	for (int32 Node = 0; Node < NumNodes; ++Node)
+	{
+		for (const int32 Neighbor : Neighbors[Node])
+		{
+			if (Neighbor > Node)
+			{
+				Union(Node, Neighbor);
+			}
+		}
+	}
+
+	bComponentsDirty = false;
+}
+
+bool FStationNetworkGraph::AddLink(ASpaceStationModule* ModuleA, ASpaceStationModule* ModuleB)
+{
+	if (!ModuleA || !ModuleB || ModuleA == ModuleB || HasLink(ModuleA, ModuleB))
+	{
+		return false;
+	}
+
+	const int32 NodeA = FindOrAddNode(ModuleA);
+	const int32 NodeB = FindOrAddNode(ModuleB);
+	Neighbors[NodeA].Add(NodeB);
+	Neighbors[NodeB].Add(NodeA);
+	++LinkCount;
+
+	if (!bComponentsDirty)
+	{
+		Union(NodeA, NodeB);
+	}
+	return true;
+}
+
+bool FStationNetworkGraph::RemoveLink(ASpaceStationModule* ModuleA, ASpaceStationModule* ModuleB)
+{
+	const int32* NodeA = NodeIndices.Find(ModuleA);
+	const int32* NodeB = NodeIndices.Find(ModuleB);
+	if (!NodeA || !NodeB || Neighbors[*NodeA].RemoveSingleSwap(*NodeB, EAllowShrinking::No) == 0)
+	{
+		return false;
+	}
+
+	Neighbors[*NodeB].RemoveSingleSwap(*NodeA, EAllowShrinking::No);
+	--LinkCount;
+	bComponentsDirty = true;
+	return true;
+}
+
+void FStationNetworkGraph::RemoveModule(ASpaceStationModule* Module)
+{
+	int32 Node = INDEX_NONE;
+	if (!NodeIndices.RemoveAndCopyValue(Module, Node))
+	{
+		return;
+	}
+
+	for (const int32 Neighbor : Neighbors[Node])
+	{
+		Neighbors[Neighbor].RemoveSingleSwap(Node, EAllowShrinking::No);
+	}
+	LinkCount -= Neighbors[Node].Num();
+
+	// Swap the last node into the freed slot and repoint its neighbors
+	const int32 LastNode = Modules.Num() - 1;
+	if (Node != LastNode)
+	{
+		for (const int32 Neighbor : Neighbors[LastNode])
+		{
+			for (int32& Entry : Neighbors[Neighbor])
+			{
+				if (Entry == LastNode)
+				{
+					Entry = Node;
+				}
+			}
+		}
+		NodeIndices[Modules[LastNode]] = Node;
+	}
+
+	Modules.RemoveAtSwap(Node, 1, EAllowShrinking::No);
+	Neighbors.RemoveAtSwap(Node, 1, EAllowShrinking::No);
+	SourceFlags.RemoveAtSwap(Node, 1, EAllowShrinking::No);
+	bComponentsDirty = true;
+}
+
+bool FStationNetworkGraph::HasLink(const ASpaceStationModule* ModuleA, const ASpaceStationModule* ModuleB) const
+{
+	const int32* NodeA = NodeIndices.Find(ModuleA);
+	const int32* NodeB = NodeIndices.Find(ModuleB);
+	return NodeA && NodeB && Neighbors[*NodeA].Contains(*NodeB);
+}
+
+int32 FStationNetworkGraph::GetDegree(const ASpaceStationModule* Module) const
+{
+	const int32* Node = NodeIndices.Find(Module);
+	return Node ? Neighbors[*Node].Num() : 0;
+}
+
+bool FStationNetworkGraph::AreConnected(const ASpaceStationModule* ModuleA, const ASpaceStationModule* ModuleB) const
+{
+	const int32* NodeA = NodeIndices.Find(ModuleA);
+	const int32* NodeB = NodeIndices.Find(ModuleB);
+	if (!NodeA || !NodeB)
+	{
+		return false;
+	}
+
+	RebuildComponentsIfDirty();
+	return FindRoot(*NodeA) == FindRoot(*NodeB);
+}
+
+int32 FStationNetworkGraph::GetReachableSourceCount(const ASpaceStationModule* Module) const
+{
+	const int32* Node = NodeIndices.Find(Module);
+	if (!Node)
+	{
+		return 0;
+	}
+
+	RebuildComponentsIfDirty();
+	return SourceCounts[FindRoot(*Node)];
+}
+
+int32 FStationNetworkGraph::GetSuppliedModuleCount() const
+{
+	RebuildComponentsIfDirty();
+	return SuppliedCount;
+}
+
+void FStationNetworkGraph::GetLinkedModules(const ASpaceStationModule* Module, TArray<ASpaceStationModule*>& OutModules) const
+{
+	if (const int32* Node = NodeIndices.Find(Module))
+	{
+		for (const int32 Neighbor : Neighbors[*Node])
+		{
+			OutModules.Add(Modules[Neighbor]);
+		}
+	}
+}
@@ -0,0 +1,171 @@
+// Copyright (c) 2025 Mittenzx. Licensed under MIT.
+
+#include "StationOccupancyGrid.h"
+
+// =====================
+// Footprint
+// =====================
+
+bool FStationModuleFootprint::IsFaceAdjacent(const FStationModuleFootprint& Other) const
+{
+	// Ranges on one axis must touch end-to-end while the other two axes overlap
+	const bool bOverlapX = Min.X <= Other.Max.X && Other.Min.X <= Max.X;
+	const bool bOverlapY = Min.Y <= Other.Max.Y && Other.Min.Y <= Max.Y;
+	const bool bOverlapZ = Min.Z <= Other.Max.Z && Other.Min.Z <= Max.Z;
+
+	const bool bTouchX = Max.X + 1 == Other.Min.X || Other.Max.X + 1 == Min.X;
+	const bool bTouchY = Max.Y + 1 == Other.Min.Y || Other.Max.Y + 1 == Min.Y;
+	const bool bTouchZ = Max.Z + 1 == Other.Min.Z || Other.Max.Z + 1 == Min.Z;
+
+	return (bTouchX && bOverlapY && bOverlapZ)
+		|| (bTouchY && bOverlapX && bOverlapZ)
+		|| (bTouchZ && bOverlapX && bOverlapY);
+}
+
+// =====================
+// Occupancy Grid
+// =====================
+
+void FStationOccupancyGrid::Reset()
+{
+	Footprints.Reset();
+	Chunks.Reset();
+}
+
+FIntVector FStationOccupancyGrid::CellToChunk(const FIntVector& Cell)
+{
+	// Floor division so negative cells land in negative chunks
+	auto FloorDiv = [](int32 Value)
+	{
+		return Value >= 0 ? Value / ChunkCells : (Value - (ChunkCells - 1)) / ChunkCells;
+	};
+	return FIntVector(FloorDiv(Cell.X), FloorDiv(Cell.Y), FloorDiv(Cell.Z));
+}
+
+template<typename VisitorType>
+void FStationOccupancyGrid::ForEachChunk(const FStationModuleFootprint& Footprint, VisitorType&& Visitor) const
+{
+	const FIntVector MinChunk = CellToChunk(Footprint.Min);
+	const FIntVector MaxChunk = CellToChunk(Footprint.Max);
+
+	for (int32 X = MinChunk.X; X <= MaxChunk.X; ++X)
+	{
+		for (int32 Y = MinChunk.Y; Y <= MaxChunk.Y; ++Y)
+		{
+			for (int32 Z = MinChunk.Z; Z <= MaxChunk.Z; ++Z)
+			{
+				if (const FChunkModules* ChunkModules = Chunks.Find(FIntVector(X, Y, Z)))
+				{
+					Visitor(*ChunkModules);
+				}
+			}
+		}
+	}
+}
+
+void FStationOccupancyGrid::AddModule(ASpaceStationModule* Module, const FStationModuleFootprint& Footprint)
+{
+	if (!Module)
+	{
+		return;
+	}
+
+	RemoveModule(Module);
+	Footprints.Add(Module, Footprint);
+
+	const FIntVector MinChunk = CellToChunk(Footprint.Min);
+	const FIntVector MaxChunk = CellToChunk(Footprint.Max);
+	for (int32 X = MinChunk.X; X <= MaxChunk.X; ++X)
+	{
+		for (int32 Y = MinChunk.Y; Y <= MaxChunk.Y; ++Y)
+		{
+			for (int32 Z = MinChunk.Z; Z <= MaxChunk.Z; ++Z)
+			{
+				Chunks.FindOrAdd(FIntVector(X, Y, Z)).Add(Module);
+			}
+		}
+	}
+}
+
+bool FStationOccupancyGrid::RemoveModule(ASpaceStationModule* Module)
+{
+	FStationModuleFootprint Footprint;
+	if (!Footprints.RemoveAndCopyValue(Module, Footprint))
+	{
+		return false;
+	}
+
+	const FIntVector MinChunk = CellToChunk(Footprint.Min);
+	const FIntVector MaxChunk = CellToChunk(Footprint.Max);
+	for (int32 X = MinChunk.X; X <= MaxChunk.X; ++X)
+	{
+		for (int32 Y = MinChunk.Y; Y <= MaxChunk.Y; ++Y)
+		{
+			for (int32 Z = MinChunk.Z; Z <= MaxChunk.Z; ++Z)
+			{
+				const FIntVector Chunk(X, Y, Z);
+				if (FChunkModules* ChunkModules = Chunks.Find(Chunk))
+				{
+					ChunkModules->RemoveSingleSwap(Module, EAllowShrinking::No);
+					if (ChunkModules->Num() == 0)
+					{
+						Chunks.Remove(Chunk);
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
+
+const FStationModuleFootprint* FStationOccupancyGrid::FindFootprint(const ASpaceStationModule* Module) const
+{
+	return Footprints.Find(Module);
+}
+
+ASpaceStationModule* FStationOccupancyGrid::GetModuleAt(const FIntVector& Cell) const
+{
+	if (const FChunkModules* ChunkModules = Chunks.Find(CellToChunk(Cell)))
+	{
+		for (ASpaceStationModule* Module : *ChunkModules)
+		{
+			if (Footprints.FindChecked(Module).Contains(Cell))
+			{
+				return Module;
+			}
+		}
+	}
+	return nullptr;
+}
+
+bool FStationOccupancyGrid::Overlaps(const FStationModuleFootprint& Footprint, const ASpaceStationModule* Ignore) const
+{
+	bool bOverlaps = false;
+	ForEachChunk(Footprint, [this, &Footprint, Ignore, &bOverlaps](const FChunkModules& ChunkModules)
+	{
+		for (const ASpaceStationModule* Module : ChunkModules)
+		{
+			if (!bOverlaps && Module != Ignore && Footprints.FindChecked(Module).Intersects(Footprint))
+			{
+				bOverlaps = true;
+			}
+		}
+	});
+	return bOverlaps;
+}
+
+void FStationOccupancyGrid::GetAdjacentModules(const FStationModuleFootprint& Footprint, TArray<ASpaceStationModule*>& OutModules, const ASpaceStationModule* Ignore) const
+{
+	// Neighbours sit at most one cell outside the footprint
+	ForEachChunk(Footprint.ExpandBy(1), [this, &Footprint, Ignore, &OutModules](const FChunkModules& ChunkModules)
+	{
+		for (ASpaceStationModule* Module : ChunkModules)
+		{
+			// Modules spanning several chunks show up once per chunk
+			if (Module != Ignore && Footprints.FindChecked(Module).IsFaceAdjacent(Footprint))
+			{
+				OutModules.AddUnique(Module);
+			}
+		}
+	});
+}
@@ -0,0 +1,25 @@
+// Copyright (c) 2025 Mittenzx. Licensed under MIT.
+
+#include "StationTemplate.h"
+
+bool UStationTemplate::IsTemplateValid() const
+{
+	for (const FStationTemplateModule& Module : Modules)
+	{
+		if (!Module.ModuleClass)
+		{
+			return false;
+		}
+	}
+
+	for (const FStationTemplateConnection& Connection : Connections)
+	{
+		if (!Modules.IsValidIndex(Connection.ModuleIndexA) || !Modules.IsValidIndex(Connection.ModuleIndexB)
+			|| Connection.ModuleIndexA == Connection.ModuleIndexB)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,258 @@
+// Copyright (c) 2025 Mittenzx. Licensed under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "StationEditorManager.h"
+#include "StationConstructionScheduler.generated.h"
+
+class ASpaceStation;
+class ASpaceStationModule;
+
+/** Broadcast when a station's construction queue changes */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnStationConstructionQueueChanged, ASpaceStation*);
+
+/** Broadcast when a queued module has been spawned and attached to its station (station, module, queue ID) */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnStationConstructionCompleted, ASpaceStation*, ASpaceStationModule*, int32);
+
+/**
+ * Queued build tracked by the construction scheduler
+ */
+USTRUCT()
+struct STATIONEDITOR_API FStationConstructionOrder
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FConstructionQueueItem Item;
+
+	/** Owning site, INDEX_NONE while the order slot is free */
+	int32 SiteIndex = INDEX_NONE;
+
+	/** World time the build completes (valid while building) */
+	double CompletionTime = 0.0;
+
+	/** Bumped whenever the order's pending completion becomes stale */
+	uint32 Serial = 0;
+
+	FStationConstructionOrder() = default;
+};
+
+/**
+ * Per-station build state
+ */
+USTRUCT()
+struct STATIONEDITOR_API FStationConstructionSite
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TWeakObjectPtr<ASpaceStation> Station;
+
+	/** Order indices in build priority order */
+	TArray<int32> Queue;
+
+	/** Orders that may build at once */
+	int32 BuildSlots = 1;
+
+	/** Orders currently building */
+	int32 ActiveBuilds = 0;
+
+	/** Whether the station's resource gate currently allows building */
+	bool bResourcesAvailable = true;
+
+	FStationConstructionSite() = default;
+};
+
+/**
+ * Station Construction Scheduler - World-wide construction queues for all stations
+ *
+ * Replaces per-editor queue ticking: every station's orders live in one
+ * contiguous array, and building orders are keyed by completion time in a
+ * min-heap. Each frame only pops the orders that are due, so the cost of a
+ * frame depends on how many builds finish rather than on how many stations
+ * are building.
+ *
+ * Each station builds up to BaseBuildSlots plus SlotsPerFabricationModule
+ * per AFabricationModule orders at once, in queue order. Building only
+ * progresses while the station's resource gate passes (by default a
+ * non-negative power balance); when it fails, running builds keep their
+ * remaining time and resume once it passes again. Slots and gates are
+ * re-evaluated round-robin, every station about once per
+ * ResourceCheckInterval, and immediately when a build on the station
+ * completes.
+ *
+ * Usage:
+ * - UStationEditorManager queues, cancels, pauses and reorders through this subsystem
+ * - Bind OnConstructionCompleted to react to modules built in the background
+ *
+ * @see UStationEditorManager
+ */
+UCLASS()
+class STATIONEDITOR_API UStationConstructionScheduler : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UStationConstructionScheduler();
+
+	/** Build slots every station has without fabrication modules */
+	static constexpr int32 BaseBuildSlots = 1;
+
+	/** Default extra build slots per fabrication module */
+	static constexpr int32 DefaultSlotsPerFabricationModule = 1;
+
+	/** Default seconds between slot and resource checks of a station */
+	static constexpr float DefaultResourceCheckInterval = 1.0f;
+
+	/** Decides whether a station can progress its builds */
+	using FResourceGate = TFunction<bool(const ASpaceStation*)>;
+
+	// =====================
+	// Subsystem Lifecycle
+	// =====================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// =====================
+	// Queue
+	// =====================
+
+	/**
+	 * Add a build to a station's queue
+	 * @param Station The station to build on
+	 * @param Item Module class, world-space target transform and build time; QueueId is assigned
+	 * @return Queue item ID, or -1 if failed
+	 */
+	int32 QueueConstruction(ASpaceStation* Station, const FConstructionQueueItem& Item);
+
+	/** Remove a build from its queue, freeing its slot if building */
+	bool CancelConstruction(int32 QueueId);
+
+	/** Pause or resume a build; a paused build keeps its progress and releases its slot */
+	bool SetConstructionPaused(int32 QueueId, bool bPause);
+
+	/** Move a queued build one place up or down in its station's queue */
+	bool ReorderConstruction(int32 QueueId, bool bMoveUp);
+
+	/**
+	 * Get a station's queue in priority order
+	 * @param Station The station to query
+	 * @return Queued and building items with current remaining times
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Construction")
+	TArray<FConstructionQueueItem> GetConstructionQueue(ASpaceStation* Station) const;
+
+	/**
+	 * Get the number of builds a station may run at once
+	 * @param Station The station to query
+	 * @return Build slots as of the station's last check
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Construction")
+	int32 GetBuildSlots(ASpaceStation* Station) const;
+
+	/** Builds currently running across all stations */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Construction")
+	int32 GetActiveBuildCount() const { return ActiveBuildCount; }
+
+	/** Queued and running builds across all stations */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Construction")
+	int32 GetOrderCount() const { return OrderIndices.Num(); }
+
+	// =====================
+	// Slots and Resources
+	// =====================
+
+	/** Replace the resource gate (an empty gate always allows building) */
+	void SetResourceGate(FResourceGate InResourceGate) { ResourceGate = MoveTemp(InResourceGate); }
+
+	/** Set the extra build slots granted per fabrication module */
+	UFUNCTION(BlueprintCallable, Category="Station Editor|Construction")
+	void SetSlotsPerFabricationModule(int32 InSlots) { SlotsPerFabricationModule = FMath::Max(0, InSlots); }
+
+	/** Set how often each station's slots and resource gate are re-evaluated */
+	UFUNCTION(BlueprintCallable, Category="Station Editor|Construction")
+	void SetResourceCheckInterval(float InSeconds) { ResourceCheckInterval = FMath::Max(0.1f, InSeconds); }
+
+	/**
+	 * Re-evaluate a station's slots and resource gate now instead of at its next periodic check
+	 * @param Station The station whose modules or resources changed
+	 */
+	UFUNCTION(BlueprintCallable, Category="Station Editor|Construction")
+	void RefreshStation(ASpaceStation* Station);
+
+	// =====================
+	// Events
+	// =====================
+
+	FOnStationConstructionQueueChanged OnQueueChanged;
+	FOnStationConstructionCompleted OnConstructionCompleted;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Pending completion in the min-heap; stale once the order's Serial moves on */
+	struct FConstructionCompletion
+	{
+		double Time;
+		int32 OrderIndex;
+		uint32 Serial;
+
+		bool operator<(const FConstructionCompletion& Other) const { return Time < Other.Time; }
+	};
+
+	double GetNow() const;
+
+	int32 FindOrAddSite(ASpaceStation* Station);
+	int32 AllocateOrder();
+	void ReleaseOrder(int32 OrderIndex);
+
+	/** Start a queued order, scheduling its completion */
+	void StartBuild(int32 OrderIndex, double Now);
+
+	/** Stop a building order, keeping its remaining time */
+	void StopBuild(int32 OrderIndex, double Now);
+
+	/** Start queued orders while the site has free slots; returns true if any started */
+	bool FillBuildSlots(int32 SiteIndex, double Now);
+
+	/** Recount slots, re-check the resource gate and fill slots; returns true if the queue changed */
+	bool RefreshSite(int32 SiteIndex, double Now);
+
+	void CompleteOrder(int32 OrderIndex, double Now);
+
+	/** Spawn a finished module and attach it to its station */
+	ASpaceStationModule* SpawnModule(ASpaceStation* Station, const FConstructionQueueItem& Item) const;
+
+	/** All orders; free slots are listed in FreeOrders */
+	UPROPERTY()
+	TArray<FStationConstructionOrder> Orders;
+	TArray<int32> FreeOrders;
+
+	/** Order index per queue ID */
+	TMap<int32, int32> OrderIndices;
+
+	/** Stations that have queued builds; indices are stable */
+	UPROPERTY()
+	TArray<FStationConstructionSite> Sites;
+	TMap<TObjectKey<ASpaceStation>, int32> SiteIndices;
+
+	/** Completion times of building orders */
+	TArray<FConstructionCompletion> CompletionHeap;
+
+	FResourceGate ResourceGate;
+
+	int32 NextQueueId;
+	int32 ActiveBuildCount;
+	int32 SlotsPerFabricationModule;
+	float ResourceCheckInterval;
+
+	/** Round-robin position and fractional carry of periodic site checks */
+	int32 RefreshCursor;
+	double RefreshCarry;
+};
@@ -7,11 +7,17 @@
 #include "Stations/SpaceStation.h"
 #include "Stations/SpaceStationModule.h"
 #include "StationModuleCatalog.h"
+#include "StationOccupancyGrid.h"
+#include "StationNetworkGraph.h"
+#include "StationModuleTotals.h"
 #include "StationEditorManager.generated.h"
 
 // Forward declarations
 class AStationBuildPreview;
 class UStationGridSystem;
+class UStationTemplate;
+class UStationConstructionScheduler;
+struct FStationTemplateModule;
 
 /**
  * Result of a module placement validation check
@@ -93,10 +99,14 @@ struct STATIONEDITOR_API FEditorAction
 	UPROPERTY(BlueprintReadOnly, Category="Editor Action")
 	TSubclassOf<ASpaceStationModule> ModuleClass;
 
-	/** The module instance (may be invalid after undo) */
+	/** The module instance when the action was recorded (may be invalid after undo; resolve ModuleHandle instead) */
 	UPROPERTY(BlueprintReadOnly, Category="Editor Action")
 	ASpaceStationModule* Module = nullptr;
 
+	/** Stable handle of the module, kept when undo/redo respawns it */
+	UPROPERTY(BlueprintReadOnly, Category="Editor Action")
+	FGuid ModuleHandle;
+
 	/** Position before the action */
 	UPROPERTY(BlueprintReadOnly, Category="Editor Action")
 	FVector PreviousPosition = FVector::ZeroVector;
@@ -120,6 +130,56 @@ struct STATIONEDITOR_API FEditorAction
 	FEditorAction() = default;
 };
 
+/**
+ * Connection restored by redo, between two modules identified by their stable handles
+ */
+USTRUCT(BlueprintType)
+struct STATIONEDITOR_API FEditorLink
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Editor Link")
+	FGuid ModuleHandleA;
+
+	UPROPERTY(BlueprintReadOnly, Category="Editor Link")
+	FGuid ModuleHandleB;
+
+	UPROPERTY(BlueprintReadOnly, Category="Editor Link")
+	EModuleConnectionType ConnectionType = EModuleConnectionType::Power;
+
+	FEditorLink() = default;
+};
+
+/**
+ * Group of editor actions undone and redone as a single step
+ */
+USTRUCT(BlueprintType)
+struct STATIONEDITOR_API FEditorTransaction
+{
+	GENERATED_BODY()
+
+	/** Actions in the order they were performed */
+	UPROPERTY(BlueprintReadOnly, Category="Editor Transaction")
+	TArray<FEditorAction> Actions;
+
+	/**
+	 * Whether the step carries its own link set (e.g. a template); redo then
+	 * restores exactly Links instead of auto-connecting the placed modules
+	 */
+	UPROPERTY(BlueprintReadOnly, Category="Editor Transaction")
+	bool bHasLinkSet = false;
+
+	/** Connections the step created, wired in one quiet pass after redoing the actions */
+	UPROPERTY(BlueprintReadOnly, Category="Editor Transaction")
+	TArray<FEditorLink> Links;
+
+	/** Description of the step (e.g. "Paste modules") */
+	UPROPERTY(BlueprintReadOnly, Category="Editor Transaction")
+	FText Description;
+
+	FEditorTransaction() = default;
+};
+
 /**
  * A connection between two modules
  */
@@ -334,6 +394,11 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnModulePlaced, ASpaceStationModule
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnModuleRemoved, ASpaceStationModule*, RemovedModule);
 
+/**
+ * Delegate broadcast once per batched operation (transaction, undo, redo) with every module it placed and removed
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnModulesChanged, const TArray<ASpaceStationModule*>&, PlacedModules, const TArray<ASpaceStationModule*>&, RemovedModules);
+
 /**
  * Delegate broadcast when power balance changes
  */
@@ -369,6 +434,11 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnViewModeChanged, EStationEditorVi
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnConnectionChanged, const FModuleConnection&, Connection);
 
+/**
+ * Delegate broadcast once a station template has finished instantiating
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTemplateInstantiated, UStationTemplate*, Template, int32, ModulesSpawned);
+
 /**
  * Station Editor Manager - Core manager class for station editing sessions
  * 
@@ -438,8 +508,8 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	static constexpr float DefaultDataConnectionCapacity = 1000.0f;   // Mbps
 	static constexpr float DefaultLifeSupportConnectionCapacity = 50.0f;  // Crew capacity
 
-	/** Distance threshold for module matching during undo/redo (squared) */
-	static constexpr float ModuleMatchDistanceSquared = 100.0f;
+	/** Default game-thread time spent spawning template modules per frame (milliseconds) */
+	static constexpr float DefaultTemplateSpawnBudgetMs = 4.0f;
 
 	// =====================
 	// Configuration
@@ -465,10 +535,14 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Station Editor|Configuration")
 	bool bCheckCollisions = true;
 
-	/** Collision radius for module placement validation (world units) */
+	/** Half-extent of the footprint assumed for module classes whose mesh bounds are not yet known (world units) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Station Editor|Configuration", meta=(ClampMin=10.0f, UIMin=10.0f))
 	float CollisionRadius = DefaultCollisionRadius;
 
+	/** Game-thread time spent spawning template modules per frame (milliseconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Station Editor|Configuration", meta=(ClampMin=0.1f, UIMin=0.1f))
+	float TemplateSpawnBudgetMs = DefaultTemplateSpawnBudgetMs;
+
 	// =====================
 	// State
 	// =====================
@@ -505,6 +579,13 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	UPROPERTY(BlueprintAssignable, Category="Station Editor|Events")
 	FOnModuleRemoved OnModuleRemoved;
 
+	/**
+	 * Called once at the end of a transaction, undo or redo instead of OnModulePlaced,
+	 * OnModuleRemoved and OnConnectionChanged per module; removed modules are already being destroyed
+	 */
+	UPROPERTY(BlueprintAssignable, Category="Station Editor|Events")
+	FOnModulesChanged OnModulesChanged;
+
 	/** Called when power balance changes */
 	UPROPERTY(BlueprintAssignable, Category="Station Editor|Events")
 	FOnPowerBalanceChanged OnPowerBalanceChanged;
@@ -533,6 +614,10 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	UPROPERTY(BlueprintAssignable, Category="Station Editor|Events")
 	FOnConnectionChanged OnConnectionChanged;
 
+	/** Called once when a station template has been spawned and wired */
+	UPROPERTY(BlueprintAssignable, Category="Station Editor|Events")
+	FOnTemplateInstantiated OnTemplateInstantiated;
+
 	// =====================
 	// Editing Lifecycle
 	// =====================
@@ -621,6 +706,7 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 
 	/**
 	 * Check if there are any collisions at the specified position
+	 * Tests the module's grid footprint against the station's occupancy grid
 	 * @param ModuleClass The module class to check collision for
 	 * @param Position Position to check
 	 * @param Rotation Rotation to check
@@ -629,6 +715,14 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	UFUNCTION(BlueprintCallable, Category="Station Editor|Validation")
 	bool CheckCollision(TSubclassOf<ASpaceStationModule> ModuleClass, FVector Position, FRotator Rotation) const;
 
+	/**
+	 * Get the module occupying a grid cell
+	 * @param GridCoordinate Cell in grid system coordinates
+	 * @return The module covering that cell, or nullptr if it is free
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Validation")
+	ASpaceStationModule* GetModuleAtGridCell(FIntVector GridCoordinate) const;
+
 	/**
 	 * Check if player has sufficient tech level for a module
 	 * @param ModuleClass The module class to check
@@ -735,14 +829,14 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	// =====================
 
 	/**
-	 * Undo the last action
+	 * Undo the last action or transaction
 	 * @return True if undo was successful
 	 */
 	UFUNCTION(BlueprintCallable, Category="Station Editor|Undo Redo")
 	bool Undo();
 
 	/**
-	 * Redo the last undone action
+	 * Redo the last undone action or transaction
 	 * @return True if redo was successful
 	 */
 	UFUNCTION(BlueprintCallable, Category="Station Editor|Undo Redo")
@@ -764,24 +858,64 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 
 	/**
 	 * Clear the undo/redo history
+	 * Also abandons an open transaction
 	 */
 	UFUNCTION(BlueprintCallable, Category="Station Editor|Undo Redo")
 	void ClearUndoHistory();
 
 	/**
-	 * Get the number of undoable actions
-	 * @return Number of actions in undo stack
+	 * Get the number of undoable steps
+	 * @return Number of actions or transactions in undo history
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Undo Redo")
 	int32 GetUndoCount() const;
 
 	/**
-	 * Get the number of redoable actions
-	 * @return Number of actions in redo stack
+	 * Get the number of redoable steps
+	 * @return Number of actions or transactions in redo history
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Undo Redo")
 	int32 GetRedoCount() const;
 
+	/**
+	 * Start grouping actions into one undo step (e.g. paste, apply template)
+	 * Statistics, power balance and undo/redo events are deferred until the
+	 * matching EndTransaction. Transactions may nest; only the outermost one
+	 * is recorded.
+	 * @param Description Description of the step
+	 */
+	UFUNCTION(BlueprintCallable, Category="Station Editor|Undo Redo")
+	void BeginTransaction(FText Description);
+
+	/**
+	 * Finish the transaction started by BeginTransaction
+	 */
+	UFUNCTION(BlueprintCallable, Category="Station Editor|Undo Redo")
+	void EndTransaction();
+
+	/**
+	 * Check if a transaction is open
+	 * @return True between BeginTransaction and the matching EndTransaction
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Undo Redo")
+	bool IsInTransaction() const;
+
+	/**
+	 * Get the stable handle for a module, assigning one if needed
+	 * @param Module The module
+	 * @return Handle that survives undo/redo respawning the module
+	 */
+	UFUNCTION(BlueprintCallable, Category="Station Editor|Undo Redo")
+	FGuid GetModuleHandle(ASpaceStationModule* Module);
+
+	/**
+	 * Find the live module for a handle
+	 * @param Handle Handle from GetModuleHandle or an editor action
+	 * @return The module, or nullptr if it is not currently placed
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Undo Redo")
+	ASpaceStationModule* FindModuleByHandle(FGuid Handle) const;
+
 	// =====================
 	// Module Connections
 	// =====================
@@ -831,6 +965,8 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 
 	/**
 	 * Auto-generate connections for a module based on adjacency
+	 * Inside a transaction, undo or redo the new links are reported by OnModulesChanged
+	 * instead of one OnConnectionChanged each
 	 * @param Module The newly placed module
 	 */
 	UFUNCTION(BlueprintCallable, Category="Station Editor|Connections")
@@ -847,17 +983,31 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	/**
 	 * Check if a module has life support
 	 * @param Module The module to check
-	 * @return True if module has life support connection
+	 * @return True if module is on a life support network with a habitation module
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Connections")
 	bool HasLifeSupport(const ASpaceStationModule* Module) const;
 
+	/**
+	 * Check if two modules are on the same network of a connection type
+	 * @param ModuleA First module
+	 * @param ModuleB Second module
+	 * @param ConnectionType Network to check
+	 * @return True if a path of connections links the modules
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Connections")
+	bool AreModulesConnected(const ASpaceStationModule* ModuleA, const ASpaceStationModule* ModuleB, EModuleConnectionType ConnectionType) const;
+
 	// =====================
 	// Construction Queue
 	// =====================
 
 	/**
-	 * Add a module to the construction queue
+	 * Add a module to the current station's construction queue
+	 * 
+	 * Queues are kept by UStationConstructionScheduler and keep building
+	 * after the editing session ends.
+	 * 
 	 * @param ModuleClass The module class to build
 	 * @param Position Target position
 	 * @param Rotation Target rotation
@@ -900,7 +1050,7 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	TArray<FConstructionQueueItem> GetConstructionQueue() const;
 
 	/**
-	 * Get the currently building item
+	 * Get the first item currently building (stations with fabrication modules may build several)
 	 * @param OutItem The item currently under construction
 	 * @return True if there is an item being built
 	 */
@@ -908,12 +1058,53 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	bool GetCurrentConstruction(FConstructionQueueItem& OutItem) const;
 
 	/**
-	 * Update construction progress (call each frame or timer)
+	 * Advance the editor clock used for action timestamps (call each frame or timer)
+	 * Construction itself progresses in UStationConstructionScheduler
 	 * @param DeltaTime Time since last update
 	 */
 	UFUNCTION(BlueprintCallable, Category="Station Editor|Construction")
 	void UpdateConstruction(float DeltaTime);
 
+	// =====================
+	// Station Templates
+	// =====================
+
+	/**
+	 * Spawn every module of a template into the current station
+	 * 
+	 * Modules are spawned over several frames within TemplateSpawnBudgetMs, then
+	 * connected in one pass. Per-module placement events are not broadcast;
+	 * OnTemplateInstantiated fires once at the end and the whole template is a
+	 * single undo step; redo restores the template's links rather than
+	 * re-deriving them. Templates are not charged against PlayerCredits.
+	 * Modules whose footprint overlaps an existing module are skipped.
+	 * 
+	 * @param Template The layout to build
+	 * @return True if instantiation started
+	 */
+	UFUNCTION(BlueprintCallable, Category="Station Editor|Templates")
+	bool InstantiateTemplate(UStationTemplate* Template);
+
+	/**
+	 * Stop instantiating the current template, keeping and connecting modules spawned so far
+	 */
+	UFUNCTION(BlueprintCallable, Category="Station Editor|Templates")
+	void CancelTemplateInstantiation();
+
+	/**
+	 * Check if a template is still being spawned
+	 * @return True while instantiation is in progress
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Templates")
+	bool IsInstantiatingTemplate() const;
+
+	/**
+	 * Get progress of the current template instantiation
+	 * @return Fraction of template modules processed (0-1)
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Editor|Templates")
+	float GetTemplateInstantiationProgress() const;
+
 	// =====================
 	// Station Statistics
 	// =====================
@@ -931,6 +1122,14 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	UFUNCTION(BlueprintCallable, Category="Station Editor|Statistics")
 	void RecalculateStatistics();
 
+	/**
+	 * Recount power and module group totals from the station's modules.
+	 * The editor keeps these totals up to date for its own edits; call this
+	 * after modules were added, removed or changed outside the editor.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Station Editor|Statistics")
+	void ResyncStatistics();
+
 	/**
 	 * Get total population capacity from habitation modules
 	 * @return Maximum population the station can support
@@ -1059,6 +1258,12 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	 */
 	void NotifyPowerBalanceChanged();
 
+	/**
+	 * Broadcast a placed or removed module, or queue it for the batch's OnModulesChanged
+	 */
+	void NotifyModulePlaced(ASpaceStationModule* Module);
+	void NotifyModuleRemoved(ASpaceStationModule* Module);
+
 	/**
 	 * Record an action for undo/redo
 	 */
@@ -1066,8 +1271,9 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 
 	/**
 	 * Execute an action (for redo)
+	 * @param bAutoConnect Whether a re-placed module connects to its neighbours
 	 */
-	bool ExecuteAction(const FEditorAction& Action);
+	bool ExecuteAction(const FEditorAction& Action, bool bAutoConnect = true);
 
 	/**
 	 * Reverse an action (for undo)
@@ -1080,9 +1286,87 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	void NotifyUndoRedoStateChanged();
 
 	/**
-	 * Complete a construction item and spawn the module
+	 * Add a finished step to the history, dropping the oldest when full
+	 */
+	void PushTransaction(FEditorTransaction&& Transaction);
+
+	/**
+	 * History index of the step at an offset from the oldest
+	 */
+	int32 GetHistorySlot(int32 Offset) const { return (HistoryStart + Offset) % MaxUndoStackSize; }
+
+	/**
+	 * Defer statistics, connection pruning and change events until the matching EndBatch
 	 */
-	void CompleteConstruction(FConstructionQueueItem& Item);
+	void BeginBatch();
+	void EndBatch();
+
+	/**
+	 * Remove the connections of modules removed during the batch from Connections in one pass
+	 */
+	void ApplyPendingConnectionPrunes();
+
+	/**
+	 * Drop any open transaction and batch, applying pending connection prunes,
+	 * so a missed EndTransaction can't suppress later steps and events
+	 */
+	void ResetBatchState();
+
+	/**
+	 * Spawn a module and add it to the station without recording an action
+	 */
+	ASpaceStationModule* SpawnModuleInternal(TSubclassOf<ASpaceStationModule> ModuleClass, FVector Position, FRotator Rotation, bool bAutoConnect = true);
+
+	/**
+	 * Remove a module from the station and destroy it without recording an action
+	 */
+	void DestroyModuleInternal(ASpaceStationModule* Module);
+
+	/**
+	 * Bind a handle to a module (a new handle if Handle is invalid)
+	 */
+	FGuid BindModuleHandle(ASpaceStationModule* Module, const FGuid& Handle = FGuid());
+
+	/**
+	 * Drop a module's handle binding (the handle itself stays valid in history)
+	 */
+	void ReleaseModuleHandle(ASpaceStationModule* Module);
+
+	/**
+	 * Live, non-destroyed module for a handle
+	 */
+	ASpaceStationModule* ResolveModuleHandle(const FGuid& Handle) const;
+
+	/**
+	 * Spawn the next slice of template modules and reschedule until done
+	 */
+	void ProcessTemplateInstantiation();
+
+	/**
+	 * Spawn one template module without events or connections; nullptr if skipped
+	 */
+	ASpaceStationModule* SpawnTemplateModule(const FStationTemplateModule& Entry);
+
+	/**
+	 * Connect spawned template modules, record the undo step and broadcast completion
+	 */
+	void FinishTemplateInstantiation();
+
+	/**
+	 * Add a freshly spawned and attached module to occupancy, connections and statistics
+	 */
+	void RegisterSpawnedModule(ASpaceStationModule* Module, bool bAutoConnect = true);
+
+	/**
+	 * Construction scheduler of the current station's world
+	 */
+	UStationConstructionScheduler* GetConstructionScheduler() const;
+
+	/**
+	 * Scheduler callbacks, bound while editing
+	 */
+	void HandleConstructionQueueChanged(ASpaceStation* Station);
+	void HandleConstructionCompleted(ASpaceStation* Station, ASpaceStationModule* Module, int32 QueueId);
 
 	/**
 	 * Generate a notification based on current station state
@@ -1094,31 +1378,106 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 	 */
 	void RecalculateStatisticsInternal() const;
 
+	/**
+	 * Grid cells covered by a world-space box
+	 */
+	FStationModuleFootprint ComputeFootprint(const FBox& WorldBounds) const;
+
+	/**
+	 * Grid cells a module class would cover at a position and rotation
+	 */
+	FStationModuleFootprint ComputeFootprint(TSubclassOf<ASpaceStationModule> ModuleClass, FVector Position, FRotator Rotation) const;
+
+	/**
+	 * Add or refresh a module's footprint in the occupancy grid and its share of the station totals
+	 */
+	void UpdateOccupancy(ASpaceStationModule* Module);
+
+	/**
+	 * Rebuild the occupancy grid and station totals from the current station's modules
+	 */
+	void RebuildOccupancyGrid();
+
+	/**
+	 * Network graph for a connection type
+	 */
+	FStationNetworkGraph& GetNetwork(EModuleConnectionType ConnectionType);
+	const FStationNetworkGraph& GetNetwork(EModuleConnectionType ConnectionType) const;
+
+	/**
+	 * Remove every connection involving a module from the connection list and networks
+	 */
+	void RemoveModuleConnections(ASpaceStationModule* Module);
+
+	/**
+	 * Add a connection without broadcasting it; returns false if it already exists
+	 */
+	bool LinkModules(ASpaceStationModule* ModuleA, ASpaceStationModule* ModuleB, EModuleConnectionType ConnectionType);
+
+	/**
+	 * Connect a module to its face-adjacent neighbours
+	 * @param bBroadcast Whether to broadcast OnConnectionChanged per new connection
+	 */
+	void ConnectAdjacentModules(ASpaceStationModule* Module, bool bBroadcast);
+
 private:
 	/** Cached last power balance for change detection */
 	float LastPowerBalance = 0.0f;
 
-	/** Undo stack for editor actions */
+	/**
+	 * Undo/redo history ring buffer: UndoCount steps starting at HistoryStart,
+	 * followed by RedoCount undone steps
+	 */
 	UPROPERTY()
-	TArray<FEditorAction> UndoStack;
+	TArray<FEditorTransaction> History;
 
-	/** Redo stack for editor actions */
-	UPROPERTY()
-	TArray<FEditorAction> RedoStack;
+	/** Slot of the oldest step in History */
+	int32 HistoryStart = 0;
+
+	/** Number of undoable steps */
+	int32 UndoCount = 0;
+
+	/** Number of redoable steps */
+	int32 RedoCount = 0;
 
-	/** Maximum size of undo/redo stacks */
+	/** Maximum number of steps kept in history */
 	static constexpr int32 MaxUndoStackSize = 50;
 
-	/** Module connections */
+	/** Transaction collecting actions between BeginTransaction and EndTransaction */
 	UPROPERTY()
-	TArray<FModuleConnection> Connections;
+	FEditorTransaction OpenTransaction;
+
+	/** Nesting depth of BeginTransaction calls */
+	int32 TransactionDepth = 0;
+
+	/** Nesting depth of batched operations (transactions, undo, redo) */
+	int32 BatchDepth = 0;
+
+	/** Deferred change events while batching */
+	bool bPendingPowerBalanceNotify = false;
+	bool bPendingUndoRedoNotify = false;
+
+	/** Modules whose connections are pruned from Connections when the batch ends */
+	TSet<ASpaceStationModule*> PendingConnectionPrunes;
+
+	/** Modules placed and removed in the current batch, reported by OnModulesChanged when it ends */
+	TArray<ASpaceStationModule*> PendingPlacedModules;
+	TArray<ASpaceStationModule*> PendingRemovedModules;
+
+	/** Live module per stable handle */
+	UPROPERTY()
+	TMap<FGuid, ASpaceStationModule*> ModulesByHandle;
 
-	/** Construction queue */
+	/** Stable handle per live module */
+	TMap<ASpaceStationModule*, FGuid> HandlesByModule;
+
+	/** Module connections */
 	UPROPERTY()
-	TArray<FConstructionQueueItem> ConstructionQueue;
+	TArray<FModuleConnection> Connections;
 
-	/** Next queue item ID */
-	int32 NextQueueId = 1;
+	/** Scheduler delegate bindings while editing */
+	FDelegateHandle ConstructionQueueChangedHandle;
+	FDelegateHandle ConstructionCompletedHandle;
 
 	/** Notifications */
 	UPROPERTY()
@@ -1139,4 +1498,56 @@ class STATIONEDITOR_API UStationEditorManager : public UObject
 
 	/** Current time (for timestamps) */
 	float CurrentTime = 0.0f;
+
+	/** Footprints of the current station's modules for collision and adjacency queries */
+	FStationOccupancyGrid OccupancyGrid;
+
+	/** Actor-space bounds per module class, learned from placed modules */
+	TMap<UClass*, FBox> ModuleLocalBounds;
+
+	/** Power and group totals of the current station's modules */
+	FStationModuleTotals ModuleTotals;
+
+	/** Connectivity per connection type, kept in sync with Connections */
+	FStationNetworkGraph PowerNetwork;
+	FStationNetworkGraph DataNetwork;
+	FStationNetworkGraph LifeSupportNetwork;
+
+	/** Template being instantiated, nullptr when idle */
+	UPROPERTY()
+	UStationTemplate* ActiveTemplate = nullptr;
+
+	/** Spawned module per processed template entry (nullptr where skipped) */
+	UPROPERTY()
+	TArray<ASpaceStationModule*> TemplateModules;
+
+	/** Undo step collecting the template's placements */
+	UPROPERTY()
+	FEditorTransaction TemplateTransaction;
+
+	/** Station grid cell that template cells are relative to */
+	FIntVector TemplateOriginCell = FIntVector::ZeroValue;
+
+	/** Next-tick timer driving template instantiation */
+	FTimerHandle TemplateTimerHandle;
+};
+
+/**
+ * Scope guard for native callers: opens a transaction on construction and
+ * closes it on destruction, so early returns can't leave it open
+ *
+ * Usage:
+ *   FStationEditorTransactionScope Scope(EditorManager, LOCTEXT("Paste", "Paste modules"));
+ */
+class STATIONEDITOR_API FStationEditorTransactionScope
+{
+public:
+	FStationEditorTransactionScope(UStationEditorManager* InManager, const FText& Description);
+	~FStationEditorTransactionScope();
+
+	FStationEditorTransactionScope(const FStationEditorTransactionScope&) = delete;
+	FStationEditorTransactionScope& operator=(const FStationEditorTransactionScope&) = delete;
+
+private:
+	TWeakObjectPtr<UStationEditorManager> Manager;
 };
@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Mittenzx. Licensed under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stations/StationModuleTypes.h"
+
+class ASpaceStationModule;
+
+/**
+ * Station Module Totals - Running power and group totals for one station
+ *
+ * Remembers what each module contributed when it was counted, so placing,
+ * moving or removing a module adjusts the totals in O(1) instead of
+ * rescanning the station. Counting a module again replaces its previous
+ * contribution, which picks up changed power values or groups.
+ *
+ * ModulePower convention: positive is consumption, negative is generation.
+ *
+ * Plain data owned by UStationEditorManager; module pointers are kept alive
+ * by the station's Modules array.
+ *
+ * @see UStationEditorManager
+ */
+class STATIONEDITOR_API FStationModuleTotals
+{
+public:
+	/** Remove all modules */
+	void Reset();
+
+	/** Count a module, replacing its previous contribution if already counted */
+	void AddModule(const ASpaceStationModule* Module);
+
+	/** Stop counting a module; returns false if it wasn't counted */
+	bool RemoveModule(const ASpaceStationModule* Module);
+
+	/** Number of counted modules */
+	int32 Num() const { return Contributions.Num(); }
+
+	/** Total generation (MW) */
+	float GetPowerGenerated() const { return static_cast<float>(PowerGenerated); }
+
+	/** Total consumption (MW) */
+	float GetPowerConsumed() const { return static_cast<float>(PowerConsumed); }
+
+	/** Modules in a group */
+	int32 GetGroupCount(EStationModuleGroup Group) const;
+
+	/** Power group modules plus any module with negative ModulePower */
+	int32 GetGeneratorCount() const { return GeneratorCount; }
+
+	/** Whether a module counts as a generator */
+	static bool IsGenerator(const ASpaceStationModule* Module);
+
+private:
+	/** What a module added to the totals when it was counted */
+	struct FContribution
+	{
+		float Power = 0.0f;
+		EStationModuleGroup Group = EStationModuleGroup::Other;
+		bool bIsGenerator = false;
+	};
+
+	void Apply(const FContribution& Contribution, int32 Sign);
+
+	TMap<const ASpaceStationModule*, FContribution> Contributions;
+	TMap<EStationModuleGroup, int32> GroupCounts;
+
+	/** Accumulated in double so long add/remove sequences don't drift */
+	double PowerGenerated = 0.0;
+	double PowerConsumed = 0.0;
+	int32 GeneratorCount = 0;
+};
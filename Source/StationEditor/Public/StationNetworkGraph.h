@@ -0,0 +1,100 @@
+// Copyright (c) 2025 Mittenzx. Licensed under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ASpaceStationModule;
+
+/**
+ * Station Network Graph - Adjacency and connectivity for one connection type
+ *
+ * Keeps per-module adjacency lists and connected components (union-find
+ * with path halving and union by rank), so reachability queries such as
+ * "is this module on a network with a generator" cost O(α(N)) instead of a
+ * scan of every connection.
+ *
+ * Adding a link unions two components in place. Union-find can't split a
+ * component, so removing a link or module marks the components dirty and
+ * the next query rebuilds them from the adjacency lists in O(N + E).
+ *
+ * Plain data owned by UStationEditorManager; module pointers are kept alive
+ * by the station's Modules array.
+ *
+ * @see UStationEditorManager
+ */
+class STATIONEDITOR_API FStationNetworkGraph
+{
+public:
+	/** Decides which modules feed the network (e.g. reactors for power) */
+	using FSourcePredicate = TFunction<bool(const ASpaceStationModule*)>;
+
+	/** Set how source modules are recognised; applies to modules added afterwards */
+	void SetSourcePredicate(FSourcePredicate InIsSource) { IsSource = MoveTemp(InIsSource); }
+
+	/** Remove all modules and links */
+	void Reset();
+
+	/** Link two modules, adding them if needed; returns false if already linked */
+	bool AddLink(ASpaceStationModule* ModuleA, ASpaceStationModule* ModuleB);
+
+	/** Unlink two modules; returns false if they weren't linked */
+	bool RemoveLink(ASpaceStationModule* ModuleA, ASpaceStationModule* ModuleB);
+
+	/** Remove a module and all of its links */
+	void RemoveModule(ASpaceStationModule* Module);
+
+	bool HasLink(const ASpaceStationModule* ModuleA, const ASpaceStationModule* ModuleB) const;
+
+	/** Number of links in the network */
+	int32 GetLinkCount() const { return LinkCount; }
+
+	/** Number of links on a module */
+	int32 GetDegree(const ASpaceStationModule* Module) const;
+
+	/** Whether two modules are on the same network */
+	bool AreConnected(const ASpaceStationModule* ModuleA, const ASpaceStationModule* ModuleB) const;
+
+	/** Source modules on the same network as a module (including itself), 0 if it isn't linked */
+	int32 GetReachableSourceCount(const ASpaceStationModule* Module) const;
+
+	/** Non-source modules on a network that contains a source */
+	int32 GetSuppliedModuleCount() const;
+
+	/** Modules directly linked to a module */
+	void GetLinkedModules(const ASpaceStationModule* Module, TArray<ASpaceStationModule*>& OutModules) const;
+
+private:
+	using FNeighborList = TArray<int32, TInlineAllocator<6>>;
+
+	int32 FindOrAddNode(ASpaceStationModule* Module);
+
+	/** Component root of a node, compressing the path on the way */
+	int32 FindRoot(int32 Node) const;
+
+	void Union(int32 NodeA, int32 NodeB) const;
+
+	/** Rebuild components from the adjacency lists after removals */
+	void RebuildComponentsIfDirty() const;
+
+	/** Node index per module */
+	TMap<const ASpaceStationModule*, int32> NodeIndices;
+
+	/** Per-node data, indexed by node */
+	TArray<ASpaceStationModule*> Modules;
+	TArray<FNeighborList> Neighbors;
+	TArray<bool> SourceFlags;
+
+	/** Union-find state (mutable: queries compress paths and rebuild lazily) */
+	mutable TArray<int32> Parents;
+	mutable TArray<uint8> Ranks;
+	mutable TArray<int32> SourceCounts;
+	mutable TArray<int32> Sizes;
+
+	/** Sum of (size - sources) over components with a source, kept up to date by Union */
+	mutable int32 SuppliedCount = 0;
+	mutable bool bComponentsDirty = false;
+
+	FSourcePredicate IsSource;
+	int32 LinkCount = 0;
+};
@@ -0,0 +1,112 @@
+// Copyright (c) 2025 Mittenzx. Licensed under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ASpaceStationModule;
+
+/**
+ * Inclusive range of UStationGridSystem cells covered by a module
+ */
+struct STATIONEDITOR_API FStationModuleFootprint
+{
+	FIntVector Min = FIntVector::ZeroValue;
+	FIntVector Max = FIntVector::ZeroValue;
+
+	FStationModuleFootprint() = default;
+	FStationModuleFootprint(const FIntVector& InMin, const FIntVector& InMax)
+		: Min(InMin)
+		, Max(InMax)
+	{}
+
+	bool Contains(const FIntVector& Cell) const
+	{
+		return Cell.X >= Min.X && Cell.X <= Max.X
+			&& Cell.Y >= Min.Y && Cell.Y <= Max.Y
+			&& Cell.Z >= Min.Z && Cell.Z <= Max.Z;
+	}
+
+	bool Intersects(const FStationModuleFootprint& Other) const
+	{
+		return Min.X <= Other.Max.X && Other.Min.X <= Max.X
+			&& Min.Y <= Other.Max.Y && Other.Min.Y <= Max.Y
+			&& Min.Z <= Other.Max.Z && Other.Min.Z <= Max.Z;
+	}
+
+	/** Whether the footprints share a face without overlapping (6-neighbour adjacency) */
+	bool IsFaceAdjacent(const FStationModuleFootprint& Other) const;
+
+	/** Footprint grown by a number of cells on every side */
+	FStationModuleFootprint ExpandBy(int32 Cells) const
+	{
+		return FStationModuleFootprint(Min - FIntVector(Cells), Max + FIntVector(Cells));
+	}
+};
+
+/**
+ * Station Occupancy Grid - Sparse index of module footprints for one station
+ *
+ * Footprints are stored in UStationGridSystem cell coordinates and bucketed
+ * into chunks of ChunkCells^3 cells, so a module registers in a handful of
+ * chunks regardless of how many cells it covers. Cell-occupancy, overlap and
+ * adjacency queries only visit the chunks the query touches, so their cost
+ * depends on local module density rather than station size.
+ *
+ * Plain data owned by UStationEditorManager; module pointers are kept alive
+ * by the station's Modules array.
+ *
+ * @see UStationEditorManager
+ */
+class STATIONEDITOR_API FStationOccupancyGrid
+{
+public:
+	/** Chunk edge length in cells */
+	static constexpr int32 ChunkCells = 8;
+
+	/** Remove all modules */
+	void Reset();
+
+	/** Add a module, replacing its previous footprint if already present */
+	void AddModule(ASpaceStationModule* Module, const FStationModuleFootprint& Footprint);
+
+	/** Remove a module; returns false if it wasn't present */
+	bool RemoveModule(ASpaceStationModule* Module);
+
+	int32 Num() const { return Footprints.Num(); }
+
+	/** Footprint of a registered module, nullptr if not present */
+	const FStationModuleFootprint* FindFootprint(const ASpaceStationModule* Module) const;
+
+	/** Module covering a cell, nullptr if the cell is free */
+	ASpaceStationModule* GetModuleAt(const FIntVector& Cell) const;
+
+	bool IsCellOccupied(const FIntVector& Cell) const { return GetModuleAt(Cell) != nullptr; }
+
+	/**
+	 * Whether a footprint overlaps any registered module
+	 * @param Ignore Module to skip (e.g. the module being moved)
+	 */
+	bool Overlaps(const FStationModuleFootprint& Footprint, const ASpaceStationModule* Ignore = nullptr) const;
+
+	/**
+	 * Modules sharing a face with a footprint
+	 * @param Ignore Module to skip (usually the footprint's own module)
+	 */
+	void GetAdjacentModules(const FStationModuleFootprint& Footprint, TArray<ASpaceStationModule*>& OutModules, const ASpaceStationModule* Ignore = nullptr) const;
+
+private:
+	using FChunkModules = TArray<ASpaceStationModule*, TInlineAllocator<4>>;
+
+	static FIntVector CellToChunk(const FIntVector& Cell);
+
+	/** Invoke Visitor on every existing chunk overlapping a footprint */
+	template<typename VisitorType>
+	void ForEachChunk(const FStationModuleFootprint& Footprint, VisitorType&& Visitor) const;
+
+	/** Module footprints */
+	TMap<ASpaceStationModule*, FStationModuleFootprint> Footprints;
+
+	/** Modules overlapping each chunk */
+	TMap<FIntVector, FChunkModules> Chunks;
+};
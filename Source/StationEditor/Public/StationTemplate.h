@@ -0,0 +1,110 @@
+// Copyright (c) 2025 Mittenzx. Licensed under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Stations/SpaceStationModule.h"
+#include "StationEditorManager.h"
+#include "StationTemplate.generated.h"
+
+/**
+ * Module placed by a station template
+ */
+USTRUCT(BlueprintType)
+struct STATIONEDITOR_API FStationTemplateModule
+{
+	GENERATED_BODY()
+
+	/** The class to spawn */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Station Template")
+	TSubclassOf<ASpaceStationModule> ModuleClass;
+
+	/** Grid cell relative to the station's own cell */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Station Template")
+	FIntVector Cell = FIntVector::ZeroValue;
+
+	/** Module rotation */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Station Template")
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	FStationTemplateModule() = default;
+};
+
+/**
+ * Connection between two template modules, by index into the template's Modules
+ */
+USTRUCT(BlueprintType)
+struct STATIONEDITOR_API FStationTemplateConnection
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Station Template", meta=(ClampMin=0))
+	int32 ModuleIndexA = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Station Template", meta=(ClampMin=0))
+	int32 ModuleIndexB = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Station Template")
+	EModuleConnectionType ConnectionType = EModuleConnectionType::Power;
+
+	FStationTemplateConnection() = default;
+};
+
+/**
+ * Station Template - Data Asset describing a complete station layout
+ * 
+ * Lists modules by grid cell and the connections between them, so whole
+ * stations can be built from a single asset. Templates are instantiated
+ * by UStationEditorManager::InstantiateTemplate, which spawns modules over
+ * several frames under a time budget.
+ * 
+ * Usage:
+ * 1. Create a Blueprint Data Asset based on this class
+ * 2. Add a module entry per module, with cells relative to the station
+ * 3. Add explicit connections, or enable bAutoGenerateConnections
+ * 4. Pass the asset to InstantiateTemplate while editing a station
+ * 
+ * @see UStationEditorManager
+ * @see FStationTemplateModule
+ */
+UCLASS(BlueprintType)
+class STATIONEDITOR_API UStationTemplate : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Display name shown in the editor UI */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Station Template")
+	FText DisplayName;
+
+	/** Description of the layout */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Station Template", meta=(MultiLine=true))
+	FText Description;
+
+	/** Modules in the layout */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Station Template")
+	TArray<FStationTemplateModule> Modules;
+
+	/** Explicit connections between modules */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Station Template")
+	TArray<FStationTemplateConnection> Connections;
+
+	/** Also connect face-adjacent modules, as the editor does for placed modules */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Station Template")
+	bool bAutoGenerateConnections = true;
+
+	/**
+	 * Get the number of modules in the template
+	 * @return Total count of module entries
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Template")
+	int32 GetModuleCount() const { return Modules.Num(); }
+
+	/**
+	 * Check that every module has a class and every connection references valid modules
+	 * @return True if the template can be instantiated as authored
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Station Template")
+	bool IsTemplateValid() const;
+};
@@ -14,6 +14,11 @@
 
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Trading/TradeTransactionArchive.h"
+#include "Trading/TradeItemDataAsset.h"
+#include "Trading/MarketDataAsset.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -338,4 +343,211 @@ bool FCameraRotationLagTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+// =============================================================================
+// TRADE TRANSACTION ARCHIVE TESTS
+// =============================================================================
+
+namespace TradeTransactionArchiveTest
+{
+	constexpr int32 NumRows = 1000000;
+	constexpr int32 NumItems = 50;
+
+	struct FFixture
+	{
+		TArray<UTradeItemDataAsset*> Items;
+		UMarketDataAsset* Market = nullptr;
+		FString FilePath;
+
+		FFixture()
+		{
+			for (int32 Index = 0; Index < NumItems; ++Index)
+			{
+				UTradeItemDataAsset* Item = NewObject<UTradeItemDataAsset>(GetTransientPackage());
+				Item->ItemID = FName(*FString::Printf(TEXT("ArchiveTestItem_%d"), Index));
+				Item->AddToRoot();
+				Items.Add(Item);
+			}
+
+			Market = NewObject<UMarketDataAsset>(GetTransientPackage());
+			Market->AddToRoot();
+
+			FilePath = FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("Tests"), TEXT("TradeTransactionArchive.adtx"));
+		}
+
+		~FFixture()
+		{
+			for (UTradeItemDataAsset* Item : Items)
+			{
+				Item->RemoveFromRoot();
+			}
+			Market->RemoveFromRoot();
+			IFileManager::Get().Delete(*FilePath);
+		}
+
+		/** Deterministic row; calling with the same stream state reproduces it */
+		FTradeTransaction MakeRow(FRandomStream& Random, int32 Index) const
+		{
+			static const FName Traders[] = { TEXT("Player"), TEXT("Trader_Alpha"), TEXT("Trader_Beta"), NAME_None };
+			static const FName Factions[] = { TEXT("Solaris"), TEXT("Helix"), NAME_None };
+
+			FTradeTransaction Row;
+			Row.TransactionID = FGuid(Random.GetUnsignedInt(), Random.GetUnsignedInt(), Random.GetUnsignedInt(), Random.GetUnsignedInt());
+			Row.TransactionType = static_cast<ETransactionType>(Random.RandRange(0, 5));
+			Row.TradeItem = Random.RandRange(0, 9) == 0 ? nullptr : Items[Random.RandRange(0, NumItems - 1)];
+			Row.Quantity = Random.RandRange(-100, 1000);
+			Row.PricePerUnit = Random.FRandRange(1.0f, 5000.0f);
+			Row.TotalValue = FMath::RoundToInt(Row.Quantity * Row.PricePerUnit);
+			Row.TaxPaid = Row.TotalValue / 20;
+			Row.BuyerID = Traders[Random.RandRange(0, 3)];
+			Row.SellerID = Traders[Random.RandRange(0, 3)];
+			Row.BuyerFactionID = Factions[Random.RandRange(0, 2)];
+			Row.SellerFactionID = Factions[Random.RandRange(0, 2)];
+			Row.Market = Random.RandRange(0, 1) ? Market : nullptr;
+			Row.Location = FVector(Random.FRandRange(-1.0e6f, 1.0e6f), Random.FRandRange(-1.0e6f, 1.0e6f), 0.0);
+			Row.Timestamp = Index * 0.25f;
+			Row.RealTimestamp = FDateTime(2025, 1, 1) + FTimespan::FromSeconds(Index);
+			Row.SupplyLevel = Random.FRand();
+			Row.DemandLevel = Random.FRand();
+			if (Random.RandRange(0, 3) == 0)
+			{
+				Row.ActiveEventIDs.Add(TEXT("Event_Shortage"));
+			}
+			Row.bFlaggedAsSuspicious = Random.RandRange(0, 99) == 0;
+			Row.bInvolvedContraband = Row.TransactionType == ETransactionType::Contraband;
+			Row.bCaughtWithContraband = Row.bInvolvedContraband && Random.RandRange(0, 1) == 0;
+			return Row;
+		}
+
+		bool WriteRows(int32 Seed) const
+		{
+			FRandomStream Random(Seed);
+			FTradeTransactionArchiveWriter Writer;
+			if (!Writer.Open(FilePath))
+			{
+				return false;
+			}
+			for (int32 Index = 0; Index < NumRows; ++Index)
+			{
+				Writer.Write(MakeRow(Random, Index));
+			}
+			return Writer.Close();
+		}
+	};
+
+	bool RowsMatch(const FTradeTransaction& A, const FTradeTransaction& B)
+	{
+		return A.TransactionID == B.TransactionID
+			&& A.TransactionType == B.TransactionType
+			&& A.TradeItem == B.TradeItem
+			&& A.Quantity == B.Quantity
+			&& A.PricePerUnit == B.PricePerUnit
+			&& A.TotalValue == B.TotalValue
+			&& A.TaxPaid == B.TaxPaid
+			&& A.BuyerID == B.BuyerID
+			&& A.SellerID == B.SellerID
+			&& A.BuyerFactionID == B.BuyerFactionID
+			&& A.SellerFactionID == B.SellerFactionID
+			&& A.Market == B.Market
+			&& A.Location == B.Location
+			&& A.Timestamp == B.Timestamp
+			&& A.RealTimestamp == B.RealTimestamp
+			&& A.SupplyLevel == B.SupplyLevel
+			&& A.DemandLevel == B.DemandLevel
+			&& A.ActiveEventIDs == B.ActiveEventIDs
+			&& A.bFlaggedAsSuspicious == B.bFlaggedAsSuspicious
+			&& A.bInvolvedContraband == B.bInvolvedContraband
+			&& A.bCaughtWithContraband == B.bCaughtWithContraband;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTradeTransactionArchiveRoundTripTest,
+	"Adastrea.Trading.TransactionArchive.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FTradeTransactionArchiveRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace TradeTransactionArchiveTest;
+
+	const FFixture Fixture;
+	const int32 Seed = 1234;
+	if (!TestTrue(TEXT("Archive should be written"), Fixture.WriteRows(Seed)))
+	{
+		return false;
+	}
+
+	FTradeTransactionArchiveReader Reader;
+	if (!TestTrue(TEXT("Archive should open"), Reader.Open(Fixture.FilePath)))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Header row count"), Reader.GetNumRows(), static_cast<int64>(NumRows));
+
+	// Regenerate the same rows and compare field by field
+	FRandomStream Random(Seed);
+	TArray<FTradeTransaction> Rows;
+	int32 RowsRead = 0;
+	int32 Mismatches = 0;
+	while (Reader.ReadNextBlock(Rows))
+	{
+		for (const FTradeTransaction& Row : Rows)
+		{
+			if (!RowsMatch(Row, Fixture.MakeRow(Random, RowsRead)))
+			{
+				++Mismatches;
+			}
+			++RowsRead;
+		}
+	}
+
+	TestFalse(TEXT("Reader should not report errors"), Reader.HasError());
+	TestEqual(TEXT("Rows read"), RowsRead, NumRows);
+	TestEqual(TEXT("Mismatched rows"), Mismatches, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTradeTransactionArchiveThroughputTest,
+	"Adastrea.Trading.TransactionArchive.Throughput",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FTradeTransactionArchiveThroughputTest::RunTest(const FString& Parameters)
+{
+	using namespace TradeTransactionArchiveTest;
+
+	const FFixture Fixture;
+
+	const double WriteStart = FPlatformTime::Seconds();
+	if (!TestTrue(TEXT("Archive should be written"), Fixture.WriteRows(5678)))
+	{
+		return false;
+	}
+	const double WriteSeconds = FPlatformTime::Seconds() - WriteStart;
+
+	const int64 FileSize = IFileManager::Get().FileSize(*Fixture.FilePath);
+
+	const double ReadStart = FPlatformTime::Seconds();
+	FTradeTransactionArchiveReader Reader;
+	TArray<FTradeTransaction> Rows;
+	int64 RowsRead = 0;
+	if (Reader.Open(Fixture.FilePath))
+	{
+		while (Reader.ReadNextBlock(Rows))
+		{
+			RowsRead += Rows.Num();
+		}
+	}
+	const double ReadSeconds = FPlatformTime::Seconds() - ReadStart;
+
+	TestFalse(TEXT("Reader should not report errors"), Reader.HasError());
+	TestEqual(TEXT("Rows read"), RowsRead, static_cast<int64>(NumRows));
+
+	// Row generation is included in the write time
+	AddInfo(FString::Printf(TEXT("%d rows, %.1f MB (%.1f bytes/row)"),
+		NumRows, static_cast<double>(FileSize) / (1024.0 * 1024.0), static_cast<double>(FileSize) / NumRows));
+	AddInfo(FString::Printf(TEXT("Write: %.3f s (%.0f rows/s), Read: %.3f s (%.0f rows/s)"),
+		WriteSeconds, NumRows / FMath::Max(WriteSeconds, 1e-6), ReadSeconds, NumRows / FMath::Max(ReadSeconds, 1e-6)));
+
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -113,7 +113,7 @@ class ComprehensiveBuildChecker:
                         'Kismet', 'UObject', 'Modules', 'InputMappingContext',
                         'TimerManager', 'DrawDebugHelpers', 'InputAction',
                         'InputModifiers', 'Net/', 'Animation', 'Camera',
-                        'HAL/', 'Misc/', 'Subsystems/'
+                        'HAL/', 'Misc/', 'Subsystems/', 'Async/', 'AssetRegistry/', 'Algo/', 'Tasks/'
                     ]):
                         continue
                     